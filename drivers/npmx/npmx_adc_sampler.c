@@ -0,0 +1,294 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <npmx_adc.h>
+#include <npmx_adc_sampler.h>
+
+#if defined(CONFIG_NPMX_POWER_ACCOUNT)
+#include <npmx_buck.h>
+#include <npmx_ldsw.h>
+#endif
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(NPMX, CONFIG_NPMX_LOG_LEVEL);
+
+BUILD_ASSERT(IS_POWER_OF_TWO(CONFIG_NPMX_ADC_SAMPLER_RING_SIZE),
+	     "Ring buffer size has to be a power of two");
+
+#define RING_INDEX(idx) ((idx) & (CONFIG_NPMX_ADC_SAMPLER_RING_SIZE - 1))
+
+static void sample_store(struct npmx_adc_sampler *p_sampler, struct npmx_adc_sample const *p_sample)
+{
+	atomic_val_t head = atomic_get(&p_sampler->head);
+
+	if ((head - atomic_get(&p_sampler->tail)) >= CONFIG_NPMX_ADC_SAMPLER_RING_SIZE) {
+		atomic_inc(&p_sampler->dropped);
+		return;
+	}
+
+	p_sampler->ring[RING_INDEX(head)] = *p_sample;
+
+	/* Publish the sample after it has been written. */
+	atomic_set(&p_sampler->head, head + 1);
+
+	k_sem_give(&p_sampler->data_ready);
+}
+
+#if defined(CONFIG_NPMX_POWER_ACCOUNT)
+static int rails_read(npmx_instance_t *p_pm, uint8_t *p_rails)
+{
+	static const uint8_t ldsw_masks[] = {
+		NPMX_LDSW_STATUS_POWERUP_LDSW_1_MASK | NPMX_LDSW_STATUS_POWERUP_LDO_1_MASK,
+		NPMX_LDSW_STATUS_POWERUP_LDSW_2_MASK | NPMX_LDSW_STATUS_POWERUP_LDO_2_MASK,
+	};
+	npmx_buck_status_t buck_status;
+	uint8_t ldsw_status;
+
+	BUILD_ASSERT(ARRAY_SIZE(ldsw_masks) == NPM_LDSW_COUNT);
+	BUILD_ASSERT(NPMX_DRIVER_POWER_RAIL_COUNT <= 8);
+
+	*p_rails = 0;
+
+	for (uint8_t i = 0; i < NPM_BUCK_COUNT; i++) {
+		if (npmx_buck_status_get(npmx_buck_get(p_pm, i), &buck_status) != NPMX_SUCCESS) {
+			return -EIO;
+		}
+		WRITE_BIT(*p_rails, NPMX_DRIVER_POWER_RAIL_BUCK(i), buck_status.powered);
+	}
+
+	/* The status of both load switches is in a single register. */
+	if (npmx_ldsw_status_get(npmx_ldsw_get(p_pm, 0), &ldsw_status) != NPMX_SUCCESS) {
+		return -EIO;
+	}
+
+	for (uint8_t i = 0; i < NPM_LDSW_COUNT; i++) {
+		WRITE_BIT(*p_rails, NPMX_DRIVER_POWER_RAIL_LDSW(i),
+			  (ldsw_status & ldsw_masks[i]) != 0);
+	}
+
+	return 0;
+}
+#endif
+
+/* Triggers the measurements of a sample, stopping at the first task that fails. */
+static int tasks_trigger(npmx_adc_t *adc_instance)
+{
+	static const npmx_adc_task_t tasks[] = {
+		NPMX_ADC_TASK_SINGLE_SHOT_VBAT,
+		NPMX_ADC_TASK_SINGLE_SHOT_NTC,
+		NPMX_ADC_TASK_SINGLE_SHOT_DIE_TEMP,
+	};
+
+	for (size_t i = 0; i < ARRAY_SIZE(tasks); i++) {
+		if (npmx_adc_task_trigger(adc_instance, tasks[i]) != NPMX_SUCCESS) {
+			return -EIO;
+		}
+	}
+
+	return 0;
+}
+
+static void sampler_work_cb(struct k_work *work)
+{
+	struct npmx_adc_sampler *p_sampler = CONTAINER_OF(work, struct npmx_adc_sampler, work);
+	npmx_adc_t *adc_instance = npmx_adc_get(npmx_driver_instance_get(p_sampler->p_dev), 0);
+	int64_t trigger_time = p_sampler->trigger_time;
+	npmx_adc_meas_all_t meas;
+	bool meas_valid;
+	int err = 0;
+
+	/* Read the previous results and trigger the next measurements in a single transfer. */
+	if (npmx_driver_batch_begin(p_sampler->p_dev) != 0) {
+		LOG_WRN("ADC sampling skipped");
+		return;
+	}
+
+	meas_valid = (trigger_time >= 0) &&
+		     (npmx_adc_meas_all_get(adc_instance, &meas) == NPMX_SUCCESS);
+
+#if defined(CONFIG_NPMX_POWER_ACCOUNT)
+	uint8_t trigger_rails = p_sampler->trigger_rails;
+	bool first = p_sampler->restarted;
+
+	if (meas_valid) {
+		p_sampler->restarted = false;
+	}
+
+	/* Without the output states, the next sample cannot be attributed. */
+	err = rails_read(npmx_driver_instance_get(p_sampler->p_dev), &p_sampler->trigger_rails);
+#endif
+
+	p_sampler->trigger_time = k_uptime_get();
+
+	if (err == 0) {
+		err = tasks_trigger(adc_instance);
+	}
+
+	/* Send the queued accesses also if reading or triggering stopped on an error. */
+	int end_err = npmx_driver_batch_end(p_sampler->p_dev);
+
+	if (err == 0) {
+		err = end_err;
+	}
+
+	if (err != 0) {
+		LOG_ERR("Triggering ADC measurements failed");
+		p_sampler->trigger_time = -1;
+	}
+
+	if (meas_valid) {
+		struct npmx_adc_sample sample = {
+			.timestamp = trigger_time,
+			.vbat = meas.values[NPMX_ADC_MEAS_VBAT],
+			.ibat = meas.values[NPMX_ADC_MEAS_VBAT2_IBAT],
+			.bat_temp = meas.values[NPMX_ADC_MEAS_BAT_TEMP],
+			.die_temp = meas.values[NPMX_ADC_MEAS_DIE_TEMP],
+#if defined(CONFIG_NPMX_POWER_ACCOUNT)
+			.rails = trigger_rails,
+			.first = first,
+#endif
+		};
+
+		sample_store(p_sampler, &sample);
+	}
+}
+
+static void sampler_timer_cb(struct k_timer *timer)
+{
+	struct npmx_adc_sampler *p_sampler = CONTAINER_OF(timer, struct npmx_adc_sampler, timer);
+
+	k_work_submit(&p_sampler->work);
+}
+
+void npmx_adc_sampler_init(struct npmx_adc_sampler *p_sampler, const struct device *p_dev)
+{
+	p_sampler->p_dev = p_dev;
+	p_sampler->trigger_time = -1;
+	p_sampler->period_ms = 0;
+
+	atomic_set(&p_sampler->head, 0);
+	atomic_set(&p_sampler->tail, 0);
+	atomic_set(&p_sampler->dropped, 0);
+
+	k_timer_init(&p_sampler->timer, sampler_timer_cb, NULL);
+	k_work_init(&p_sampler->work, sampler_work_cb);
+	k_sem_init(&p_sampler->data_ready, 0, 1);
+
+	npmx_driver_adc_sampler_register(p_dev, p_sampler);
+}
+
+int npmx_adc_sampler_start(struct npmx_adc_sampler *p_sampler, uint32_t period_ms)
+{
+	npmx_adc_t *adc_instance = npmx_adc_get(npmx_driver_instance_get(p_sampler->p_dev), 0);
+
+	if (period_ms == 0) {
+		return -EINVAL;
+	}
+
+	/* Measure the battery current after each battery voltage measurement. */
+	if (npmx_adc_ibat_meas_enable_set(adc_instance, true) != NPMX_SUCCESS) {
+		return -EIO;
+	}
+
+	p_sampler->trigger_time = -1;
+	p_sampler->period_ms = period_ms;
+#if defined(CONFIG_NPMX_POWER_ACCOUNT)
+	p_sampler->restarted = true;
+#endif
+
+	k_timer_start(&p_sampler->timer, K_NO_WAIT, K_MSEC(period_ms));
+
+	return 0;
+}
+
+void npmx_adc_sampler_stop(struct npmx_adc_sampler *p_sampler)
+{
+	p_sampler->period_ms = 0;
+
+	k_timer_stop(&p_sampler->timer);
+}
+
+void npmx_adc_sampler_suspend(struct npmx_adc_sampler *p_sampler)
+{
+	struct k_work_sync sync;
+
+	k_timer_stop(&p_sampler->timer);
+	(void)k_work_cancel_sync(&p_sampler->work, &sync);
+}
+
+void npmx_adc_sampler_resume(struct npmx_adc_sampler *p_sampler)
+{
+	uint32_t period_ms = p_sampler->period_ms;
+
+	if (period_ms == 0) {
+		return;
+	}
+
+	p_sampler->trigger_time = -1;
+#if defined(CONFIG_NPMX_POWER_ACCOUNT)
+	/* The battery current is not known while suspended. */
+	p_sampler->restarted = true;
+#endif
+
+	k_timer_start(&p_sampler->timer, K_NO_WAIT, K_MSEC(period_ms));
+}
+
+int npmx_adc_sampler_period_set(struct npmx_adc_sampler *p_sampler, uint32_t period_ms)
+{
+	if (period_ms == 0) {
+		return -EINVAL;
+	}
+
+	if (p_sampler->period_ms == 0) {
+		return -EPERM;
+	}
+
+	p_sampler->period_ms = period_ms;
+
+	k_timer_start(&p_sampler->timer, K_MSEC(period_ms), K_MSEC(period_ms));
+
+	return 0;
+}
+
+int npmx_adc_sampler_trigger(struct npmx_adc_sampler *p_sampler)
+{
+	uint32_t period_ms = p_sampler->period_ms;
+
+	if (period_ms == 0) {
+		return -EPERM;
+	}
+
+	k_timer_start(&p_sampler->timer, K_NO_WAIT, K_MSEC(period_ms));
+
+	return 0;
+}
+
+size_t npmx_adc_sampler_get(struct npmx_adc_sampler *p_sampler, struct npmx_adc_sample *p_samples,
+			    size_t max_count, k_timeout_t timeout)
+{
+	atomic_val_t tail = atomic_get(&p_sampler->tail);
+	size_t count = 0;
+
+	if ((atomic_get(&p_sampler->head) == tail) &&
+	    (k_sem_take(&p_sampler->data_ready, timeout) != 0)) {
+		return 0;
+	}
+
+	while ((count < max_count) && (atomic_get(&p_sampler->head) != tail)) {
+		p_samples[count++] = p_sampler->ring[RING_INDEX(tail)];
+		tail++;
+	}
+
+	/* Release the slots after the samples have been copied. */
+	atomic_set(&p_sampler->tail, tail);
+
+	return count;
+}
+
+uint32_t npmx_adc_sampler_dropped_get(struct npmx_adc_sampler *p_sampler)
+{
+	return (uint32_t)atomic_clear(&p_sampler->dropped);
+}
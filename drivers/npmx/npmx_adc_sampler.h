@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef ZEPHYR_DRIVERS_NPMX_NPMX_ADC_SAMPLER_H__
+#define ZEPHYR_DRIVERS_NPMX_NPMX_ADC_SAMPLER_H__
+
+#include <npmx_driver.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/slist.h>
+
+/** @brief Battery measurements taken in a single sampling period. */
+struct npmx_adc_sample {
+	int64_t timestamp; /* Uptime in milliseconds when the measurements were triggered. */
+	int32_t vbat; /* Battery voltage in millivolts. */
+	int32_t ibat; /* Battery current in milliamperes. */
+	int32_t bat_temp; /* Battery temperature in millidegrees Celsius. */
+	int32_t die_temp; /* Die temperature in millidegrees Celsius. */
+#if defined(CONFIG_NPMX_POWER_ACCOUNT)
+	uint8_t rails; /* Outputs enabled at the timestamp, bit n for NPMX_DRIVER_POWER_RAIL n. */
+	bool first; /* First sample after the sampling start, not following the previous one. */
+#endif
+};
+
+/** @brief ADC sampler instance. All fields are private. */
+struct npmx_adc_sampler {
+	const struct device *p_dev; /* Pointer to the nPM Zephyr device. */
+	sys_snode_t node; /* Node in the list of samplers of the nPM device. */
+	struct k_timer timer; /* Sampling period timer. */
+	struct k_work work; /* Work item reading and triggering measurements. */
+	struct k_sem data_ready; /* Given when a sample is stored. */
+	int64_t trigger_time; /* Uptime of the last measurement trigger, negative if none. */
+#if defined(CONFIG_NPMX_POWER_ACCOUNT)
+	uint8_t trigger_rails; /* Outputs enabled at the last measurement trigger. */
+	bool restarted; /* No sample stored since the sampling start. */
+#endif
+	uint32_t period_ms; /* Sampling period in milliseconds, 0 if sampling is stopped. */
+	atomic_t head; /* Index of the next sample to be stored, written by the producer only. */
+	atomic_t tail; /* Index of the next sample to be taken, written by the consumer only. */
+	atomic_t dropped; /* Number of samples dropped because the ring buffer was full. */
+	struct npmx_adc_sample ring[CONFIG_NPMX_ADC_SAMPLER_RING_SIZE];
+};
+
+/**
+ * @brief Function for initializing the ADC sampler.
+ *
+ * @param[in] p_sampler Pointer to the ADC sampler instance.
+ * @param[in] p_dev     Pointer to the nPM Zephyr device.
+ */
+void npmx_adc_sampler_init(struct npmx_adc_sampler *p_sampler, const struct device *p_dev);
+
+/**
+ * @brief Function for starting periodic battery measurements.
+ *
+ * In each period, results of the measurements triggered in the previous period are stored in
+ * the ring buffer and the next VBAT, IBAT, NTC and die temperature measurements are triggered.
+ * The first sample is available after two periods. With CONFIG_NPMX_POWER_ACCOUNT, the BUCK
+ * and load switch states are read before each trigger.
+ *
+ * @param[in] p_sampler Pointer to the ADC sampler instance.
+ * @param[in] period_ms Sampling period in milliseconds.
+ *
+ * @retval 0       Sampling started.
+ * @retval -EINVAL Invalid period.
+ * @retval -EIO    Error using IO bus line.
+ */
+int npmx_adc_sampler_start(struct npmx_adc_sampler *p_sampler, uint32_t period_ms);
+
+/**
+ * @brief Function for stopping periodic battery measurements.
+ *
+ * Samples already stored in the ring buffer can still be read.
+ *
+ * @param[in] p_sampler Pointer to the ADC sampler instance.
+ */
+void npmx_adc_sampler_stop(struct npmx_adc_sampler *p_sampler);
+
+/**
+ * @brief Function for pausing periodic measurements while the nPM device is suspended.
+ *
+ * Called by the nPM device. Waits for the sampling in progress to complete.
+ *
+ * @param[in] p_sampler Pointer to the ADC sampler instance.
+ */
+void npmx_adc_sampler_suspend(struct npmx_adc_sampler *p_sampler);
+
+/**
+ * @brief Function for restarting periodic measurements paused by @ref npmx_adc_sampler_suspend.
+ *
+ * Called by the nPM device. Sampling restarts as after @ref npmx_adc_sampler_start, if it was not
+ * stopped. Measurements triggered before the suspend are discarded.
+ *
+ * @param[in] p_sampler Pointer to the ADC sampler instance.
+ */
+void npmx_adc_sampler_resume(struct npmx_adc_sampler *p_sampler);
+
+/**
+ * @brief Function for changing the sampling period.
+ *
+ * The next sampling is done after the new period, counted from the call. Used to adapt the rate
+ * of measurements to the battery load, right after taking a sample.
+ *
+ * @param[in] p_sampler Pointer to the ADC sampler instance.
+ * @param[in] period_ms Sampling period in milliseconds.
+ *
+ * @retval 0       Period changed.
+ * @retval -EINVAL Invalid period.
+ * @retval -EPERM  Sampling not started.
+ */
+int npmx_adc_sampler_period_set(struct npmx_adc_sampler *p_sampler, uint32_t period_ms);
+
+/**
+ * @brief Function for sampling immediately, without waiting for the end of the period.
+ *
+ * The results of the measurements triggered in the previous period are stored and the period is
+ * restarted. Can be called from npmx event handlers, to follow changes of the battery load.
+ *
+ * @param[in] p_sampler Pointer to the ADC sampler instance.
+ *
+ * @retval 0      Sampling scheduled.
+ * @retval -EPERM Sampling not started.
+ */
+int npmx_adc_sampler_trigger(struct npmx_adc_sampler *p_sampler);
+
+/**
+ * @brief Function for taking samples from the ring buffer.
+ *
+ * Only a single thread can take samples from the instance.
+ *
+ * @param[in]  p_sampler Pointer to the ADC sampler instance.
+ * @param[out] p_samples Pointer to the array for samples, oldest first.
+ * @param[in]  max_count Maximum number of samples to be taken.
+ * @param[in]  timeout   Time to wait for a sample if the ring buffer is empty.
+ *
+ * @return Number of samples taken.
+ */
+size_t npmx_adc_sampler_get(struct npmx_adc_sampler *p_sampler, struct npmx_adc_sample *p_samples,
+			    size_t max_count, k_timeout_t timeout);
+
+/**
+ * @brief Function for reading and clearing the number of samples dropped because the ring
+ *        buffer was full.
+ *
+ * @param[in] p_sampler Pointer to the ADC sampler instance.
+ *
+ * @return Number of dropped samples.
+ */
+uint32_t npmx_adc_sampler_dropped_get(struct npmx_adc_sampler *p_sampler);
+
+#endif /* ZEPHYR_DRIVERS_NPMX_NPMX_ADC_SAMPLER_H__ */
@@ -0,0 +1,354 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <npmx_adc.h>
+#include <npmx_boot_config.h>
+#include <npmx_buck.h>
+#include <npmx_charger.h>
+#include <npmx_driver.h>
+#include <npmx_gpio.h>
+#include <npmx_ldsw.h>
+#include <npmx_vbusin.h>
+#if defined(CONFIG_NPMX_LED)
+#include <npmx_led.h>
+#endif
+
+#if defined(CONFIG_NPMX_WARM_BOOT)
+#include <zephyr/sys/crc.h>
+#endif
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(NPMX, CONFIG_NPMX_LOG_LEVEL);
+
+/* Values of the mode properties, in devicetree binding enum order. */
+static const npmx_buck_mode_t buck_modes[] = {
+	NPMX_BUCK_MODE_AUTO,
+	NPMX_BUCK_MODE_PFM,
+	NPMX_BUCK_MODE_PWM,
+};
+
+static const npmx_ldsw_mode_t ldsw_modes[] = {
+	NPMX_LDSW_MODE_LOAD_SWITCH,
+	NPMX_LDSW_MODE_LDO,
+};
+
+static const npmx_gpio_mode_t gpio_modes[] = {
+	NPMX_GPIO_MODE_INPUT,
+	NPMX_GPIO_MODE_INPUT_OVERRIDE_1,
+	NPMX_GPIO_MODE_INPUT_OVERRIDE_0,
+	NPMX_GPIO_MODE_INPUT_RISING_EDGE,
+	NPMX_GPIO_MODE_INPUT_FALLING_EDGE,
+	NPMX_GPIO_MODE_OUTPUT_IRQ,
+	NPMX_GPIO_MODE_OUTPUT_RESET,
+	NPMX_GPIO_MODE_OUTPUT_PLW,
+	NPMX_GPIO_MODE_OUTPUT_OVERRIDE_1,
+	NPMX_GPIO_MODE_OUTPUT_OVERRIDE_0,
+};
+
+#if defined(CONFIG_NPMX_LED)
+static const npmx_led_mode_t led_modes[] = {
+	NPMX_LED_MODE_ERROR,
+	NPMX_LED_MODE_CHARGING,
+	NPMX_LED_MODE_HOST,
+	NPMX_LED_MODE_NOTUSED,
+};
+#endif
+
+/* Value of the retained record magic field, "nPMX". */
+#define RETAINED_MAGIC 0x584D506EUL
+
+/* Indexes of the boot-state property values. */
+#define BOOT_STATE_OFF 0
+#define BOOT_STATE_ON  1
+
+#define CHECK(expression)                                                                          \
+	do {                                                                                       \
+		if ((expression) != NPMX_SUCCESS) {                                                \
+			return -EIO;                                                               \
+		}                                                                                  \
+	} while (0)
+
+static int charger_apply(npmx_instance_t *p_pm, struct npmx_boot_charger const *p_config)
+{
+	npmx_charger_t *charger_instance = npmx_charger_get(p_pm, 0);
+	uint32_t modules;
+
+	/* Charging parameters can be changed only with the charger disabled. */
+	CHECK(npmx_charger_module_get(charger_instance, &modules));
+	CHECK(npmx_charger_module_disable_set(charger_instance, NPMX_CHARGER_MODULE_CHARGER_MASK));
+
+	if (p_config->charging_ma != NPMX_BOOT_UNCHANGED) {
+		CHECK(npmx_charger_charging_current_set(charger_instance,
+							(uint16_t)p_config->charging_ma));
+	}
+
+	if (p_config->discharging_ma != NPMX_BOOT_UNCHANGED) {
+		CHECK(npmx_charger_discharging_current_set(charger_instance,
+							   (uint16_t)p_config->discharging_ma));
+	}
+
+	if (p_config->termination_mv != NPMX_BOOT_UNCHANGED) {
+		npmx_charger_voltage_t voltage =
+			npmx_charger_voltage_convert((uint32_t)p_config->termination_mv);
+
+		if (voltage == NPMX_CHARGER_VOLTAGE_INVALID) {
+			LOG_ERR("Invalid termination voltage: %d mV", p_config->termination_mv);
+			return -EINVAL;
+		}
+
+		CHECK(npmx_charger_termination_normal_voltage_set(charger_instance, voltage));
+	}
+
+	if (p_config->termination_warm_mv != NPMX_BOOT_UNCHANGED) {
+		npmx_charger_voltage_t voltage =
+			npmx_charger_voltage_convert((uint32_t)p_config->termination_warm_mv);
+
+		if (voltage == NPMX_CHARGER_VOLTAGE_INVALID) {
+			LOG_ERR("Invalid warm termination voltage: %d mV",
+				p_config->termination_warm_mv);
+			return -EINVAL;
+		}
+
+		CHECK(npmx_charger_termination_warm_voltage_set(charger_instance, voltage));
+	}
+
+	if (p_config->vbus_limit_ma != NPMX_BOOT_UNCHANGED) {
+		npmx_vbusin_t *vbusin_instance = npmx_vbusin_get(p_pm, 0);
+		npmx_vbusin_current_t current =
+			npmx_vbusin_current_convert((uint32_t)p_config->vbus_limit_ma);
+
+		if (current == NPMX_VBUSIN_CURRENT_INVALID) {
+			LOG_ERR("Invalid VBUS current limit: %d mA", p_config->vbus_limit_ma);
+			return -EINVAL;
+		}
+
+		CHECK(npmx_vbusin_current_limit_set(vbusin_instance, current));
+		CHECK(npmx_vbusin_task_trigger(vbusin_instance,
+					       NPMX_VBUSIN_TASK_APPLY_CURRENT_LIMIT));
+	}
+
+	if (p_config->ntc_ohms != NPMX_BOOT_UNCHANGED) {
+		npmx_adc_ntc_config_t ntc_config = {
+			.type = npmx_adc_ntc_type_convert((uint32_t)p_config->ntc_ohms),
+			.beta = p_config->ntc_beta,
+		};
+
+		if (ntc_config.type == NPMX_ADC_NTC_TYPE_INVALID) {
+			LOG_ERR("Invalid thermistor resistance: %d ohms", p_config->ntc_ohms);
+			return -EINVAL;
+		}
+
+		CHECK(npmx_adc_ntc_config_set(npmx_adc_get(p_pm, 0), &ntc_config));
+	}
+
+	/* Without any enable property, the charger is left as it was found. */
+	if (p_config->modules != 0) {
+		CHECK(npmx_charger_module_enable_set(charger_instance, p_config->modules));
+	} else if ((modules & NPMX_CHARGER_MODULE_CHARGER_MASK) != 0) {
+		CHECK(npmx_charger_module_enable_set(charger_instance,
+						     NPMX_CHARGER_MODULE_CHARGER_MASK));
+	}
+
+	return 0;
+}
+
+static int buck_apply(npmx_instance_t *p_pm, struct npmx_boot_buck const *p_config)
+{
+	npmx_buck_t *buck_instance = npmx_buck_get(p_pm, p_config->index);
+
+	if (p_config->normal_mv != NPMX_BOOT_UNCHANGED) {
+		npmx_buck_voltage_t voltage =
+			npmx_buck_voltage_convert((uint32_t)p_config->normal_mv);
+
+		if (voltage == NPMX_BUCK_VOLTAGE_INVALID) {
+			LOG_ERR("Invalid BUCK%d voltage: %d mV", p_config->index + 1,
+				p_config->normal_mv);
+			return -EINVAL;
+		}
+
+		CHECK(npmx_buck_normal_voltage_set(buck_instance, voltage));
+		CHECK(npmx_buck_vout_select_set(buck_instance, NPMX_BUCK_VOUT_SELECT_SOFTWARE));
+	}
+
+	if (p_config->retention_mv != NPMX_BOOT_UNCHANGED) {
+		npmx_buck_voltage_t voltage =
+			npmx_buck_voltage_convert((uint32_t)p_config->retention_mv);
+
+		if (voltage == NPMX_BUCK_VOLTAGE_INVALID) {
+			LOG_ERR("Invalid BUCK%d retention voltage: %d mV", p_config->index + 1,
+				p_config->retention_mv);
+			return -EINVAL;
+		}
+
+		CHECK(npmx_buck_retention_voltage_set(buck_instance, voltage));
+	}
+
+	if (p_config->mode != NPMX_BOOT_UNCHANGED) {
+		CHECK(npmx_buck_converter_mode_set(buck_instance, buck_modes[p_config->mode]));
+	}
+
+	CHECK(npmx_buck_active_discharge_enable_set(buck_instance, p_config->active_discharge));
+
+	if (p_config->state == BOOT_STATE_ON) {
+		CHECK(npmx_buck_task_trigger(buck_instance, NPMX_BUCK_TASK_ENABLE));
+	} else if (p_config->state == BOOT_STATE_OFF) {
+		CHECK(npmx_buck_task_trigger(buck_instance, NPMX_BUCK_TASK_DISABLE));
+	}
+
+	return 0;
+}
+
+static int ldsw_apply(npmx_instance_t *p_pm, struct npmx_boot_ldsw const *p_config)
+{
+	npmx_ldsw_t *ldsw_instance = npmx_ldsw_get(p_pm, p_config->index);
+
+	if (p_config->ldo_mv != NPMX_BOOT_UNCHANGED) {
+		npmx_ldsw_voltage_t voltage = npmx_ldsw_voltage_convert((uint32_t)p_config->ldo_mv);
+
+		if (voltage == NPMX_LDSW_VOLTAGE_INVALID) {
+			LOG_ERR("Invalid LDSW%d voltage: %d mV", p_config->index + 1,
+				p_config->ldo_mv);
+			return -EINVAL;
+		}
+
+		CHECK(npmx_ldsw_ldo_voltage_set(ldsw_instance, voltage));
+	}
+
+	if (p_config->mode != NPMX_BOOT_UNCHANGED) {
+		CHECK(npmx_ldsw_mode_set(ldsw_instance, ldsw_modes[p_config->mode]));
+	}
+
+	CHECK(npmx_ldsw_active_discharge_enable_set(ldsw_instance, p_config->active_discharge));
+
+	if (p_config->state == BOOT_STATE_ON) {
+		CHECK(npmx_ldsw_task_trigger(ldsw_instance, NPMX_LDSW_TASK_ENABLE));
+	} else if (p_config->state == BOOT_STATE_OFF) {
+		CHECK(npmx_ldsw_task_trigger(ldsw_instance, NPMX_LDSW_TASK_DISABLE));
+	}
+
+	return 0;
+}
+
+static int config_apply(npmx_instance_t *p_pm, struct npmx_boot_config const *p_config)
+{
+	int err;
+
+	for (size_t i = 0; i < p_config->charger_count; i++) {
+		err = charger_apply(p_pm, &p_config->p_chargers[i]);
+		if (err != 0) {
+			return err;
+		}
+	}
+
+	for (size_t i = 0; i < p_config->buck_count; i++) {
+		err = buck_apply(p_pm, &p_config->p_bucks[i]);
+		if (err != 0) {
+			return err;
+		}
+	}
+
+	for (size_t i = 0; i < p_config->ldsw_count; i++) {
+		err = ldsw_apply(p_pm, &p_config->p_ldsws[i]);
+		if (err != 0) {
+			return err;
+		}
+	}
+
+	for (size_t i = 0; i < p_config->gpio_count; i++) {
+		struct npmx_boot_mode const *p_gpio = &p_config->p_gpios[i];
+
+		CHECK(npmx_gpio_mode_set(npmx_gpio_get(p_pm, p_gpio->index),
+					 gpio_modes[p_gpio->mode]));
+	}
+
+#if defined(CONFIG_NPMX_LED)
+	for (size_t i = 0; i < p_config->led_count; i++) {
+		struct npmx_boot_mode const *p_led = &p_config->p_leds[i];
+
+		CHECK(npmx_led_mode_set(npmx_led_get(p_pm, p_led->index), led_modes[p_led->mode]));
+	}
+#else
+	if (p_config->led_count > 0) {
+		LOG_WRN("LED configuration skipped, CONFIG_NPMX_LED is disabled");
+	}
+#endif
+
+	return 0;
+}
+
+#if defined(CONFIG_NPMX_WARM_BOOT)
+static uint32_t config_hash(struct npmx_boot_config const *p_config)
+{
+	uint32_t hash = 0;
+
+	/* Tables are constant, so their padding is zero and does not change the hash. */
+	hash = crc32_ieee_update(hash, (const uint8_t *)p_config->p_chargers,
+				 p_config->charger_count * sizeof(p_config->p_chargers[0]));
+	hash = crc32_ieee_update(hash, (const uint8_t *)p_config->p_bucks,
+				 p_config->buck_count * sizeof(p_config->p_bucks[0]));
+	hash = crc32_ieee_update(hash, (const uint8_t *)p_config->p_ldsws,
+				 p_config->ldsw_count * sizeof(p_config->p_ldsws[0]));
+	hash = crc32_ieee_update(hash, (const uint8_t *)p_config->p_gpios,
+				 p_config->gpio_count * sizeof(p_config->p_gpios[0]));
+	hash = crc32_ieee_update(hash, (const uint8_t *)p_config->p_leds,
+				 p_config->led_count * sizeof(p_config->p_leds[0]));
+
+	return hash;
+}
+#endif
+
+bool npmx_boot_config_applied_check(struct npmx_boot_config const *p_config)
+{
+#if defined(CONFIG_NPMX_WARM_BOOT)
+	struct npmx_boot_retained const *p_retained = p_config->p_retained;
+
+	return (p_retained->magic == RETAINED_MAGIC) && (p_retained->hash == config_hash(p_config));
+#else
+	ARG_UNUSED(p_config);
+
+	return false;
+#endif
+}
+
+void npmx_boot_config_applied_clear(struct npmx_boot_config const *p_config)
+{
+#if defined(CONFIG_NPMX_WARM_BOOT)
+	p_config->p_retained->magic = 0;
+#else
+	ARG_UNUSED(p_config);
+#endif
+}
+
+int npmx_boot_config_apply(const struct device *p_dev, struct npmx_boot_config const *p_config)
+{
+#if defined(CONFIG_NPMX_WARM_BOOT)
+	/* Do not trust the record if the SoC is reset while the configuration is applied. */
+	p_config->p_retained->magic = 0;
+#endif
+
+	int err = npmx_driver_batch_begin(p_dev);
+
+	if (err != 0) {
+		return err;
+	}
+
+	err = config_apply(npmx_driver_instance_get(p_dev), p_config);
+
+	/* Send the queued writes also if applying the configuration stopped on an error. */
+	int end_err = npmx_driver_batch_end(p_dev);
+
+	if (err != 0) {
+		return err;
+	}
+
+#if defined(CONFIG_NPMX_WARM_BOOT)
+	if (end_err == 0) {
+		p_config->p_retained->hash = config_hash(p_config);
+		p_config->p_retained->magic = RETAINED_MAGIC;
+	}
+#endif
+
+	return end_err;
+}
@@ -0,0 +1,243 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef ZEPHYR_DRIVERS_NPMX_NPMX_BOOT_CONFIG_H__
+#define ZEPHYR_DRIVERS_NPMX_NPMX_BOOT_CONFIG_H__
+
+#include <npmx_charger.h>
+
+#include <zephyr/device.h>
+#include <zephyr/devicetree.h>
+#include <zephyr/sys/util.h>
+
+/** @brief Value of boot configuration fields that leave the setting unchanged. */
+#define NPMX_BOOT_UNCHANGED (-1)
+
+/** @brief Boot configuration of a BUCK converter. */
+struct npmx_boot_buck {
+	uint8_t index; /* BUCK instance index. */
+	int8_t mode; /* Index of the mode property value. */
+	int8_t state; /* Index of the boot-state property value. */
+	bool active_discharge; /* Active discharge enabled. */
+	int32_t normal_mv; /* Normal mode output voltage in millivolts. */
+	int32_t retention_mv; /* Retention mode output voltage in millivolts. */
+};
+
+/** @brief Boot configuration of a load switch. */
+struct npmx_boot_ldsw {
+	uint8_t index; /* LDSW instance index. */
+	int8_t mode; /* Index of the mode property value. */
+	int8_t state; /* Index of the boot-state property value. */
+	bool active_discharge; /* Active discharge enabled. */
+	int32_t ldo_mv; /* LDO mode output voltage in millivolts. */
+};
+
+/** @brief Boot configuration of the charger, VBUS and battery thermistor. */
+struct npmx_boot_charger {
+	int32_t charging_ma; /* Charging current in milliamperes. */
+	int32_t discharging_ma; /* Discharging current in milliamperes. */
+	int32_t termination_mv; /* Normal termination voltage in millivolts. */
+	int32_t termination_warm_mv; /* Warm termination voltage in millivolts. */
+	int32_t vbus_limit_ma; /* VBUS current limit in milliamperes. */
+	int32_t ntc_ohms; /* Thermistor resistance in ohms. */
+	uint32_t ntc_beta; /* Thermistor beta value. */
+	uint32_t modules; /* Mask of charger modules enabled after configuration. */
+};
+
+/** @brief Boot configuration of a GPIO or an LED driver. */
+struct npmx_boot_mode {
+	uint8_t index; /* Instance index. */
+	uint8_t mode; /* Index of the mode property value. */
+};
+
+#if defined(CONFIG_NPMX_WARM_BOOT)
+/** @brief Record of the applied boot configuration, kept in RAM retained over SoC resets. */
+struct npmx_boot_retained {
+	uint32_t magic; /* Marks the record as valid. */
+	uint32_t hash; /* Hash of the applied boot configuration. */
+};
+#endif
+
+/** @brief Boot configuration of an nPM device, generated from its devicetree child nodes. */
+struct npmx_boot_config {
+	const struct npmx_boot_charger *p_chargers;
+	const struct npmx_boot_buck *p_bucks;
+	const struct npmx_boot_ldsw *p_ldsws;
+	const struct npmx_boot_mode *p_gpios;
+	const struct npmx_boot_mode *p_leds;
+	uint8_t charger_count;
+	uint8_t buck_count;
+	uint8_t ldsw_count;
+	uint8_t gpio_count;
+	uint8_t led_count;
+#if defined(CONFIG_NPMX_WARM_BOOT)
+	struct npmx_boot_retained *p_retained;
+#endif
+};
+
+/**
+ * @brief Function for applying the boot configuration.
+ *
+ * The charger is configured first, with charging disabled, followed by bucks, load switches,
+ * GPIOs and LEDs. All register writes are queued in a single batch.
+ *
+ * @param[in] p_dev    Pointer to the nPM Zephyr device.
+ * @param[in] p_config Pointer to the boot configuration.
+ *
+ * @retval 0       Configuration applied.
+ * @retval -EINVAL Devicetree value not supported by the device.
+ * @retval -EIO    Error using IO bus line.
+ */
+int npmx_boot_config_apply(const struct device *p_dev, struct npmx_boot_config const *p_config);
+
+/**
+ * @brief Function for checking if the boot configuration has already been applied.
+ *
+ * The configuration is considered applied if the record left in retained RAM by
+ * @ref npmx_boot_config_apply holds the hash of the same configuration. This is the case after
+ * a SoC reset that does not power cycle the nPM device, for example a watchdog reset or a reset
+ * after a firmware update that did not change the configuration.
+ *
+ * @param[in] p_config Pointer to the boot configuration.
+ *
+ * @retval true  Configuration has already been applied.
+ * @retval false Configuration has to be applied. Always returned if CONFIG_NPMX_WARM_BOOT
+ *               is disabled.
+ */
+bool npmx_boot_config_applied_check(struct npmx_boot_config const *p_config);
+
+/**
+ * @brief Function for clearing the record of the applied boot configuration.
+ *
+ * Used before the nPM device is put in a mode it leaves with its power-on configuration, so that
+ * the boot configuration is applied again if the SoC keeps the retained RAM. Does nothing if
+ * CONFIG_NPMX_WARM_BOOT is disabled.
+ *
+ * @param[in] p_config Pointer to the boot configuration.
+ */
+void npmx_boot_config_applied_clear(struct npmx_boot_config const *p_config);
+
+/* Helpers for NPMX_BOOT_CONFIG_DEFINE. */
+#define NPMX_BOOT_CHILD_IF(node_id, compat, fn)                                                    \
+	COND_CODE_1(DT_NODE_HAS_COMPAT(node_id, compat), (fn(node_id)), ())
+
+#define NPMX_BOOT_CHARGER(node_id)                                                                 \
+	{                                                                                          \
+		.charging_ma = DT_PROP_OR(node_id, charging_current_milliamp,                      \
+					  NPMX_BOOT_UNCHANGED),                                    \
+		.discharging_ma = DT_PROP_OR(node_id, discharging_current_milliamp,                \
+					     NPMX_BOOT_UNCHANGED),                                 \
+		.termination_mv = DT_PROP_OR(node_id, termination_voltage_millivolt,               \
+					     NPMX_BOOT_UNCHANGED),                                 \
+		.termination_warm_mv = DT_PROP_OR(node_id, termination_warm_voltage_millivolt,     \
+						  NPMX_BOOT_UNCHANGED),                            \
+		.vbus_limit_ma = DT_PROP_OR(node_id, vbus_current_limit_milliamp,                  \
+					    NPMX_BOOT_UNCHANGED),                                  \
+		.ntc_ohms = DT_PROP_OR(node_id, thermistor_ohms, NPMX_BOOT_UNCHANGED),             \
+		.ntc_beta = DT_PROP(node_id, thermistor_beta),                                     \
+		.modules = (DT_PROP(node_id, charging_enable) ?                                    \
+				    NPMX_CHARGER_MODULE_CHARGER_MASK : 0) |                        \
+			   (DT_PROP(node_id, recharge_enable) ?                                    \
+				    NPMX_CHARGER_MODULE_RECHARGE_MASK : 0) |                       \
+			   (DT_PROP(node_id, ntc_limits_enable) ?                                  \
+				    NPMX_CHARGER_MODULE_NTC_LIMITS_MASK : 0) |                     \
+			   (DT_PROP(node_id, full_cool_enable) ?                                   \
+				    NPMX_CHARGER_MODULE_FULL_COOL_MASK : 0),                       \
+	},
+
+#define NPMX_BOOT_BUCK(node_id)                                                                    \
+	{                                                                                          \
+		.index = DT_PROP(node_id, index),                                                  \
+		.mode = DT_ENUM_IDX_OR(node_id, mode, NPMX_BOOT_UNCHANGED),                        \
+		.state = DT_ENUM_IDX_OR(node_id, boot_state, NPMX_BOOT_UNCHANGED),                 \
+		.active_discharge = DT_PROP(node_id, active_discharge),                            \
+		.normal_mv = DT_PROP_OR(node_id, normal_voltage_millivolt, NPMX_BOOT_UNCHANGED),   \
+		.retention_mv = DT_PROP_OR(node_id, retention_voltage_millivolt,                   \
+					   NPMX_BOOT_UNCHANGED),                                   \
+	},
+
+#define NPMX_BOOT_LDSW(node_id)                                                                    \
+	{                                                                                          \
+		.index = DT_PROP(node_id, index),                                                  \
+		.mode = DT_ENUM_IDX_OR(node_id, mode, NPMX_BOOT_UNCHANGED),                        \
+		.state = DT_ENUM_IDX_OR(node_id, boot_state, NPMX_BOOT_UNCHANGED),                 \
+		.active_discharge = DT_PROP(node_id, active_discharge),                            \
+		.ldo_mv = DT_PROP_OR(node_id, ldo_voltage_millivolt, NPMX_BOOT_UNCHANGED),         \
+	},
+
+#define NPMX_BOOT_MODE(node_id)                                                                    \
+	{                                                                                          \
+		.index = DT_PROP(node_id, index),                                                  \
+		.mode = DT_ENUM_IDX(node_id, mode),                                                \
+	},
+
+#define NPMX_BOOT_CHARGER_IF(node_id)                                                              \
+	NPMX_BOOT_CHILD_IF(node_id, nordic_npmx_npm1300_charger, NPMX_BOOT_CHARGER)
+#define NPMX_BOOT_BUCK_IF(node_id)                                                                 \
+	NPMX_BOOT_CHILD_IF(node_id, nordic_npmx_npm1300_buck, NPMX_BOOT_BUCK)
+#define NPMX_BOOT_LDSW_IF(node_id)                                                                 \
+	NPMX_BOOT_CHILD_IF(node_id, nordic_npmx_npm1300_ldsw, NPMX_BOOT_LDSW)
+#define NPMX_BOOT_GPIO_IF(node_id)                                                                 \
+	NPMX_BOOT_CHILD_IF(node_id, nordic_npmx_npm1300_gpio, NPMX_BOOT_MODE)
+#define NPMX_BOOT_LED_IF(node_id)                                                                  \
+	NPMX_BOOT_CHILD_IF(node_id, nordic_npmx_npm1300_led, NPMX_BOOT_MODE)
+
+#if defined(CONFIG_NPMX_WARM_BOOT)
+#define NPMX_BOOT_RETAINED_DEFINE(inst)                                                            \
+	static __noinit struct npmx_boot_retained npmx_boot_retained_##inst;
+#define NPMX_BOOT_RETAINED_INIT(inst) .p_retained = &npmx_boot_retained_##inst,
+#else
+#define NPMX_BOOT_RETAINED_DEFINE(inst)
+#define NPMX_BOOT_RETAINED_INIT(inst)
+#endif
+
+/**
+ * @brief Macro for defining the boot configuration of an nPM devicetree instance.
+ *
+ * The tables are built at compile time from the enabled child nodes of the instance.
+ *
+ * @param inst Devicetree instance number of the nPM device.
+ */
+#define NPMX_BOOT_CONFIG_DEFINE(inst)                                                              \
+	NPMX_BOOT_RETAINED_DEFINE(inst)                                                            \
+	static const struct npmx_boot_charger npmx_boot_chargers_##inst[] = {                      \
+		DT_INST_FOREACH_CHILD_STATUS_OKAY(inst, NPMX_BOOT_CHARGER_IF)                      \
+	};                                                                                         \
+	static const struct npmx_boot_buck npmx_boot_bucks_##inst[] = {                            \
+		DT_INST_FOREACH_CHILD_STATUS_OKAY(inst, NPMX_BOOT_BUCK_IF)                         \
+	};                                                                                         \
+	static const struct npmx_boot_ldsw npmx_boot_ldsws_##inst[] = {                            \
+		DT_INST_FOREACH_CHILD_STATUS_OKAY(inst, NPMX_BOOT_LDSW_IF)                         \
+	};                                                                                         \
+	static const struct npmx_boot_mode npmx_boot_gpios_##inst[] = {                            \
+		DT_INST_FOREACH_CHILD_STATUS_OKAY(inst, NPMX_BOOT_GPIO_IF)                         \
+	};                                                                                         \
+	static const struct npmx_boot_mode npmx_boot_leds_##inst[] = {                             \
+		DT_INST_FOREACH_CHILD_STATUS_OKAY(inst, NPMX_BOOT_LED_IF)                          \
+	};                                                                                         \
+	static const struct npmx_boot_config npmx_boot_config_##inst = {                           \
+		.p_chargers = npmx_boot_chargers_##inst,                                           \
+		.p_bucks = npmx_boot_bucks_##inst,                                                 \
+		.p_ldsws = npmx_boot_ldsws_##inst,                                                 \
+		.p_gpios = npmx_boot_gpios_##inst,                                                 \
+		.p_leds = npmx_boot_leds_##inst,                                                   \
+		.charger_count = ARRAY_SIZE(npmx_boot_chargers_##inst),                            \
+		.buck_count = ARRAY_SIZE(npmx_boot_bucks_##inst),                                  \
+		.ldsw_count = ARRAY_SIZE(npmx_boot_ldsws_##inst),                                  \
+		.gpio_count = ARRAY_SIZE(npmx_boot_gpios_##inst),                                  \
+		.led_count = ARRAY_SIZE(npmx_boot_leds_##inst),                                    \
+		NPMX_BOOT_RETAINED_INIT(inst)                                                      \
+	};
+
+/**
+ * @brief Macro for getting the pointer to the boot configuration defined with
+ *        @ref NPMX_BOOT_CONFIG_DEFINE.
+ *
+ * @param inst Devicetree instance number of the nPM device.
+ */
+#define NPMX_BOOT_CONFIG_GET(inst) (&npmx_boot_config_##inst)
+
+#endif /* ZEPHYR_DRIVERS_NPMX_NPMX_BOOT_CONFIG_H__ */
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "npmx_cache.h"
+
+/** @brief Span of consecutive nPM registers holding configuration only. */
+struct npmx_cache_span {
+	uint16_t start; /* Address of the first register. */
+	uint8_t len; /* Number of registers. */
+};
+
+#define CACHE_SPAN(_start, _end)                                                                   \
+	{                                                                                          \
+		.start = (_start), .len = (_end) - (_start) + 1                                    \
+	},
+
+/* Registers that are changed by the host only. */
+static const struct npmx_cache_span cache_spans[] = { NPMX_CONFIG_SETTINGS_SPANS(CACHE_SPAN) };
+
+/**
+ * @brief Function for getting the cache index of the register.
+ *
+ * @param[in] register_address Register address.
+ *
+ * @return Cache index, or -1 if the register is not cacheable.
+ */
+static int cache_index_get(uint32_t register_address)
+{
+	int offset = 0;
+
+	for (size_t i = 0; i < ARRAY_SIZE(cache_spans); i++) {
+		const struct npmx_cache_span *span = &cache_spans[i];
+
+		if ((register_address >= span->start) &&
+		    (register_address < (span->start + span->len))) {
+			return offset + (int)(register_address - span->start);
+		}
+
+		offset += span->len;
+	}
+
+	return -1;
+}
+
+void npmx_cache_invalidate(struct npmx_cache *p_cache)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(p_cache->valid); i++) {
+		atomic_clear(&p_cache->valid[i]);
+	}
+}
+
+bool npmx_cache_read(struct npmx_cache *p_cache, uint32_t register_address, uint8_t *p_data,
+		     size_t num_of_bytes)
+{
+	for (size_t i = 0; i < num_of_bytes; i++) {
+		int index = cache_index_get(register_address + i);
+
+		if ((index < 0) || !atomic_test_bit(p_cache->valid, index)) {
+			return false;
+		}
+	}
+
+	for (size_t i = 0; i < num_of_bytes; i++) {
+		p_data[i] = p_cache->values[cache_index_get(register_address + i)];
+	}
+
+	return true;
+}
+
+void npmx_cache_update(struct npmx_cache *p_cache, uint32_t register_address,
+		       uint8_t const *p_data, size_t num_of_bytes)
+{
+	for (size_t i = 0; i < num_of_bytes; i++) {
+		int index = cache_index_get(register_address + i);
+
+		if (index < 0) {
+			continue;
+		}
+
+		__ASSERT_NO_MSG(index < NPMX_CACHE_SIZE);
+
+		p_cache->values[index] = p_data[i];
+		atomic_set_bit(p_cache->valid, index);
+	}
+}
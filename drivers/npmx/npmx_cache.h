@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef ZEPHYR_DRIVERS_NPMX_NPMX_CACHE_H__
+#define ZEPHYR_DRIVERS_NPMX_NPMX_CACHE_H__
+
+#include <npmx_config.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+
+/** @brief Number of nPM configuration register bytes that can be held in the cache. */
+#define NPMX_CACHE_SIZE NPMX_CONFIG_SETTINGS_SIZE
+
+/** @brief Register shadow cache. */
+struct npmx_cache {
+	uint8_t values[NPMX_CACHE_SIZE]; /* Cached register values. */
+	ATOMIC_DEFINE(valid, NPMX_CACHE_SIZE); /* Bitmap of cache entries holding a valid value. */
+};
+
+/**
+ * @brief Function for invalidating all cache entries.
+ *
+ * @param[in] p_cache Pointer to the cache.
+ */
+void npmx_cache_invalidate(struct npmx_cache *p_cache);
+
+/**
+ * @brief Function for reading registers from the cache.
+ *
+ * The read succeeds only if all requested registers are cacheable and hold a valid value.
+ *
+ * @param[in]  p_cache          Pointer to the cache.
+ * @param[in]  register_address Address of the first register.
+ * @param[out] p_data           Pointer to the buffer for the register values.
+ * @param[in]  num_of_bytes     Number of registers to be read.
+ *
+ * @retval true  All values have been read from the cache.
+ * @retval false At least one register has to be read from the device.
+ */
+bool npmx_cache_read(struct npmx_cache *p_cache, uint32_t register_address, uint8_t *p_data,
+		     size_t num_of_bytes);
+
+/**
+ * @brief Function for updating the cache with values read from or written to the device.
+ *
+ * Registers that are not cacheable are skipped.
+ *
+ * @param[in] p_cache          Pointer to the cache.
+ * @param[in] register_address Address of the first register.
+ * @param[in] p_data           Pointer to the register values.
+ * @param[in] num_of_bytes     Number of registers to be updated.
+ */
+void npmx_cache_update(struct npmx_cache *p_cache, uint32_t register_address,
+		       uint8_t const *p_data, size_t num_of_bytes);
+
+#endif /* ZEPHYR_DRIVERS_NPMX_NPMX_CACHE_H__ */
@@ -0,0 +1,260 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <npmx_charger.h>
+#include <npmx_core.h>
+#include <npmx_vbusin.h>
+#include "npmx_charger_state.h"
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(NPMX, CONFIG_NPMX_LOG_LEVEL);
+
+/* Time for the charger status to settle after a status event. */
+#define STATUS_SETTLE_TIME_MS 5
+
+/* Events changing the VBUS state. */
+#define VBUS_EVENTS_MASK                                                                           \
+	(NPMX_EVENT_GROUP_VBUSIN_DETECTED_MASK | NPMX_EVENT_GROUP_VBUSIN_REMOVED_MASK)
+
+/* Events changing the battery state. */
+#define BATTERY_EVENTS_MASK                                                                        \
+	(NPMX_EVENT_GROUP_BATTERY_DETECTED_MASK | NPMX_EVENT_GROUP_BATTERY_REMOVED_MASK)
+
+static const char *const phase_names[] = {
+	[NPMX_DRIVER_CHARGE_PHASE_IDLE] = "idle",
+	[NPMX_DRIVER_CHARGE_PHASE_TRICKLE] = "trickle",
+	[NPMX_DRIVER_CHARGE_PHASE_CC] = "CC",
+	[NPMX_DRIVER_CHARGE_PHASE_CV] = "CV",
+	[NPMX_DRIVER_CHARGE_PHASE_COMPLETED] = "completed",
+	[NPMX_DRIVER_CHARGE_PHASE_ERROR] = "error",
+};
+
+static void phase_set(struct npmx_charger_state *p_cs, enum npmx_driver_charge_phase phase,
+		      uint32_t timestamp)
+{
+	if (p_cs->state.phase != phase) {
+		LOG_DBG("%s: charging phase %s", p_cs->p_dev->name, phase_names[phase]);
+		p_cs->state.phase = phase;
+		p_cs->state.phase_timestamp = timestamp;
+	}
+}
+
+static void vbus_set(struct npmx_charger_state *p_cs, bool connected, uint32_t timestamp)
+{
+	k_spinlock_key_t key = k_spin_lock(&p_cs->lock);
+
+	if (p_cs->state.vbus_connected != connected) {
+		p_cs->state.vbus_connected = connected;
+		p_cs->state.vbus_timestamp = timestamp;
+	}
+
+	if (!connected) {
+		/* Charging stops without VBUS, errors are reported again after reconnection. */
+		phase_set(p_cs, NPMX_DRIVER_CHARGE_PHASE_IDLE, timestamp);
+	}
+
+	k_spin_unlock(&p_cs->lock, key);
+}
+
+static void battery_set(struct npmx_charger_state *p_cs, bool connected, uint32_t timestamp)
+{
+	k_spinlock_key_t key = k_spin_lock(&p_cs->lock);
+
+	if (p_cs->state.battery_connected != connected) {
+		p_cs->state.battery_connected = connected;
+		p_cs->state.battery_timestamp = timestamp;
+	}
+
+	k_spin_unlock(&p_cs->lock, key);
+}
+
+static void status_set(struct npmx_charger_state *p_cs, npmx_charger_status_mask_t status,
+		       bool error, uint32_t timestamp)
+{
+	k_spinlock_key_t key = k_spin_lock(&p_cs->lock);
+	enum npmx_driver_charge_phase phase;
+
+	if (status & NPMX_CHARGER_STATUS_COMPLETED_MASK) {
+		phase = NPMX_DRIVER_CHARGE_PHASE_COMPLETED;
+	} else if (status & NPMX_CHARGER_STATUS_CONSTANT_VOLTAGE_MASK) {
+		phase = NPMX_DRIVER_CHARGE_PHASE_CV;
+	} else if (status & NPMX_CHARGER_STATUS_CONSTANT_CURRENT_MASK) {
+		phase = NPMX_DRIVER_CHARGE_PHASE_CC;
+	} else if (status & NPMX_CHARGER_STATUS_TRICKLE_CHARGE_MASK) {
+		phase = NPMX_DRIVER_CHARGE_PHASE_TRICKLE;
+	} else if (error || (p_cs->state.phase == NPMX_DRIVER_CHARGE_PHASE_ERROR)) {
+		/* The error phase lasts until charging is restarted. */
+		phase = NPMX_DRIVER_CHARGE_PHASE_ERROR;
+	} else {
+		phase = NPMX_DRIVER_CHARGE_PHASE_IDLE;
+	}
+
+	p_cs->state.status = (uint8_t)status;
+	phase_set(p_cs, phase, timestamp);
+
+	k_spin_unlock(&p_cs->lock, key);
+
+	battery_set(p_cs, (status & NPMX_CHARGER_STATUS_BATTERY_DETECTED_MASK) != 0, timestamp);
+}
+
+static int vbus_read(struct npmx_charger_state *p_cs, uint32_t timestamp)
+{
+	npmx_instance_t *npmx_instance = npmx_driver_instance_get(p_cs->p_dev);
+	uint8_t vbus_status;
+
+	if (npmx_vbusin_vbus_status_get(npmx_vbusin_get(npmx_instance, 0), &vbus_status) !=
+	    NPMX_SUCCESS) {
+		return -EIO;
+	}
+
+	vbus_set(p_cs, (vbus_status & NPMX_VBUSIN_STATUS_CONNECTED_MASK) != 0, timestamp);
+
+	return 0;
+}
+
+static int status_read(struct npmx_charger_state *p_cs, bool error, uint32_t timestamp)
+{
+	npmx_instance_t *npmx_instance = npmx_driver_instance_get(p_cs->p_dev);
+	npmx_charger_status_mask_t status;
+
+	if (npmx_charger_status_get(npmx_charger_get(npmx_instance, 0), &status) != NPMX_SUCCESS) {
+		return -EIO;
+	}
+
+	status_set(p_cs, status, error, timestamp);
+
+	return 0;
+}
+
+static void vbus_handler(struct npmx_driver_event const *p_event, void *p_user_data)
+{
+	struct npmx_charger_state *p_cs = p_user_data;
+
+	if ((p_event->mask & VBUS_EVENTS_MASK) == VBUS_EVENTS_MASK) {
+		/* The order of the events is unknown, so the current status is read. */
+		(void)vbus_read(p_cs, p_event->timestamp);
+	} else {
+		vbus_set(p_cs, (p_event->mask & NPMX_EVENT_GROUP_VBUSIN_DETECTED_MASK) != 0,
+			 p_event->timestamp);
+	}
+}
+
+static void battery_handler(struct npmx_driver_event const *p_event, void *p_user_data)
+{
+	struct npmx_charger_state *p_cs = p_user_data;
+
+	if ((p_event->mask & BATTERY_EVENTS_MASK) == BATTERY_EVENTS_MASK) {
+		/* Battery detection is reported in the charger status. */
+		(void)status_read(p_cs, false, p_event->timestamp);
+	} else {
+		battery_set(p_cs, (p_event->mask & NPMX_EVENT_GROUP_BATTERY_DETECTED_MASK) != 0,
+			    p_event->timestamp);
+	}
+}
+
+static void status_work_cb(struct k_work *work)
+{
+	struct npmx_charger_state *p_cs = CONTAINER_OF(k_work_delayable_from_work(work),
+						       struct npmx_charger_state, status_work);
+	k_spinlock_key_t key = k_spin_lock(&p_cs->lock);
+	uint32_t timestamp = p_cs->status_timestamp;
+	bool error = p_cs->status_error;
+
+	p_cs->status_error = false;
+
+	k_spin_unlock(&p_cs->lock, key);
+
+	if (status_read(p_cs, error, timestamp) != 0) {
+		LOG_ERR("%s: failed to read charger status", p_cs->p_dev->name);
+	}
+}
+
+static void status_handler(struct npmx_driver_event const *p_event, void *p_user_data)
+{
+	struct npmx_charger_state *p_cs = p_user_data;
+	k_spinlock_key_t key = k_spin_lock(&p_cs->lock);
+
+	/* Events of a burst are read once, after the last of them. */
+	p_cs->status_timestamp = p_event->timestamp;
+	p_cs->status_error |= ((p_event->mask & NPMX_EVENT_GROUP_CHARGER_ERROR_MASK) != 0);
+
+	k_spin_unlock(&p_cs->lock, key);
+
+	/* The status is read later, so the event thread is not blocked while it settles. */
+	(void)k_work_reschedule(&p_cs->status_work, K_MSEC(STATUS_SETTLE_TIME_MS));
+}
+
+int npmx_charger_state_start(struct npmx_charger_state *p_cs, const struct device *p_dev)
+{
+	static const struct {
+		npmx_driver_event_handler_t handler;
+		npmx_callback_type_t type;
+		npmx_event_group_t group;
+		uint8_t mask;
+	} sources[NPMX_CHARGER_STATE_SOURCE_COUNT] = {
+		[NPMX_CHARGER_STATE_SOURCE_VBUS] = {
+			vbus_handler, NPMX_CALLBACK_TYPE_EVENT_VBUSIN_VOLTAGE,
+			NPMX_EVENT_GROUP_VBUSIN_VOLTAGE, VBUS_EVENTS_MASK,
+		},
+		[NPMX_CHARGER_STATE_SOURCE_BATTERY] = {
+			battery_handler, NPMX_CALLBACK_TYPE_EVENT_BAT_CHAR_BAT,
+			NPMX_EVENT_GROUP_BAT_CHAR_BAT, BATTERY_EVENTS_MASK,
+		},
+		[NPMX_CHARGER_STATE_SOURCE_STATUS] = {
+			status_handler, NPMX_CALLBACK_TYPE_EVENT_BAT_CHAR_STATUS,
+			NPMX_EVENT_GROUP_BAT_CHAR_STATUS,
+			NPMX_EVENT_GROUP_CHARGER_TRICKLE_MASK | NPMX_EVENT_GROUP_CHARGER_CC_MASK |
+				NPMX_EVENT_GROUP_CHARGER_CV_MASK |
+				NPMX_EVENT_GROUP_CHARGER_COMPLETED_MASK |
+				NPMX_EVENT_GROUP_CHARGER_ERROR_MASK,
+		},
+	};
+	npmx_instance_t *npmx_instance = npmx_driver_instance_get(p_dev);
+
+	p_cs->p_dev = p_dev;
+	p_cs->status_error = false;
+
+	k_work_init_delayable(&p_cs->status_work, status_work_cb);
+
+	for (size_t i = 0; i < ARRAY_SIZE(sources); i++) {
+		p_cs->subscribers[i] = (struct npmx_driver_event_subscriber){
+			.handler = sources[i].handler,
+			.p_user_data = p_cs,
+			.type = sources[i].type,
+			.mask = sources[i].mask,
+		};
+		(void)npmx_driver_event_subscribe(p_dev, &p_cs->subscribers[i]);
+
+		if (npmx_core_event_interrupt_enable(npmx_instance, sources[i].group,
+						     sources[i].mask) != NPMX_SUCCESS) {
+			return -EIO;
+		}
+	}
+
+	/* Subscribed first, so that changes after the read below are not missed. */
+	return npmx_charger_state_refresh(p_cs);
+}
+
+int npmx_charger_state_refresh(struct npmx_charger_state *p_cs)
+{
+	uint32_t timestamp = k_uptime_get_32();
+
+	if ((vbus_read(p_cs, timestamp) != 0) || (status_read(p_cs, false, timestamp) != 0)) {
+		return -EIO;
+	}
+
+	return 0;
+}
+
+void npmx_charger_state_get(struct npmx_charger_state *p_cs,
+			    struct npmx_driver_charger_state *p_state)
+{
+	k_spinlock_key_t key = k_spin_lock(&p_cs->lock);
+
+	*p_state = p_cs->state;
+
+	k_spin_unlock(&p_cs->lock, key);
+}
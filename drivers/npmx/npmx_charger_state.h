@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef ZEPHYR_DRIVERS_NPMX_NPMX_CHARGER_STATE_H__
+#define ZEPHYR_DRIVERS_NPMX_NPMX_CHARGER_STATE_H__
+
+#include <npmx_driver.h>
+
+#include <zephyr/device.h>
+#include <zephyr/kernel.h>
+#include <zephyr/spinlock.h>
+
+/** @brief Callback types of events tracked by the charger state tracker. */
+enum npmx_charger_state_source {
+	NPMX_CHARGER_STATE_SOURCE_VBUS, /* VBUSIN VOLTAGE events. */
+	NPMX_CHARGER_STATE_SOURCE_BATTERY, /* Battery detection events. */
+	NPMX_CHARGER_STATE_SOURCE_STATUS, /* Charger status events. */
+	NPMX_CHARGER_STATE_SOURCE_COUNT,
+};
+
+/** @brief Charger state tracker. All fields are private. */
+struct npmx_charger_state {
+	const struct device *p_dev; /* Pointer to the nPM Zephyr device. */
+	struct k_spinlock lock; /* Protects the state. */
+	struct npmx_driver_charger_state state;
+	struct npmx_driver_event_subscriber subscribers[NPMX_CHARGER_STATE_SOURCE_COUNT];
+	struct k_work_delayable status_work; /* Reads the status after it has settled. */
+	uint32_t status_timestamp; /* Uptime of the last status event, protected by the lock. */
+	bool status_error; /* Error event since the last status read, protected by the lock. */
+};
+
+/**
+ * @brief Function for reading the initial state, enabling the tracked events and subscribing.
+ *
+ * @param[in] p_cs  Pointer to the charger state tracker.
+ * @param[in] p_dev Pointer to the nPM Zephyr device.
+ *
+ * @retval 0    Tracking started.
+ * @retval -EIO Error using IO bus line.
+ */
+int npmx_charger_state_start(struct npmx_charger_state *p_cs, const struct device *p_dev);
+
+/**
+ * @brief Function for reading the state from the nPM device.
+ *
+ * @param[in] p_cs Pointer to the charger state tracker.
+ *
+ * @retval 0    State updated.
+ * @retval -EIO Error using IO bus line.
+ */
+int npmx_charger_state_refresh(struct npmx_charger_state *p_cs);
+
+/**
+ * @brief Function for copying the tracked state.
+ *
+ * @param[in]  p_cs    Pointer to the charger state tracker.
+ * @param[out] p_state Pointer to the structure for the state.
+ */
+void npmx_charger_state_get(struct npmx_charger_state *p_cs,
+			    struct npmx_driver_charger_state *p_state);
+
+#endif /* ZEPHYR_DRIVERS_NPMX_NPMX_CHARGER_STATE_H__ */
@@ -11,4 +11,96 @@
 #error "This file should not be included directly. Include npmx_config.h instead."
 #endif
 
+#include <zephyr/devicetree.h>
+#include <zephyr/sys/util.h>
+
+/** @brief LED driver is built in. */
+#define NPMX_CONFIG_LED_ENABLED IS_ENABLED(CONFIG_NPMX_LED)
+
+/** @brief Timer driver is built in. */
+#define NPMX_CONFIG_TIMER_ENABLED IS_ENABLED(CONFIG_NPMX_TIMER)
+
+/** @brief Ship mode driver is built in. */
+#define NPMX_CONFIG_SHIP_ENABLED IS_ENABLED(CONFIG_NPMX_SHIP)
+
+/* Helper for NPMX_CONFIG_PROP_USED. */
+#define NPMX_CONFIG_NODE_PROP_USED(node_id, prop) DT_NODE_HAS_PROP(node_id, prop) ||
+
+/**
+ * @brief Macro for checking if any enabled nPM1300 devicetree node has the given property.
+ *
+ * @param prop Lowercase-and-underscores property name.
+ */
+#define NPMX_CONFIG_PROP_USED(prop)                                                                \
+	(DT_FOREACH_STATUS_OKAY_VARGS(nordic_npmx_npm1300, NPMX_CONFIG_NODE_PROP_USED, prop) 0)
+
+/** @brief Host interrupt pin is wired on at least one nPM1300 device. */
+#define NPMX_CONFIG_HOST_INT_USED NPMX_CONFIG_PROP_USED(host_int_gpios)
+
+/** @brief Host power loss warning pin is wired on at least one nPM1300 device. */
+#define NPMX_CONFIG_HOST_POF_USED NPMX_CONFIG_PROP_USED(host_pof_gpios)
+
+/** @brief Address of the first MAIN peripheral event register. */
+#define NPMX_CONFIG_EVENT_REGS_ADDR 0x0000U
+
+/** @brief Size of the MAIN peripheral event and interrupt enable registers of all event groups. */
+#define NPMX_CONFIG_EVENT_REGS_SIZE 0x26U
+
+/** @brief Offset of the EVENTSADCSET register from the first MAIN peripheral event register. */
+#define NPMX_CONFIG_EVENTS_ADC_OFFSET 0x02U
+
+/**
+ * @brief Offsets of the EVENTS*SET registers of event groups, in npmx_event_group_t order.
+ *
+ * EVENTSADCSET, EVENTSBCHARGER0SET, EVENTSBCHARGER1SET, EVENTSBCHARGER2SET, EVENTSSHPHLDSET,
+ * EVENTSVBUSIN0SET, EVENTSVBUSIN1SET and EVENTSGPIOSET. The register at 0x01 is TASKSWRESET.
+ */
+#define NPMX_CONFIG_EVENT_GROUP_OFFSETS                                                            \
+	{ NPMX_CONFIG_EVENTS_ADC_OFFSET, 0x06, 0x0A, 0x0E, 0x12, 0x16, 0x1A, 0x22 }
+
+/** @brief Offset of the EVENTS*CLR register from the EVENTS*SET register of an event group. */
+#define NPMX_CONFIG_EVENT_GROUP_CLR_OFFSET 1U
+
+/** @brief Offset of the INTEN*SET register from the EVENTS*SET register of an event group. */
+#define NPMX_CONFIG_EVENT_GROUP_INTENSET_OFFSET 2U
+
+/** @brief Offset of the INTEN*CLR register from the EVENTS*SET register of an event group. */
+#define NPMX_CONFIG_EVENT_GROUP_INTENCLR_OFFSET 3U
+
+/** @brief Address of the EVENTSADCSET register. */
+#define NPMX_CONFIG_EVENTS_ADC_SET_ADDR                                                            \
+	(NPMX_CONFIG_EVENT_REGS_ADDR + NPMX_CONFIG_EVENTS_ADC_OFFSET)
+
+/** @brief Address of the EVENTSADCCLR register. */
+#define NPMX_CONFIG_EVENTS_ADC_CLR_ADDR                                                            \
+	(NPMX_CONFIG_EVENTS_ADC_SET_ADDR + NPMX_CONFIG_EVENT_GROUP_CLR_OFFSET)
+
+/** @brief Address of the INTENEVENTSADCSET register. */
+#define NPMX_CONFIG_INTEN_ADC_SET_ADDR                                                             \
+	(NPMX_CONFIG_EVENTS_ADC_SET_ADDR + NPMX_CONFIG_EVENT_GROUP_INTENSET_OFFSET)
+
+/**
+ * @brief Macro for expanding @p fn for each span of registers changed by the host only.
+ *
+ * Tasks, events, interrupt enable (SET/CLR pairs), status and measurement result registers are
+ * not included.
+ *
+ * @param fn Macro called with the addresses of the first and the last register of the span.
+ */
+#define NPMX_CONFIG_SETTINGS_SPANS(fn)                                                             \
+	fn(0x0201, 0x0201) /* VBUSIN: VBUSINILIM0. */                                              \
+	fn(0x0308, 0x031B) /* CHARGER: ISET, ISETDISCHARGE, VTERM, NTC and DIETEMP. */             \
+	fn(0x0408, 0x040F) /* BUCK: NORMVOUT, RETVOUT, ENCTRL, VRETCTRL, PWMCTRL, SWCTRL. */       \
+	fn(0x0415, 0x0415) /* BUCK: BUCKCTRL0. */                                                  \
+	fn(0x0509, 0x050B) /* ADC: ADCCONFIG, ADCNTCRSEL, ADCAUTOTIMCONF. */                       \
+	fn(0x0524, 0x0524) /* ADC: ADCIBATMEASEN. */                                               \
+	fn(0x0600, 0x061D) /* GPIOS: MODE, DRIVE, PUEN, PDEN, OPENDRAIN, DEBOUNCE. */              \
+	fn(0x0805, 0x0809) /* LDSW: GPISEL, LDSWCONFIG, LDOSEL. */                                 \
+	fn(0x080C, 0x080D) /* LDSW: VOUTSEL. */                                                    \
+	fn(0x0900, 0x0900) /* POF: POFCONFIG. */                                                   \
+	fn(0x0A00, 0x0A02) /* LEDDRV: MODESEL. */
+
+/** @brief Number of registers in all spans of @ref NPMX_CONFIG_SETTINGS_SPANS. */
+#define NPMX_CONFIG_SETTINGS_SIZE 75U
+
 #endif /* ZEPHYR_DRIVERS_NPMX_NPMX_CONFIG_NPM1300_H__ */
@@ -4,28 +4,322 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
+#include <npmx_config.h>
 #include <npmx_core.h>
 #include <npmx_driver.h>
 
+#if defined(CONFIG_NPMX_CACHE)
+#include "npmx_cache.h"
+#endif
+
+#if defined(CONFIG_NPMX_BOOT_CONFIG)
+#include "npmx_boot_config.h"
+#endif
+
+#if defined(CONFIG_NPMX_WATCHDOG)
+#include "npmx_watchdog.h"
+#endif
+
+#if defined(CONFIG_NPMX_EVENT_LOG)
+#include "npmx_event_log.h"
+#endif
+
+#if defined(CONFIG_NPMX_CHARGER_STATE)
+#include "npmx_charger_state.h"
+#endif
+
+#if defined(CONFIG_NPMX_DVFS)
+#include "npmx_dvfs.h"
+#endif
+
+#if defined(CONFIG_NPMX_VBUS_LIMIT)
+#include "npmx_vbus_limit.h"
+#endif
+
+#if defined(CONFIG_NPMX_LED_PATTERN)
+#include "npmx_led_pattern.h"
+#endif
+
+#if defined(CONFIG_NPMX_ADC_SAMPLER)
+#include "npmx_adc_sampler.h"
+#endif
+
+#if defined(CONFIG_NPMX_POWER_ACCOUNT)
+#include "npmx_power_account.h"
+#endif
+
+#if defined(CONFIG_NPMX_POF_ACTIONS) || defined(CONFIG_NPMX_SHIP)
+#include <npmx_buck.h>
+#include <npmx_ldsw.h>
+#endif
+
+#if defined(CONFIG_NPMX_SHIP)
+#include <npmx_ship.h>
+#endif
+
+#include <npmx_charger.h>
+#include <npmx_vbusin.h>
+
 #include <zephyr/types.h>
 #include <zephyr/drivers/gpio.h>
 #include <zephyr/drivers/i2c.h>
+#include <zephyr/pm/device.h>
 #include <zephyr/sys/byteorder.h>
 
+#if defined(CONFIG_NPMX_STATS) && defined(CONFIG_STATS)
+#include <zephyr/stats/stats.h>
+#endif
+
+#if defined(CONFIG_NPMX_TRACING)
+#include <zephyr/tracing/tracing.h>
+#endif
+
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(NPMX, CONFIG_NPMX_LOG_LEVEL);
 
 #define DT_DRV_COMPAT nordic_npmx_npm1300
 
+#if defined(CONFIG_NPMX_TRACING)
+/**
+ * @brief Macro for emitting a named event of the nPM device through the tracing backend.
+ *
+ * @param name Event name without the npmx_ prefix.
+ * @param dev  Pointer to the nPM Zephyr device, sent as the first event argument.
+ * @param arg  Second event argument.
+ */
+#define NPMX_TRACE(name, dev, arg)                                                                 \
+	sys_trace_named_event("npmx_" name, (uint32_t)(uintptr_t)(dev), (uint32_t)(arg))
+#else
+#define NPMX_TRACE(name, dev, arg)
+#endif
+
+#if defined(CONFIG_NPMX_BATCH)
+/** @brief Bus segment of a batched transaction. */
+struct npmx_batch_segment {
+	uint16_t register_address; /* Address of the first register. */
+	uint16_t offset; /* Offset of the segment data in the batch buffer. */
+	uint16_t len; /* Number of bytes. */
+	bool write; /* True for write access, false for read access. */
+};
+
+/** @brief Destination of data read in a batched transaction. */
+struct npmx_batch_read {
+	uint8_t *p_data; /* Pointer to the destination buffer. */
+	uint16_t offset; /* Offset of the data in the batch buffer. */
+	uint16_t len; /* Number of bytes. */
+};
+
+/** @brief Register accesses collected to be sent as a single I2C transfer. */
+struct npmx_batch {
+	atomic_ptr_t owner; /* Thread which opened the batch, NULL if no batch is open. */
+	struct k_sem free; /* Taken by the owner, so that other threads wait for the batch. */
+	size_t segment_count; /* Number of queued bus segments. */
+	struct npmx_batch_segment segments[CONFIG_NPMX_BATCH_MAX_SEGMENTS];
+	size_t read_count; /* Number of queued read destinations. */
+	struct npmx_batch_read reads[CONFIG_NPMX_BATCH_MAX_SEGMENTS];
+	size_t buf_used; /* Number of used bytes in the batch buffer. */
+	uint8_t buf[CONFIG_NPMX_BATCH_BUF_SIZE]; /* Data of all queued segments. */
+	uint8_t wr_addr[CONFIG_NPMX_BATCH_MAX_SEGMENTS][2]; /* Register addresses of segments. */
+	struct i2c_msg msgs[2 * CONFIG_NPMX_BATCH_MAX_SEGMENTS]; /* Messages of the transfer. */
+#if defined(CONFIG_NPMX_ASYNC)
+	npmx_driver_batch_cb_t cb; /* Completion handler of the submitted batch. */
+	void *p_user_data; /* User data passed to the completion handler. */
+#if defined(CONFIG_NPMX_STATS)
+	uint32_t start_cycles; /* Cycle counter value at the start of the submitted transfer. */
+	uint8_t num_msgs; /* Messages of the submitted transfer not counted in statistics yet. */
+#endif
+#endif
+#if defined(CONFIG_NPMX_POF_ACTIONS)
+	bool capture; /* Queued writes are only recorded and are never sent. */
+#endif
+#if defined(CONFIG_NPMX_WATCHDOG)
+	bool wdt_kick; /* Watchdog kick queued, reported when the batch is sent. */
+	uint32_t wdt_consumed; /* Check-in bits consumed by the queued watchdog kick. */
+#endif
+};
+#endif
+
+#if defined(CONFIG_NPMX_POF_ACTIONS)
+/** @brief Power-fail warning handling with prebuilt messages of emergency actions. */
+struct npmx_pof_actions {
+	struct k_thread thread; /* Thread executing the actions. */
+	K_KERNEL_STACK_MEMBER(stack, CONFIG_NPMX_POF_ACTIONS_STACK_SIZE);
+	struct k_sem sem; /* Given by the POF host interrupt. */
+	struct npmx_driver_pof_action const *p_actions; /* Actions set by the application. */
+	size_t count; /* Number of actions, written last when the actions are set. */
+	uint8_t first_segment[CONFIG_NPMX_POF_ACTIONS_MAX]; /* First segment of each action. */
+	uint8_t segment_count[CONFIG_NPMX_POF_ACTIONS_MAX]; /* Number of segments of each action. */
+	size_t segments_used; /* Number of built segments of all actions. */
+	size_t buf_used; /* Number of used bytes in the data buffer. */
+	uint8_t wr_addr[CONFIG_NPMX_BATCH_MAX_SEGMENTS][2]; /* Register addresses of segments. */
+	uint8_t buf[CONFIG_NPMX_BATCH_BUF_SIZE]; /* Data written by all segments. */
+	struct i2c_msg msgs[CONFIG_NPMX_BATCH_MAX_SEGMENTS][2]; /* Messages of each segment. */
+	uint32_t int_cycles; /* Cycle counter value captured in the POF host interrupt. */
+	struct k_spinlock latency_lock;
+	struct npmx_driver_latency latency;
+};
+#endif
+
+#if defined(CONFIG_NPMX_STATS)
+/** @brief Bus usage statistics, with durations in cycle counter ticks. */
+struct npmx_bus_stats {
+	uint32_t transfers;
+	uint32_t errors;
+	uint32_t min_cycles;
+	uint32_t max_cycles;
+	uint64_t total_cycles;
+	uint32_t saved_reads;
+	uint32_t untracked;
+	struct npmx_driver_bus_counters total;
+	struct npmx_driver_bus_counters peripherals[NPMX_DRIVER_BUS_STATS_PERIPHERALS];
+	size_t register_count; /* Number of used entries of the register table. */
+	struct npmx_driver_bus_register_stats registers[CONFIG_NPMX_STATS_REGISTERS];
+};
+
+#if defined(CONFIG_STATS)
+/* Totals registered in the Zephyr statistics subsystem. */
+STATS_SECT_START(npmx)
+STATS_SECT_ENTRY32(transfers)
+STATS_SECT_ENTRY32(errors)
+STATS_SECT_ENTRY32(bytes_read)
+STATS_SECT_ENTRY32(bytes_written)
+STATS_SECT_END;
+
+STATS_NAME_START(npmx)
+STATS_NAME(npmx, transfers)
+STATS_NAME(npmx, errors)
+STATS_NAME(npmx, bytes_read)
+STATS_NAME(npmx, bytes_written)
+STATS_NAME_END(npmx);
+#endif
+#endif
+
+/* Interval of reading ADC events when the host interrupt is not used. */
+#define ADC_POLL_INTERVAL_MS 1
+
+#define SETTINGS_SPAN(_start, _end)                                                                \
+	{                                                                                          \
+		.register_address = (_start), .len = (_end) - (_start) + 1                         \
+	},
+
+/* Registers included in the configuration snapshot, in the snapshot order. */
+static const struct npmx_driver_config_span config_spans[] = {
+	NPMX_CONFIG_SETTINGS_SPANS(SETTINGS_SPAN)
+};
+
+#if defined(CONFIG_NPMX_INT_SELECTIVE_SCAN) || defined(CONFIG_NPMX_TRACING)
+/* Offsets of the EVENTS*SET registers of event groups, in npmx_event_group_t order. */
+static const uint8_t event_group_offsets[] = NPMX_CONFIG_EVENT_GROUP_OFFSETS;
+
+BUILD_ASSERT(ARRAY_SIZE(event_group_offsets) == NPMX_EVENT_GROUP_COUNT);
+#endif
+
+#if defined(CONFIG_NPMX_INT_COALESCE)
+/** @brief Event registers read in a single burst at the start of event processing. */
+struct npmx_event_snapshot {
+	uint8_t values[NPMX_CONFIG_EVENT_REGS_SIZE];
+	uint64_t valid; /* Bit mask of values not consumed yet. */
+};
+#endif
+
 struct npmx_data {
 	const struct device *dev;
 	npmx_instance_t npmx_instance;
 	npmx_backend_t backend;
+#if defined(CONFIG_NPMX_WORKQUEUE)
+	/* Each device has its own event thread, so a stalled bus delays only its own events. */
+	struct k_work_q work_q;
+	K_KERNEL_STACK_MEMBER(work_q_stack, CONFIG_NPMX_WORKQUEUE_STACK_SIZE);
+#endif
+#if defined(CONFIG_NPMX_INT_COALESCE)
+	struct k_work_delayable work;
+	struct npmx_event_snapshot snapshot;
+#else
 	struct k_work work;
+#endif
+#if defined(CONFIG_NPMX_INT_LATENCY)
+	uint32_t int_cycles; /* Cycle counter value captured in the host interrupt. */
+	struct k_spinlock latency_lock;
+	struct npmx_driver_latency latency;
+#endif
+#if defined(CONFIG_NPMX_INT_SELECTIVE_SCAN)
+	atomic_t int_enabled[NPMX_EVENT_GROUP_COUNT]; /* Enabled interrupts of event groups. */
+#endif
+	k_tid_t proc_thread; /* Thread processing events, NULL if no processing is ongoing. */
+	struct k_mutex lock; /* Serializes register accesses, and groups of them. */
+	struct k_mutex adc_lock; /* Serializes waiting for ADC measurements. */
+	struct k_sem adc_sem; /* Given when ADC events are cleared. */
+	atomic_t adc_events; /* ADC events cleared since the start of the wait. */
+	npmx_driver_adc_handler_t adc_handler; /* Handler of ADC events. */
+	void *p_adc_handler_data; /* User data passed to the ADC events handler. */
+	struct k_mutex delivery_lock; /* Serializes event delivery. */
+	struct k_mutex subscribers_lock; /* Protects the subscriber list and the delivery state. */
+	struct k_condvar handler_done; /* Signaled when a subscriber handler returns. */
+	sys_slist_t subscribers; /* Event subscribers. */
+	struct npmx_driver_event_subscriber *p_handled; /* Subscriber with the handler running. */
+	sys_snode_t *p_delivery_next; /* Next subscriber checked by the ongoing delivery. */
+	k_tid_t delivery_thread; /* Thread of the ongoing delivery. */
 	struct gpio_callback gpio_cb;
 	struct gpio_callback pof_gpio_cb;
 	struct k_work pof_work;
 	void (*pof_cb)(npmx_instance_t *p_pm);
+#if defined(CONFIG_NPMX_CACHE)
+	struct npmx_cache cache;
+#endif
+#if defined(CONFIG_NPMX_BATCH)
+	struct npmx_batch batch;
+#endif
+#if defined(CONFIG_NPMX_WARM_BOOT)
+	bool warm_boot; /* Boot configuration found already applied at init. */
+#endif
+#if defined(CONFIG_NPMX_POF_ACTIONS)
+	struct npmx_pof_actions pof;
+#endif
+#if defined(CONFIG_NPMX_WATCHDOG)
+	struct npmx_watchdog watchdog;
+#endif
+#if defined(CONFIG_NPMX_EVENT_LOG)
+	struct npmx_event_log event_log;
+#endif
+#if defined(CONFIG_NPMX_CHARGER_STATE)
+	struct npmx_charger_state charger_state;
+#endif
+#if defined(CONFIG_NPMX_DVFS)
+	struct npmx_dvfs dvfs;
+#endif
+#if defined(CONFIG_NPMX_VBUS_LIMIT)
+	struct npmx_vbus_limit vbus_limit;
+#endif
+#if defined(CONFIG_NPMX_LED_PATTERN)
+	struct npmx_led_pattern led_pattern;
+#endif
+#if defined(CONFIG_NPMX_ADC_SAMPLER)
+	struct k_spinlock samplers_lock;
+	sys_slist_t samplers; /* ADC samplers paused while the device is suspended. */
+#endif
+#if defined(CONFIG_NPMX_POWER_ACCOUNT)
+	struct npmx_power_account power_account;
+#endif
+#if defined(CONFIG_PM_DEVICE)
+	atomic_t int_masked; /* Host interrupt is kept disabled until the device is resumed. */
+	npmx_adc_config_t adc_config; /* ADC configuration restored on resume. */
+#endif
+#if defined(CONFIG_NPMX_BUS_RETRY)
+	struct k_spinlock recovery_lock;
+	struct npmx_driver_bus_recovery_stats recovery;
+	bool proc_failed; /* Set when a transfer of the event processing pass fails. */
+	struct k_work_delayable resync_work; /* Processes events again after failed processing. */
+#if defined(CONFIG_PM_DEVICE)
+	bool resync_paused; /* Resynchronization cancelled on suspend, scheduled again on resume. */
+#endif
+#endif
+#if defined(CONFIG_NPMX_STATS)
+	struct k_spinlock stats_lock;
+	struct npmx_bus_stats stats;
+#if defined(CONFIG_STATS)
+	STATS_SECT_DECL(npmx) stats_group;
+#endif
+#endif
 };
 
 struct npmx_config {
@@ -35,6 +329,13 @@ struct npmx_config {
 	const struct gpio_dt_spec host_pof_gpio;
 	const int pmic_pof_pin;
 	const int pmic_reset_pin;
+	const struct gpio_dt_spec host_retention_gpio;
+#if defined(CONFIG_NPMX_BOOT_CONFIG)
+	const struct npmx_boot_config *boot_config;
+#endif
+#if defined(CONFIG_NPMX_VBUS_LIMIT)
+	const struct npmx_vbus_limit_config *p_vbus_limit; /* VBUS current limits, or NULL. */
+#endif
 };
 
 static void pof_gpio_callback(const struct device *gpio_dev, struct gpio_callback *cb,
@@ -48,9 +349,15 @@ static void pof_gpio_callback(const struct device *gpio_dev, struct gpio_callbac
 	gpio_pin_interrupt_configure_dt(&config->host_pof_gpio, GPIO_INT_DISABLE);
 	gpio_pin_interrupt_configure_dt(&config->host_int_gpio, GPIO_INT_DISABLE);
 
+#if defined(CONFIG_NPMX_POF_ACTIONS)
+	/* Wake up the POF thread, which executes the callback and the emergency actions. */
+	data->pof.int_cycles = k_cycle_get_32();
+	k_sem_give(&data->pof.sem);
+#else
 	if (data->pof_cb) {
 		data->pof_cb(&data->npmx_instance);
 	}
+#endif
 }
 
 static int pof_gpio_interrupt_init(const struct device *dev, gpio_flags_t pof_gpio_flags)
@@ -88,6 +395,24 @@ static int pof_gpio_interrupt_init(const struct device *dev, gpio_flags_t pof_gp
 	return err;
 }
 
+static int events_work_submit(struct npmx_data *data)
+{
+#if defined(CONFIG_NPMX_INT_COALESCE)
+	/* Let further events of a burst accumulate and process them all at once. */
+	k_timeout_t holdoff = K_USEC(CONFIG_NPMX_INT_COALESCE_HOLDOFF_US);
+
+#if defined(CONFIG_NPMX_WORKQUEUE)
+	return k_work_schedule_for_queue(&data->work_q, &data->work, holdoff);
+#else
+	return k_work_schedule(&data->work, holdoff);
+#endif
+#elif defined(CONFIG_NPMX_WORKQUEUE)
+	return k_work_submit_to_queue(&data->work_q, &data->work);
+#else
+	return k_work_submit(&data->work);
+#endif
+}
+
 /* Callback for active sense pin from npmx device. */
 static void int_gpio_callback(const struct device *gpio_dev, struct gpio_callback *cb,
 			      uint32_t pins)
@@ -96,23 +421,149 @@ static void int_gpio_callback(const struct device *gpio_dev, struct gpio_callbac
 	const struct device *npmx_dev = data->dev;
 	const struct npmx_config *config = npmx_dev->config;
 
+	int err;
+
+	NPMX_TRACE("int", npmx_dev, pins);
+
 	gpio_pin_interrupt_configure_dt(&config->host_int_gpio, GPIO_INT_DISABLE);
-	k_work_submit(&data->work);
+
+#if defined(CONFIG_NPMX_INT_LATENCY)
+	data->int_cycles = k_cycle_get_32();
+#endif
+
+	err = events_work_submit(data);
+
+	/* Result 0 means the work item is already queued, so the events of this interrupt wait
+	 * for the pending processing to complete.
+	 */
+	NPMX_TRACE("work_submit", npmx_dev, err);
+	ARG_UNUSED(err);
+}
+
+#if defined(CONFIG_NPMX_INT_LATENCY)
+static void latency_update(struct npmx_data *data)
+{
+	uint32_t latency_us = k_cyc_to_us_floor32(k_cycle_get_32() - data->int_cycles);
+	k_spinlock_key_t key = k_spin_lock(&data->latency_lock);
+
+	data->latency.last_us = latency_us;
+	data->latency.max_us = MAX(data->latency.max_us, latency_us);
+	data->latency.count++;
+
+	k_spin_unlock(&data->latency_lock, key);
+}
+#endif
+
+#if defined(CONFIG_NPMX_INT_COALESCE)
+static npmx_error_t twi_read_function(void *p_context, uint32_t register_address, uint8_t *p_data,
+				      size_t num_of_bytes);
+
+static void events_proc(const struct device *dev)
+{
+	struct npmx_data *data = dev->data;
+	struct npmx_event_snapshot *snapshot = &data->snapshot;
+
+	/* Read events of all groups in a single transfer. Events of each group are still cleared
+	 * right before its callback is called, so that they are not cleared after a new event
+	 * requested by a waiter has been raised.
+	 */
+	if (twi_read_function((void *)dev, NPMX_CONFIG_EVENT_REGS_ADDR, snapshot->values,
+			      NPMX_CONFIG_EVENT_REGS_SIZE) == NPMX_SUCCESS) {
+		snapshot->valid = BIT64_MASK(NPMX_CONFIG_EVENT_REGS_SIZE);
+	}
+
+	npmx_core_proc(&data->npmx_instance);
+
+	snapshot->valid = 0;
+}
+#endif
+
+#if defined(CONFIG_NPMX_BUS_RETRY)
+static void resync_work_cb(struct k_work *work)
+{
+	struct npmx_data *data =
+		CONTAINER_OF(k_work_delayable_from_work(work), struct npmx_data, resync_work);
+
+	/* Processed as if the host interrupt fired. */
+	(void)events_work_submit(data);
+}
+
+static void resync_schedule(struct npmx_data *data)
+{
+	k_spinlock_key_t key = k_spin_lock(&data->recovery_lock);
+
+	data->recovery.resyncs++;
+
+	k_spin_unlock(&data->recovery_lock, key);
+
+	LOG_WRN("%s: event processing failed, resynchronizing in %u ms", data->dev->name,
+		CONFIG_NPMX_BUS_RESYNC_DELAY_MS);
+
+	(void)k_work_schedule(&data->resync_work, K_MSEC(CONFIG_NPMX_BUS_RESYNC_DELAY_MS));
 }
+#endif
 
 static void work_cb(struct k_work *work)
 {
+#if defined(CONFIG_NPMX_INT_COALESCE)
+	struct npmx_data *data =
+		CONTAINER_OF(k_work_delayable_from_work(work), struct npmx_data, work);
+#else
 	struct npmx_data *data = CONTAINER_OF(work, struct npmx_data, work);
+#endif
 	const struct device *npmx_dev = data->dev;
 	const struct npmx_config *config = npmx_dev->config;
 
 	npmx_instance_t *npmx_instance = &data->npmx_instance;
 
+	NPMX_TRACE("work_start", npmx_dev, 0);
+
+#if defined(CONFIG_NPMX_INT_LATENCY)
+	latency_update(data);
+#endif
+
+	data->proc_thread = k_current_get();
+
+#if defined(CONFIG_NPMX_BUS_RETRY)
+	data->proc_failed = false;
+#endif
+
 	npmx_core_interrupt(npmx_instance);
 
+	NPMX_TRACE("interrupt_done", npmx_dev, 0);
+
+#if defined(CONFIG_NPMX_INT_COALESCE)
+	events_proc(npmx_dev);
+#else
 	npmx_core_proc(npmx_instance);
+#endif
+
+	NPMX_TRACE("proc_done", npmx_dev, 0);
 
-	gpio_pin_interrupt_configure_dt(&config->host_int_gpio, GPIO_INT_LEVEL_HIGH);
+	data->proc_thread = NULL;
+
+#if defined(CONFIG_PM_DEVICE)
+	if (atomic_get(&data->int_masked)) {
+		/* Remaining events are processed when the device is resumed. */
+		return;
+	}
+#endif
+
+#if defined(CONFIG_NPMX_BUS_RETRY)
+	if (data->proc_failed) {
+		/* Events could not be read or cleared, so they can still be latched. Re-arming the
+		 * level interrupt would fire it again at once, so it is kept disabled and all events
+		 * are read again after the delay.
+		 */
+		resync_schedule(data);
+		return;
+	}
+#endif
+
+	int err = gpio_pin_interrupt_configure_dt(&config->host_int_gpio, GPIO_INT_LEVEL_HIGH);
+
+	NPMX_TRACE("rearm", npmx_dev, err);
+	ARG_UNUSED(err);
 }
 
 static int int_gpio_interrupt_init(const struct device *dev)
@@ -134,7 +585,25 @@ static int int_gpio_interrupt_init(const struct device *dev)
 		return -ENODEV;
 	}
 
+#if defined(CONFIG_NPMX_WORKQUEUE)
+	const struct k_work_queue_config work_q_config = {
+		.name = dev->name,
+	};
+
+	k_work_queue_start(&data->work_q, data->work_q_stack,
+			   K_KERNEL_STACK_SIZEOF(data->work_q_stack), CONFIG_NPMX_WORKQUEUE_PRIORITY,
+			   &work_q_config);
+#endif
+
+#if defined(CONFIG_NPMX_INT_COALESCE)
+	k_work_init_delayable(&data->work, work_cb);
+#else
 	k_work_init(&data->work, work_cb);
+#endif
+
+#if defined(CONFIG_NPMX_BUS_RETRY)
+	k_work_init_delayable(&data->resync_work, resync_work_cb);
+#endif
 
 	err = gpio_pin_configure_dt(&config->host_int_gpio, GPIO_INPUT);
 	if (err != 0) {
@@ -158,133 +627,2424 @@ static int int_gpio_interrupt_init(const struct device *dev)
 	return err;
 }
 
+static void events_deliver(struct npmx_data *data, npmx_callback_type_t type, uint8_t mask)
+{
+	struct npmx_driver_event event = {
+		.p_dev = data->dev,
+		.type = type,
+		.mask = mask,
+		.timestamp = k_uptime_get_32(),
+	};
+	sys_snode_t *p_node;
+
+	k_mutex_lock(&data->delivery_lock, K_FOREVER);
+	k_mutex_lock(&data->subscribers_lock, K_FOREVER);
+
+	data->delivery_thread = k_current_get();
+
+	/* Handlers are called with the subscriber list unlocked, as they can access the nPM device
+	 * and change subscriptions. The next subscriber is moved on if it is removed meanwhile.
+	 */
+	for (p_node = sys_slist_peek_head(&data->subscribers); p_node != NULL;
+	     p_node = data->p_delivery_next) {
+		struct npmx_driver_event_subscriber *p_subscriber =
+			CONTAINER_OF(p_node, struct npmx_driver_event_subscriber, node);
+
+		data->p_delivery_next = sys_slist_peek_next(p_node);
+
+		if ((p_subscriber->type != type) || ((p_subscriber->mask & mask) == 0)) {
+			continue;
+		}
+
+		data->p_handled = p_subscriber;
+		k_mutex_unlock(&data->subscribers_lock);
+
+		p_subscriber->handler(&event, p_subscriber->p_user_data);
+
+		k_mutex_lock(&data->subscribers_lock, K_FOREVER);
+		data->p_handled = NULL;
+		k_condvar_broadcast(&data->handler_done);
+	}
+
+	data->delivery_thread = NULL;
+
+	k_mutex_unlock(&data->subscribers_lock);
+	k_mutex_unlock(&data->delivery_lock);
+}
+
 static void generic_callback(npmx_instance_t *pm, npmx_callback_type_t type, uint8_t mask)
 {
+	struct npmx_data *data = CONTAINER_OF(pm, struct npmx_data, npmx_instance);
+
+#if defined(CONFIG_NPMX_TRACING)
+	NPMX_TRACE("generic_cb", data->dev, ((uint32_t)type << 8) | mask);
+#endif
+
+#if defined(CONFIG_NPMX_VBUS_LIMIT)
+	/* First, so that the current limit is not delayed by logging and subscribers. */
+	npmx_vbus_limit_event(&data->vbus_limit, type, mask);
+#endif
+
+#if defined(CONFIG_NPMX_EVENT_LOG)
+	npmx_event_log_add(&data->event_log, type, mask);
+#endif
+
 	LOG_DBG("%s:", npmx_callback_to_str(type));
 	for (uint8_t i = 0; i < 8; i++) {
 		if (BIT(i) & mask) {
 			LOG_DBG("\t%s", npmx_callback_bit_to_str(type, i));
 		}
 	}
+
+	events_deliver(data, type, mask);
 }
 
-static npmx_error_t twi_write_function(void *p_context, uint32_t register_address, uint8_t *p_data,
-				       size_t num_of_bytes)
+#if defined(CONFIG_NPMX_STATS)
+static void bus_stats_clear(struct npmx_bus_stats *stats)
 {
-	struct i2c_dt_spec *i2c = (struct i2c_dt_spec *)p_context;
-	uint8_t wr_addr[2];
-	struct i2c_msg msgs[2];
+	memset(stats, 0, sizeof(*stats));
+	stats->min_cycles = UINT32_MAX;
+}
 
-	/* npmx register address. */
-	sys_put_be16((uint16_t)register_address, wr_addr);
+static void bus_counters_update(struct npmx_driver_bus_counters *counters, bool read, size_t len,
+				bool failed)
+{
+	if (read) {
+		counters->reads++;
+	} else {
+		counters->writes++;
+	}
 
-	/* Setup I2C messages. */
+	counters->bytes += len;
 
-	/* Send the address to write to. */
-	msgs[0].buf = wr_addr;
-	msgs[0].len = 2U;
-	msgs[0].flags = I2C_MSG_WRITE;
+	if (failed) {
+		counters->errors++;
+	}
+}
 
-	/* Data to be written. STOP after that. */
-	msgs[1].buf = p_data;
-	msgs[1].len = num_of_bytes;
-	msgs[1].flags = I2C_MSG_WRITE | I2C_MSG_STOP;
+static struct npmx_driver_bus_counters *bus_register_counters_get(struct npmx_bus_stats *stats,
+								  uint16_t register_address)
+{
+	for (size_t i = 0; i < stats->register_count; i++) {
+		if (stats->registers[i].register_address == register_address) {
+			return &stats->registers[i].counters;
+		}
+	}
 
-	return i2c_transfer(i2c->bus, msgs, 2, i2c->addr) == 0 ? NPMX_SUCCESS : NPMX_ERROR_IO;
+	if (stats->register_count == ARRAY_SIZE(stats->registers)) {
+		return NULL;
+	}
+
+	stats->registers[stats->register_count].register_address = register_address;
+
+	return &stats->registers[stats->register_count++].counters;
 }
+#endif
 
-static npmx_error_t twi_read_function(void *p_context, uint32_t register_address, uint8_t *p_data,
-				      size_t num_of_bytes)
+/**
+ * @brief Function for counting the completed I2C transfer in the bus usage statistics.
+ *
+ * @param[in] dev          Pointer to the nPM Zephyr device.
+ * @param[in] msgs         Messages of the transfer, pairs of the register address and the data.
+ * @param[in] num_msgs     Number of messages.
+ * @param[in] start_cycles Cycle counter value at the start of the transfer.
+ * @param[in] err          Result of the I2C transfer.
+ */
+static void bus_stats_update(const struct device *dev, struct i2c_msg const *msgs,
+			     uint8_t num_msgs, uint32_t start_cycles, int err)
 {
-	struct i2c_dt_spec *i2c = (struct i2c_dt_spec *)p_context;
-	uint8_t wr_addr[2];
-	struct i2c_msg msgs[2];
+#if defined(CONFIG_NPMX_STATS)
+	struct npmx_data *data = dev->data;
+	struct npmx_bus_stats *stats = &data->stats;
+	uint32_t cycles = k_cycle_get_32() - start_cycles;
+	size_t bytes_read = 0;
+	size_t bytes_written = 0;
+	k_spinlock_key_t key = k_spin_lock(&data->stats_lock);
 
-	/* npmx register address. */
-	sys_put_be16((uint16_t)register_address, wr_addr);
+	stats->transfers++;
+	stats->total_cycles += cycles;
+	stats->min_cycles = MIN(stats->min_cycles, cycles);
+	stats->max_cycles = MAX(stats->max_cycles, cycles);
 
-	/* Setup I2C messages. */
+	if (err != 0) {
+		stats->errors++;
+	}
 
-	/* Send the address to read from. */
-	msgs[0].buf = wr_addr;
-	msgs[0].len = 2U;
-	msgs[0].flags = I2C_MSG_WRITE;
+	for (uint8_t i = 0; (i + 1) < num_msgs; i += 2) {
+		uint16_t register_address = sys_get_be16(msgs[i].buf);
+		bool read = (msgs[i + 1].flags & I2C_MSG_READ) != 0;
+		size_t len = msgs[i + 1].len;
+		size_t peripheral =
+			MIN(register_address >> 8, NPMX_DRIVER_BUS_STATS_PERIPHERALS - 1);
+		struct npmx_driver_bus_counters *counters =
+			bus_register_counters_get(stats, register_address);
+
+		bus_counters_update(&stats->total, read, len, err != 0);
+		bus_counters_update(&stats->peripherals[peripheral], read, len, err != 0);
+
+		if (counters != NULL) {
+			bus_counters_update(counters, read, len, err != 0);
+		} else {
+			stats->untracked++;
+		}
 
-	/* Read from device. STOP after that. */
-	msgs[1].buf = p_data;
-	msgs[1].len = num_of_bytes;
-	msgs[1].flags = I2C_MSG_READ | I2C_MSG_STOP;
+		if (read) {
+			bytes_read += len;
+		} else {
+			bytes_written += len;
+		}
+	}
+
+	k_spin_unlock(&data->stats_lock, key);
 
-	return i2c_transfer(i2c->bus, msgs, 2, i2c->addr) == 0 ? NPMX_SUCCESS : NPMX_ERROR_IO;
+#if defined(CONFIG_STATS)
+	STATS_INC(data->stats_group, transfers);
+	if (err != 0) {
+		STATS_INC(data->stats_group, errors);
+	}
+	STATS_INCN(data->stats_group, bytes_read, bytes_read);
+	STATS_INCN(data->stats_group, bytes_written, bytes_written);
+#endif
+#else
+	ARG_UNUSED(dev);
+	ARG_UNUSED(msgs);
+	ARG_UNUSED(num_msgs);
+	ARG_UNUSED(start_cycles);
+	ARG_UNUSED(err);
+#endif
 }
 
-static int npmx_driver_init(const struct device *dev)
+/* Counts the register read served from RAM instead of the bus. */
+static void bus_stats_saved_read(const struct device *dev)
 {
+#if defined(CONFIG_NPMX_STATS)
 	struct npmx_data *data = dev->data;
-	const struct npmx_config *config = dev->config;
-	const struct device *bus = config->i2c.bus;
-	npmx_instance_t *npmx_instance = &data->npmx_instance;
-	npmx_backend_t *backend = &data->backend;
-
-	data->dev = dev;
+	k_spinlock_key_t key = k_spin_lock(&data->stats_lock);
 
-	backend->p_write = twi_write_function;
-	backend->p_read = twi_read_function;
-	backend->p_context = (void *)&config->i2c;
-
-	data->npmx_instance.generic_cb = generic_callback;
+	data->stats.saved_reads++;
 
-#if defined(CONFIG_NPMX_RESTORE_VALUES)
-	npmx_error_t ret = npmx_core_init(npmx_instance, backend, generic_callback, true);
+	k_spin_unlock(&data->stats_lock, key);
 #else
-	npmx_error_t ret = npmx_core_init(npmx_instance, backend, generic_callback, false);
+	ARG_UNUSED(dev);
 #endif
+}
 
-	if (!device_is_ready(bus)) {
-		LOG_ERR("%s: bus device %s is not ready", dev->name, bus->name);
-		return -ENODEV;
-	}
+static int bus_transfer_once(const struct device *dev, struct i2c_msg *msgs, uint8_t num_msgs)
+{
+	const struct npmx_config *config = dev->config;
+	uint32_t start_cycles = IS_ENABLED(CONFIG_NPMX_STATS) ? k_cycle_get_32() : 0;
+	int err = i2c_transfer(config->i2c.bus, msgs, num_msgs, config->i2c.addr);
 
-	if (ret != NPMX_SUCCESS) {
-		LOG_ERR("Unable to init npmx device");
+	bus_stats_update(dev, msgs, num_msgs, start_cycles, err);
+
+	return err;
+}
+
+#if defined(CONFIG_NPMX_BUS_RETRY)
+/**
+ * @brief Function for retrying the failed I2C transfer with exponential backoff.
+ *
+ * The transfer is repeated as a whole. Its writes set register values, trigger tasks or clear
+ * events, so repeating them has the same effect as a single successful transfer.
+ *
+ * The instance lock is released for the backoff and bus recovery, if the calling thread holds it
+ * only for the failed access. A lock held across several accesses, by a group or a batch, is kept
+ * so that they stay atomic, and the transfer is retried at once without recovering the bus.
+ *
+ * @param[in] dev      Pointer to the nPM Zephyr device.
+ * @param[in] msgs     Messages of the failed transfer.
+ * @param[in] num_msgs Number of messages.
+ *
+ * @return Result of the last retry.
+ */
+static int bus_transfer_retry(const struct device *dev, struct i2c_msg *msgs, uint8_t num_msgs)
+{
+	const struct npmx_config *config = dev->config;
+	struct npmx_data *data = dev->data;
+	bool locked = (data->lock.owner == k_current_get());
+	bool can_wait = !locked || (data->lock.lock_count == 1);
+	uint32_t backoff_us = CONFIG_NPMX_BUS_RETRY_BACKOFF_US;
+	uint32_t retries = 0;
+	uint32_t bus_recoveries = 0;
+	int err = -EIO;
+
+	while ((err != 0) && (retries < CONFIG_NPMX_BUS_RETRY_COUNT)) {
+		if (can_wait) {
+			if (locked) {
+				k_mutex_unlock(&data->lock);
+			}
+
+			/* The first retry covers a disturbed transfer, later ones a bus stuck by
+			 * a target holding SDA low.
+			 */
+			if ((retries > 0) && (i2c_recover_bus(config->i2c.bus) == 0)) {
+				bus_recoveries++;
+			}
+
+			k_usleep(backoff_us);
+			backoff_us *= 2;
+
+			if (locked) {
+				(void)k_mutex_lock(&data->lock, K_FOREVER);
+			}
+		}
+
+		retries++;
+
+		err = bus_transfer_once(dev, msgs, num_msgs);
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&data->recovery_lock);
+
+	data->recovery.retries += retries;
+	data->recovery.bus_recoveries += bus_recoveries;
+	if (err == 0) {
+		data->recovery.recovered++;
+	} else {
+		data->recovery.failed++;
+	}
+
+	k_spin_unlock(&data->recovery_lock, key);
+
+	if (err != 0) {
+		LOG_ERR("%s: I2C transfer failed after %u retries: %d", dev->name, retries, err);
+	}
+
+	return err;
+}
+#endif
+
+static int bus_transfer(const struct device *dev, struct i2c_msg *msgs, uint8_t num_msgs)
+{
+	int err = bus_transfer_once(dev, msgs, num_msgs);
+
+#if defined(CONFIG_NPMX_BUS_RETRY)
+	struct npmx_data *data = dev->data;
+
+	if (err != 0) {
+		err = bus_transfer_retry(dev, msgs, num_msgs);
+	}
+
+	if ((err != 0) && (data->proc_thread == k_current_get())) {
+		/* Only the processing thread accesses the flag. */
+		data->proc_failed = true;
+	}
+#endif
+
+	return err;
+}
+
+static void cache_update(const struct device *dev, uint32_t register_address,
+			 uint8_t const *p_data, size_t num_of_bytes)
+{
+#if defined(CONFIG_NPMX_CACHE)
+	struct npmx_data *data = dev->data;
+
+	npmx_cache_update(&data->cache, register_address, p_data, num_of_bytes);
+#endif
+}
+
+static bool cache_read(const struct device *dev, uint32_t register_address, uint8_t *p_data,
+		       size_t num_of_bytes)
+{
+#if defined(CONFIG_NPMX_CACHE)
+	struct npmx_data *data = dev->data;
+
+	return npmx_cache_read(&data->cache, register_address, p_data, num_of_bytes);
+#else
+	return false;
+#endif
+}
+
+#if defined(CONFIG_NPMX_INT_SELECTIVE_SCAN)
+/* Track writes to interrupt enable registers, done by npmx_core_event_interrupt_enable/disable. */
+static void int_enabled_update(const struct device *dev, uint32_t register_address,
+			       uint8_t const *p_data, size_t num_of_bytes)
+{
+	struct npmx_data *data = dev->data;
+
+	if (register_address >= (NPMX_CONFIG_EVENT_REGS_ADDR + NPMX_CONFIG_EVENT_REGS_SIZE)) {
+		return;
+	}
+
+	for (size_t i = 0; i < num_of_bytes; i++) {
+		for (size_t group = 0; group < ARRAY_SIZE(event_group_offsets); group++) {
+			uint32_t set_address =
+				NPMX_CONFIG_EVENT_REGS_ADDR + event_group_offsets[group];
+
+			if ((register_address + i) ==
+			    (set_address + NPMX_CONFIG_EVENT_GROUP_INTENSET_OFFSET)) {
+				atomic_or(&data->int_enabled[group], p_data[i]);
+			} else if ((register_address + i) ==
+				   (set_address + NPMX_CONFIG_EVENT_GROUP_INTENCLR_OFFSET)) {
+				atomic_and(&data->int_enabled[group], ~(atomic_val_t)p_data[i]);
+			}
+		}
+	}
+}
+
+/**
+ * @brief Function for skipping event reads of groups with all interrupts disabled.
+ *
+ * Such groups cannot assert the host interrupt, so during event processing their events are
+ * reported as not set without accessing the bus. Reads done outside event processing, for
+ * example when polling for an event, are not affected.
+ *
+ * @param[in]  dev              Pointer to the nPM Zephyr device.
+ * @param[in]  register_address Address of the first register.
+ * @param[out] p_data           Pointer to the buffer for the register values.
+ * @param[in]  num_of_bytes     Number of registers to be read.
+ *
+ * @retval true  Read skipped.
+ * @retval false Register has to be read from the bus.
+ */
+static bool int_disabled_group_read(const struct device *dev, uint32_t register_address,
+				    uint8_t *p_data, size_t num_of_bytes)
+{
+	struct npmx_data *data = dev->data;
+
+	if ((num_of_bytes != 1) || (data->proc_thread != k_current_get())) {
+		return false;
+	}
+
+	for (size_t group = 0; group < ARRAY_SIZE(event_group_offsets); group++) {
+		if (register_address ==
+		    (NPMX_CONFIG_EVENT_REGS_ADDR + event_group_offsets[group])) {
+			if (atomic_get(&data->int_enabled[group]) != 0) {
+				return false;
+			}
+
+			*p_data = 0;
+			return true;
+		}
+	}
+
+	return false;
+}
+#endif
+
+/* Events are cleared when handled, so a write to EVENTSADCCLR reports a finished measurement.
+ * Called once the write has reached the device, so that a new measurement started by a waiter
+ * cannot have its event cleared by a clear still to be sent.
+ */
+static void adc_events_update(const struct device *dev, uint32_t register_address,
+			      uint8_t const *p_data, size_t num_of_bytes)
+{
+	struct npmx_data *data = dev->data;
+	uint32_t clr_address = NPMX_CONFIG_EVENTS_ADC_CLR_ADDR;
+
+	if ((register_address <= clr_address) && (clr_address < (register_address + num_of_bytes)) &&
+	    (p_data[clr_address - register_address] != 0)) {
+		atomic_or(&data->adc_events, p_data[clr_address - register_address]);
+		k_sem_give(&data->adc_sem);
+
+		if (data->adc_handler != NULL) {
+			data->adc_handler(dev, p_data[clr_address - register_address],
+					  data->p_adc_handler_data);
+		}
+	}
+}
+
+#if defined(CONFIG_NPMX_TRACING)
+/**
+ * @brief Function for tracing event clears.
+ *
+ * npmx_core_proc() clears events of a group right before dispatching them to the registered
+ * callback, so each clear marks the dispatch of the group.
+ */
+static void events_clear_trace(const struct device *dev, uint32_t register_address,
+			       uint8_t const *p_data, size_t num_of_bytes)
+{
+	for (size_t group = 0; group < ARRAY_SIZE(event_group_offsets); group++) {
+		uint32_t clr_address = NPMX_CONFIG_EVENT_REGS_ADDR + event_group_offsets[group] +
+				       NPMX_CONFIG_EVENT_GROUP_CLR_OFFSET;
+
+		if ((register_address <= clr_address) &&
+		    (clr_address < (register_address + num_of_bytes)) &&
+		    (p_data[clr_address - register_address] != 0)) {
+			NPMX_TRACE("events_clear", dev,
+				   (group << 8) | p_data[clr_address - register_address]);
+		}
+	}
+}
+#endif
+
+#if defined(CONFIG_NPMX_INT_COALESCE)
+/**
+ * @brief Function for taking register values from the event snapshot.
+ *
+ * Each value is returned only once, so polling the event registers reads them from the bus.
+ *
+ * @param[in]  dev              Pointer to the nPM Zephyr device.
+ * @param[in]  register_address Address of the first register.
+ * @param[out] p_data           Pointer to the buffer for the register values.
+ * @param[in]  num_of_bytes     Number of registers to be read.
+ *
+ * @retval true  All values taken from the snapshot.
+ * @retval false Values have to be read from the bus.
+ */
+static bool snapshot_read(const struct device *dev, uint32_t register_address, uint8_t *p_data,
+			  size_t num_of_bytes)
+{
+	struct npmx_data *data = dev->data;
+	struct npmx_event_snapshot *snapshot = &data->snapshot;
+	uint32_t offset = register_address - NPMX_CONFIG_EVENT_REGS_ADDR;
+	uint64_t mask;
+
+	if ((snapshot->valid == 0) || (data->proc_thread != k_current_get()) ||
+	    (num_of_bytes == 0) || (register_address < NPMX_CONFIG_EVENT_REGS_ADDR) ||
+	    ((offset + num_of_bytes) > NPMX_CONFIG_EVENT_REGS_SIZE)) {
+		return false;
+	}
+
+	mask = BIT64_MASK(num_of_bytes) << offset;
+	if ((snapshot->valid & mask) != mask) {
+		return false;
+	}
+
+	memcpy(p_data, &snapshot->values[offset], num_of_bytes);
+	snapshot->valid &= ~mask;
+
+	return true;
+}
+#endif
+
+#if defined(CONFIG_NPMX_BATCH)
+static bool batch_owned(const struct device *dev)
+{
+	struct npmx_data *data = dev->data;
+
+	return atomic_ptr_get(&data->batch.owner) == (atomic_ptr_val_t)k_current_get();
+}
+
+/* Closes the batch and lets the next waiting thread open it. */
+static void batch_release(const struct device *dev)
+{
+	struct npmx_data *data = dev->data;
+
+	atomic_ptr_set(&data->batch.owner, NULL);
+	k_sem_give(&data->batch.free);
+}
+
+/**
+ * @brief Function for building I2C messages of all queued segments.
+ *
+ * @param[in] dev Pointer to the nPM Zephyr device.
+ *
+ * @return Number of messages to be sent.
+ */
+static uint8_t batch_msgs_build(const struct device *dev)
+{
+	struct npmx_data *data = dev->data;
+	struct npmx_batch *batch = &data->batch;
+	struct i2c_msg *msgs = batch->msgs;
+	size_t num_msgs = 2 * batch->segment_count;
+
+	/* Each segment is sent as the register address followed by the data, with repeated START
+	 * between segments and STOP at the end of the transfer.
+	 */
+	for (size_t i = 0; i < batch->segment_count; i++) {
+		struct npmx_batch_segment *segment = &batch->segments[i];
+
+		sys_put_be16(segment->register_address, batch->wr_addr[i]);
+
+		msgs[2 * i].buf = batch->wr_addr[i];
+		msgs[2 * i].len = 2U;
+		msgs[2 * i].flags = (i == 0) ? I2C_MSG_WRITE : (I2C_MSG_WRITE | I2C_MSG_RESTART);
+
+		msgs[2 * i + 1].buf = &batch->buf[segment->offset];
+		msgs[2 * i + 1].len = segment->len;
+		msgs[2 * i + 1].flags =
+			segment->write ? I2C_MSG_WRITE : (I2C_MSG_READ | I2C_MSG_RESTART);
+	}
+
+	msgs[num_msgs - 1].flags |= I2C_MSG_STOP;
+
+	return (uint8_t)num_msgs;
+}
+
+/**
+ * @brief Function for finishing the sent batch and emptying it.
+ *
+ * @param[in] dev Pointer to the nPM Zephyr device.
+ * @param[in] err Result of the I2C transfer.
+ *
+ * @retval 0    All queued accesses completed successfully.
+ * @retval -EIO Error using IO bus line.
+ */
+static int batch_complete(const struct device *dev, int err)
+{
+	struct npmx_data *data = dev->data;
+	struct npmx_batch *batch = &data->batch;
+
+	if (err == 0) {
+		for (size_t i = 0; i < batch->read_count; i++) {
+			struct npmx_batch_read *read = &batch->reads[i];
+
+			memcpy(read->p_data, &batch->buf[read->offset], read->len);
+		}
+
+		for (size_t i = 0; i < batch->segment_count; i++) {
+			struct npmx_batch_segment *segment = &batch->segments[i];
+
+			if (!segment->write) {
+				cache_update(dev, segment->register_address,
+					     &batch->buf[segment->offset], segment->len);
+			} else {
+				adc_events_update(dev, segment->register_address,
+						  &batch->buf[segment->offset], segment->len);
+			}
+		}
+	} else {
+#if defined(CONFIG_NPMX_CACHE)
+		/* Queued writes have already been applied to the cache. */
+		npmx_cache_invalidate(&data->cache);
+#endif
+	}
+
+	batch->segment_count = 0;
+	batch->read_count = 0;
+	batch->buf_used = 0;
+
+#if defined(CONFIG_NPMX_WATCHDOG)
+	if (batch->wdt_kick) {
+		batch->wdt_kick = false;
+		npmx_watchdog_piggyback_done(&data->watchdog, batch->wdt_consumed, err);
+	}
+#endif
+
+	return (err == 0) ? 0 : -EIO;
+}
+
+static int batch_flush(const struct device *dev)
+{
+	struct npmx_data *data = dev->data;
+
+#if defined(CONFIG_NPMX_POF_ACTIONS)
+	if (data->batch.capture) {
+		/* Recorded accesses have to fit in the batch and cannot include reads. */
+		return -ENOBUFS;
+	}
+#endif
+
+	if (data->batch.segment_count == 0) {
+		return 0;
+	}
+
+	uint8_t num_msgs = batch_msgs_build(dev);
+
+	return batch_complete(dev, bus_transfer(dev, data->batch.msgs, num_msgs));
+}
+
+/* Lets the watchdog service add its kick to accesses which are about to be sent anyway. */
+static void batch_watchdog_piggyback(const struct device *dev)
+{
+#if defined(CONFIG_NPMX_WATCHDOG)
+	struct npmx_data *data = dev->data;
+
+	if (data->batch.segment_count == 0) {
+		return;
+	}
+
+#if defined(CONFIG_NPMX_POF_ACTIONS)
+	if (data->batch.capture) {
+		return;
+	}
+#endif
+
+	/* Reported when the batch is completed, as the kick is only queued. */
+	data->batch.wdt_kick = npmx_watchdog_piggyback(&data->watchdog, &data->batch.wdt_consumed);
+#else
+	ARG_UNUSED(dev);
+#endif
+}
+
+#if defined(CONFIG_NPMX_ASYNC)
+static void batch_transfer_cb(const struct device *i2c_dev, int result, void *p_user_data)
+{
+	const struct device *dev = p_user_data;
+	struct npmx_data *data = dev->data;
+	npmx_driver_batch_cb_t cb = data->batch.cb;
+	void *p_cb_user_data = data->batch.p_user_data;
+	int err;
+
+	ARG_UNUSED(i2c_dev);
+
+#if defined(CONFIG_NPMX_STATS)
+	bus_stats_update(dev, data->batch.msgs, data->batch.num_msgs, data->batch.start_cycles,
+			 result);
+#endif
+
+	err = batch_complete(dev, result);
+
+	batch_release(dev);
+
+	if (cb != NULL) {
+		cb(dev, err, p_cb_user_data);
+	}
+}
+#endif
+
+/* Writes recorded for power-fail actions are sent only on a power-fail warning. */
+static bool batch_capturing(struct npmx_batch const *batch)
+{
+#if defined(CONFIG_NPMX_POF_ACTIONS)
+	return batch->capture;
+#else
+	ARG_UNUSED(batch);
+
+	return false;
+#endif
+}
+
+/**
+ * @brief Function for adding the register access to the open batch.
+ *
+ * Accesses to register spans following the previous access in the same direction are merged into
+ * a single burst. If the batch is full, queued accesses are sent first.
+ *
+ * @retval 0       Access has been queued.
+ * @retval -ENOMEM Access does not fit in the empty batch and has to be done separately.
+ * @retval -EIO    Sending previously queued accesses failed.
+ */
+static int batch_queue(const struct device *dev, uint32_t register_address, uint8_t *p_data,
+		       size_t num_of_bytes, bool write)
+{
+	struct npmx_data *data = dev->data;
+	struct npmx_batch *batch = &data->batch;
+	struct npmx_batch_segment *last = NULL;
+	bool merge;
+
+	if (num_of_bytes > CONFIG_NPMX_BATCH_BUF_SIZE) {
+		return (batch_flush(dev) == 0) ? -ENOMEM : -EIO;
+	}
+
+	if (batch->segment_count > 0) {
+		last = &batch->segments[batch->segment_count - 1];
+	}
+
+	merge = (last != NULL) && (last->write == write) &&
+		((last->register_address + last->len) == register_address);
+
+	if (((batch->buf_used + num_of_bytes) > CONFIG_NPMX_BATCH_BUF_SIZE) ||
+	    (!merge && (batch->segment_count == CONFIG_NPMX_BATCH_MAX_SEGMENTS)) ||
+	    (!write && (batch->read_count == CONFIG_NPMX_BATCH_MAX_SEGMENTS))) {
+		if (batch_flush(dev) != 0) {
+			return -EIO;
+		}
+		last = NULL;
+		merge = false;
+	}
+
+	if (merge) {
+		last->len += num_of_bytes;
+	} else {
+		last = &batch->segments[batch->segment_count++];
+		last->register_address = (uint16_t)register_address;
+		last->offset = (uint16_t)batch->buf_used;
+		last->len = (uint16_t)num_of_bytes;
+		last->write = write;
+	}
+
+	if (write) {
+		memcpy(&batch->buf[batch->buf_used], p_data, num_of_bytes);
+		/* Keep the cache coherent for reads issued before the batch is sent. */
+		if (!batch_capturing(batch)) {
+			cache_update(dev, register_address, p_data, num_of_bytes);
+		}
+	} else {
+		struct npmx_batch_read *read = &batch->reads[batch->read_count++];
+
+		read->p_data = p_data;
+		read->offset = (uint16_t)batch->buf_used;
+		read->len = (uint16_t)num_of_bytes;
+	}
+
+	batch->buf_used += num_of_bytes;
+
+	return 0;
+}
+#endif /* defined(CONFIG_NPMX_BATCH) */
+
+static npmx_error_t register_write(const struct device *dev, uint32_t register_address,
+				   uint8_t *p_data, size_t num_of_bytes)
+{
+	uint8_t wr_addr[2];
+	struct i2c_msg msgs[2];
+
+#if defined(CONFIG_NPMX_INT_SELECTIVE_SCAN)
+	int_enabled_update(dev, register_address, p_data, num_of_bytes);
+#endif
+
+#if defined(CONFIG_NPMX_TRACING)
+	events_clear_trace(dev, register_address, p_data, num_of_bytes);
+#endif
+
+#if defined(CONFIG_NPMX_BATCH)
+	if (batch_owned(dev)) {
+		int err = batch_queue(dev, register_address, p_data, num_of_bytes, true);
+
+		if (err != -ENOMEM) {
+			return (err == 0) ? NPMX_SUCCESS : NPMX_ERROR_IO;
+		}
+	}
+#endif
+
+	/* npmx register address. */
+	sys_put_be16((uint16_t)register_address, wr_addr);
+
+	/* Setup I2C messages. */
+
+	/* Send the address to write to. */
+	msgs[0].buf = wr_addr;
+	msgs[0].len = 2U;
+	msgs[0].flags = I2C_MSG_WRITE;
+
+	/* Data to be written. STOP after that. */
+	msgs[1].buf = p_data;
+	msgs[1].len = num_of_bytes;
+	msgs[1].flags = I2C_MSG_WRITE | I2C_MSG_STOP;
+
+	if (bus_transfer(dev, msgs, 2) != 0) {
+		return NPMX_ERROR_IO;
+	}
+
+	/* Write-through: keep the cached configuration registers in sync with the device. */
+	cache_update(dev, register_address, p_data, num_of_bytes);
+
+	adc_events_update(dev, register_address, p_data, num_of_bytes);
+
+	return NPMX_SUCCESS;
+}
+
+static npmx_error_t register_read(const struct device *dev, uint32_t register_address,
+				  uint8_t *p_data, size_t num_of_bytes)
+{
+	uint8_t wr_addr[2];
+	struct i2c_msg msgs[2];
+
+	/* Configuration registers do not change on their own, so they can be taken from RAM. */
+	if (cache_read(dev, register_address, p_data, num_of_bytes)) {
+		bus_stats_saved_read(dev);
+		return NPMX_SUCCESS;
+	}
+
+#if defined(CONFIG_NPMX_INT_SELECTIVE_SCAN)
+	if (int_disabled_group_read(dev, register_address, p_data, num_of_bytes)) {
+		bus_stats_saved_read(dev);
+		return NPMX_SUCCESS;
+	}
+#endif
+
+#if defined(CONFIG_NPMX_INT_COALESCE)
+	if (snapshot_read(dev, register_address, p_data, num_of_bytes)) {
+		bus_stats_saved_read(dev);
+		return NPMX_SUCCESS;
+	}
+#endif
+
+#if defined(CONFIG_NPMX_BATCH)
+	if (batch_owned(dev)) {
+		/* The value is needed now: send it together with all queued accesses. */
+		int err = batch_queue(dev, register_address, p_data, num_of_bytes, false);
+
+		if (err == 0) {
+			err = batch_flush(dev);
+		}
+
+		if (err != -ENOMEM) {
+			return (err == 0) ? NPMX_SUCCESS : NPMX_ERROR_IO;
+		}
+	}
+#endif
+
+	/* npmx register address. */
+	sys_put_be16((uint16_t)register_address, wr_addr);
+
+	/* Setup I2C messages. */
+
+	/* Send the address to read from. */
+	msgs[0].buf = wr_addr;
+	msgs[0].len = 2U;
+	msgs[0].flags = I2C_MSG_WRITE;
+
+	/* Read from device. STOP after that. */
+	msgs[1].buf = p_data;
+	msgs[1].len = num_of_bytes;
+	msgs[1].flags = I2C_MSG_READ | I2C_MSG_STOP;
+
+	if (bus_transfer(dev, msgs, 2) != 0) {
+		return NPMX_ERROR_IO;
+	}
+
+	cache_update(dev, register_address, p_data, num_of_bytes);
+
+	return NPMX_SUCCESS;
+}
+
+/* Backend functions, taking the instance lock for each access. Accesses done while another thread
+ * holds the lock for a group wait until the group completes.
+ */
+static npmx_error_t twi_write_function(void *p_context, uint32_t register_address, uint8_t *p_data,
+				       size_t num_of_bytes)
+{
+	const struct device *dev = (const struct device *)p_context;
+	struct npmx_data *data = dev->data;
+	npmx_error_t err_code;
+
+	(void)k_mutex_lock(&data->lock, K_FOREVER);
+	err_code = register_write(dev, register_address, p_data, num_of_bytes);
+	k_mutex_unlock(&data->lock);
+
+	return err_code;
+}
+
+static npmx_error_t twi_read_function(void *p_context, uint32_t register_address, uint8_t *p_data,
+				      size_t num_of_bytes)
+{
+	const struct device *dev = (const struct device *)p_context;
+	struct npmx_data *data = dev->data;
+	npmx_error_t err_code;
+
+	(void)k_mutex_lock(&data->lock, K_FOREVER);
+	err_code = register_read(dev, register_address, p_data, num_of_bytes);
+	k_mutex_unlock(&data->lock);
+
+	return err_code;
+}
+
+#if defined(CONFIG_NPMX_POF_ACTIONS)
+static void pof_thread(void *p1, void *p2, void *p3)
+{
+	const struct device *dev = p1;
+	struct npmx_data *data = dev->data;
+	struct npmx_pof_actions *pof = &data->pof;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		k_sem_take(&pof->sem, K_FOREVER);
+
+		if (data->pof_cb) {
+			data->pof_cb(&data->npmx_instance);
+		}
+
+		size_t count = pof->count;
+
+		for (size_t i = 0; i < count; i++) {
+			struct npmx_driver_pof_action const *action = &pof->p_actions[i];
+
+			if (action->type == NPMX_DRIVER_POF_ACTION_CALLBACK) {
+				action->callback.handler(dev, action->callback.p_user_data);
+				continue;
+			}
+
+			for (size_t j = 0; j < pof->segment_count[i]; j++) {
+				/* Not retried, the actions have to be done before the supply
+				 * fails. Keep going, remaining actions may still succeed.
+				 */
+				(void)bus_transfer_once(dev, pof->msgs[pof->first_segment[i] + j],
+							2);
+			}
+		}
+
+		uint32_t latency_us = k_cyc_to_us_floor32(k_cycle_get_32() - pof->int_cycles);
+		k_spinlock_key_t key = k_spin_lock(&pof->latency_lock);
+
+		pof->latency.last_us = latency_us;
+		pof->latency.max_us = MAX(pof->latency.max_us, latency_us);
+		pof->latency.count++;
+
+		k_spin_unlock(&pof->latency_lock, key);
+	}
+}
+
+/**
+ * @brief Function for issuing register writes of the action through npmx API functions.
+ *
+ * @retval 0       Writes issued.
+ * @retval -EINVAL Invalid action.
+ * @retval -EIO    Writes could not be recorded.
+ */
+static int pof_action_issue(const struct device *dev, struct npmx_driver_pof_action const *action)
+{
+	struct npmx_data *data = dev->data;
+	npmx_instance_t *npmx_instance = &data->npmx_instance;
+	npmx_error_t err_code;
+
+	switch (action->type) {
+	case NPMX_DRIVER_POF_ACTION_CALLBACK:
+		return (action->callback.handler != NULL) ? 0 : -EINVAL;
+	case NPMX_DRIVER_POF_ACTION_LDSW_DISABLE:
+		if (action->index >= NPM_LDSW_COUNT) {
+			return -EINVAL;
+		}
+		err_code = npmx_ldsw_task_trigger(npmx_ldsw_get(npmx_instance, action->index),
+						  NPMX_LDSW_TASK_DISABLE);
+		break;
+	case NPMX_DRIVER_POF_ACTION_BUCK_DISABLE:
+		if (action->index >= NPM_BUCK_COUNT) {
+			return -EINVAL;
+		}
+		err_code = npmx_buck_task_trigger(npmx_buck_get(npmx_instance, action->index),
+						  NPMX_BUCK_TASK_DISABLE);
+		break;
+#if defined(CONFIG_NPMX_SHIP)
+	case NPMX_DRIVER_POF_ACTION_SHIP_MODE:
+		err_code = npmx_ship_task_trigger(npmx_ship_get(npmx_instance, 0),
+						  NPMX_SHIP_TASK_SHIPMODE);
+		break;
+#endif
+	default:
+		return -EINVAL;
+	}
+
+	return (err_code == NPMX_SUCCESS) ? 0 : -EIO;
+}
+
+/**
+ * @brief Function for building I2C messages of the action.
+ *
+ * Register writes of the action are recorded in the batch without being sent, and copied to
+ * the POF buffers as separate write transactions. They do not update the register cache.
+ *
+ * @retval 0       Messages built.
+ * @retval -EINVAL Invalid action.
+ * @retval -ENOMEM Messages do not fit in the buffers.
+ * @retval -EBUSY  Batch of another thread not sent in time.
+ */
+static int pof_action_build(const struct device *dev, size_t idx,
+			    struct npmx_driver_pof_action const *action)
+{
+	struct npmx_data *data = dev->data;
+	struct npmx_pof_actions *pof = &data->pof;
+	struct npmx_batch *batch = &data->batch;
+
+	if (npmx_driver_batch_begin(dev) != 0) {
+		return -EBUSY;
+	}
+
+	batch->capture = true;
+
+	int err = pof_action_issue(dev, action);
+
+	if (err == -EIO) {
+		err = -ENOMEM;
+	}
+
+	pof->first_segment[idx] = (uint8_t)pof->segments_used;
+	pof->segment_count[idx] = 0;
+
+	for (size_t i = 0; (i < batch->segment_count) && (err == 0); i++) {
+		struct npmx_batch_segment *segment = &batch->segments[i];
+		size_t n = pof->segments_used;
+
+		if ((n == CONFIG_NPMX_BATCH_MAX_SEGMENTS) ||
+		    ((pof->buf_used + segment->len) > sizeof(pof->buf))) {
+			err = -ENOMEM;
+			break;
+		}
+
+		memcpy(&pof->buf[pof->buf_used], &batch->buf[segment->offset], segment->len);
+		sys_put_be16(segment->register_address, pof->wr_addr[n]);
+
+		pof->msgs[n][0].buf = pof->wr_addr[n];
+		pof->msgs[n][0].len = 2U;
+		pof->msgs[n][0].flags = I2C_MSG_WRITE;
+		pof->msgs[n][1].buf = &pof->buf[pof->buf_used];
+		pof->msgs[n][1].len = segment->len;
+		pof->msgs[n][1].flags = I2C_MSG_WRITE | I2C_MSG_STOP;
+
+		pof->buf_used += segment->len;
+		pof->segments_used++;
+		pof->segment_count[idx]++;
+	}
+
+	/* Drop the recorded accesses, they have not been sent to the device. */
+	batch->capture = false;
+	batch->segment_count = 0;
+	batch->read_count = 0;
+	batch->buf_used = 0;
+	batch_release(dev);
+
+	return err;
+}
+#endif /* defined(CONFIG_NPMX_POF_ACTIONS) */
+
+static int npmx_driver_init(const struct device *dev)
+{
+	struct npmx_data *data = dev->data;
+	const struct npmx_config *config = dev->config;
+	const struct device *bus = config->i2c.bus;
+	npmx_instance_t *npmx_instance = &data->npmx_instance;
+	npmx_backend_t *backend = &data->backend;
+
+	data->dev = dev;
+
+#if defined(CONFIG_NPMX_STATS)
+	bus_stats_clear(&data->stats);
+#if defined(CONFIG_STATS)
+	stats_init(&data->stats_group.s_hdr, STATS_SIZE_32, 4, STATS_NAME_INIT_PARMS(npmx));
+	stats_register(dev->name, &data->stats_group.s_hdr);
+#endif
+#endif
+
+	k_mutex_init(&data->lock);
+#if defined(CONFIG_NPMX_BATCH)
+	k_sem_init(&data->batch.free, 1, 1);
+#endif
+	k_mutex_init(&data->adc_lock);
+	k_sem_init(&data->adc_sem, 0, 1);
+
+	k_mutex_init(&data->delivery_lock);
+	k_mutex_init(&data->subscribers_lock);
+	k_condvar_init(&data->handler_done);
+	sys_slist_init(&data->subscribers);
+
+#if defined(CONFIG_NPMX_ADC_SAMPLER)
+	sys_slist_init(&data->samplers);
+#endif
+
+#if defined(CONFIG_NPMX_WATCHDOG)
+	npmx_watchdog_init(&data->watchdog, dev);
+#endif
+
+#if defined(CONFIG_NPMX_EVENT_LOG)
+	npmx_event_log_init(&data->event_log);
+#endif
+
+#if defined(CONFIG_NPMX_LED_PATTERN)
+	npmx_led_pattern_init(&data->led_pattern, dev);
+#endif
+
+#if defined(CONFIG_NPMX_POWER_ACCOUNT)
+	npmx_power_account_init(&data->power_account, dev);
+#endif
+
+#if defined(CONFIG_NPMX_POF_ACTIONS)
+	if (NPMX_CONFIG_HOST_POF_USED && (config->host_pof_gpio.port != NULL)) {
+		k_sem_init(&data->pof.sem, 0, 1);
+		k_thread_create(&data->pof.thread, data->pof.stack,
+				K_KERNEL_STACK_SIZEOF(data->pof.stack), pof_thread, (void *)dev,
+				NULL, NULL, K_HIGHEST_THREAD_PRIO, 0, K_NO_WAIT);
+		k_thread_name_set(&data->pof.thread, dev->name);
+	}
+#endif
+
+	backend->p_write = twi_write_function;
+	backend->p_read = twi_read_function;
+	backend->p_context = (void *)dev;
+
+#if defined(CONFIG_NPMX_CACHE)
+	npmx_cache_invalidate(&data->cache);
+#endif
+
+#if defined(CONFIG_NPMX_INT_SELECTIVE_SCAN)
+	/* Interrupt state is unknown until all interrupts are disabled below. */
+	for (size_t group = 0; group < NPMX_EVENT_GROUP_COUNT; group++) {
+		atomic_set(&data->int_enabled[group], NPMX_EVENT_GROUP_ALL_EVENTS_MASK);
+	}
+#endif
+
+	data->npmx_instance.generic_cb = generic_callback;
+
+#if defined(CONFIG_NPMX_RESTORE_VALUES)
+	npmx_error_t ret = npmx_core_init(npmx_instance, backend, generic_callback, true);
+#else
+	npmx_error_t ret = npmx_core_init(npmx_instance, backend, generic_callback, false);
+#endif
+
+	if (!device_is_ready(bus)) {
+		LOG_ERR("%s: bus device %s is not ready", dev->name, bus->name);
+		return -ENODEV;
+	}
+
+	if (ret != NPMX_SUCCESS) {
+		LOG_ERR("Unable to init npmx device");
+		return -EIO;
+	}
+
+	if (NPMX_CONFIG_HOST_INT_USED && (config->host_int_gpio.port != NULL) &&
+	    (config->pmic_int_pin != -1)) {
+		/* Clear all events before enabling interrupts, in a single transfer if possible. */
+		bool failed = (npmx_driver_batch_begin(dev) != 0);
+
+		for (uint32_t i = 0; (i < NPMX_EVENT_GROUP_COUNT) && !failed; i++) {
+			npmx_error_t err_code = npmx_core_event_interrupt_disable(
+				npmx_instance, (npmx_event_group_t)i, NPMX_EVENT_GROUP_ALL_EVENTS_MASK);
+
+			failed = (err_code != NPMX_SUCCESS);
+		}
+
+		if ((npmx_driver_batch_end(dev) != 0) || failed) {
+			LOG_ERR("Failed to disable interrupts");
+			return -EIO;
+		}
+
+		if (int_gpio_interrupt_init(dev) < 0) {
+			LOG_ERR("Failed to initialize interrupt");
+			return -EIO;
+		}
+	} else if ((config->host_int_gpio.port != NULL) && (config->pmic_int_pin == -1)) {
+		LOG_ERR("PMIC INT pin not configured");
+		return -EIO;
+	} else if ((config->host_int_gpio.port == NULL) && (config->pmic_int_pin != -1)) {
+		LOG_ERR("HOST INT pin not configured");
+		return -EIO;
+	}
+
+	if (config->pmic_reset_pin != -1) {
+		/* Configure PMIC's GPIO to work as output reset. */
+		npmx_gpio_mode_set(npmx_gpio_get(npmx_instance, config->pmic_reset_pin),
+				   NPMX_GPIO_MODE_OUTPUT_RESET);
+	}
+
+#if defined(CONFIG_NPMX_CHARGER_STATE)
+	if (npmx_charger_state_start(&data->charger_state, dev) != 0) {
+		LOG_ERR("%s: failed to read charger state", dev->name);
+		return -EIO;
+	}
+#endif
+
+#if defined(CONFIG_NPMX_DVFS)
+	struct gpio_dt_spec const *p_retention_gpio =
+		(config->host_retention_gpio.port != NULL) ? &config->host_retention_gpio : NULL;
+
+	if (npmx_dvfs_init(&data->dvfs, dev, p_retention_gpio) != 0) {
+		LOG_ERR("%s: failed to configure retention GPIO", dev->name);
+		return -EIO;
+	}
+#endif
+
+#if defined(CONFIG_NPMX_WARM_BOOT)
+	data->warm_boot = npmx_boot_config_applied_check(config->boot_config);
+	if (data->warm_boot) {
+		LOG_DBG("%s: boot configuration already applied", dev->name);
+	}
+#endif
+
+#if defined(CONFIG_NPMX_BOOT_CONFIG)
+	if (!npmx_driver_warm_boot_check(dev)) {
+		int err = npmx_boot_config_apply(dev, config->boot_config);
+
+		if (err != 0) {
+			LOG_ERR("%s: failed to apply boot configuration: %d", dev->name, err);
+			return err;
+		}
+	}
+#endif
+
+#if defined(CONFIG_NPMX_VBUS_LIMIT)
+	/* Started last, as the boot configuration sets the limit for the default CC state. */
+	if (npmx_vbus_limit_start(&data->vbus_limit, dev, config->p_vbus_limit) != 0) {
+		LOG_ERR("%s: failed to apply VBUS current limit", dev->name);
+		return -EIO;
+	}
+#endif
+
+	return 0;
+};
+
+#if defined(CONFIG_PM_DEVICE)
+/* Pauses the periodic work of the services on suspend, or restarts it on resume. */
+static void services_pm(const struct device *dev, bool suspend)
+{
+	struct npmx_data *data = dev->data;
+	const struct npmx_config *config = dev->config;
+
+#if defined(CONFIG_NPMX_ADC_SAMPLER)
+	struct npmx_adc_sampler *p_sampler;
+
+	/* Samplers are never removed, so the list is walked without the lock. */
+	SYS_SLIST_FOR_EACH_CONTAINER(&data->samplers, p_sampler, node) {
+		if (suspend) {
+			npmx_adc_sampler_suspend(p_sampler);
+		} else {
+			npmx_adc_sampler_resume(p_sampler);
+		}
+	}
+#endif
+
+#if defined(CONFIG_NPMX_LED_PATTERN)
+	if (suspend) {
+		npmx_led_pattern_suspend(&data->led_pattern);
+	} else {
+		npmx_led_pattern_resume(&data->led_pattern);
+	}
+#endif
+
+#if defined(CONFIG_NPMX_BUS_RETRY)
+	/* The resync work exists only with the host interrupt. */
+	if (config->host_int_gpio.port != NULL) {
+		struct k_work_sync sync;
+
+		if (suspend) {
+			data->resync_paused =
+				k_work_cancel_delayable_sync(&data->resync_work, &sync);
+		} else if (data->resync_paused) {
+			data->resync_paused = false;
+			(void)k_work_schedule(&data->resync_work, K_NO_WAIT);
+		}
+	}
+#endif
+
+	ARG_UNUSED(data);
+	ARG_UNUSED(config);
+	ARG_UNUSED(suspend);
+}
+
+static int int_suspend(const struct device *dev)
+{
+	struct npmx_data *data = dev->data;
+	const struct npmx_config *config = dev->config;
+	struct k_work_sync sync;
+
+	if ((config->host_int_gpio.port == NULL) || pm_device_wakeup_is_enabled(dev)) {
+		/* The level interrupt stays armed and wakes the system on any enabled event. */
+		return 0;
+	}
+
+	/* Events stay latched in the nPM device and assert the host interrupt again on resume. */
+	atomic_set(&data->int_masked, 1);
+
+	int err = gpio_pin_interrupt_configure_dt(&config->host_int_gpio, GPIO_INT_DISABLE);
+
+#if defined(CONFIG_NPMX_INT_COALESCE)
+	(void)k_work_cancel_delayable_sync(&data->work, &sync);
+#else
+	(void)k_work_cancel_sync(&data->work, &sync);
+#endif
+
+	return err;
+}
+
+static int int_resume(const struct device *dev)
+{
+	struct npmx_data *data = dev->data;
+	const struct npmx_config *config = dev->config;
+
+	if (!atomic_cas(&data->int_masked, 1, 0)) {
+		return 0;
+	}
+
+	return gpio_pin_interrupt_configure_dt(&config->host_int_gpio, GPIO_INT_LEVEL_HIGH);
+}
+
+/**
+ * @brief Function for suspending or resuming background activity of the nPM device.
+ *
+ * On suspend, automatic VBAT measurements, ADC samplers, LED patterns and event
+ * resynchronization are paused. Unless the device is a wake-up source,
+ * the host interrupt is disabled, so that events do not wake the system and are processed on
+ * resume. The power-fail warning is always handled.
+ */
+static int npmx_driver_pm_action(const struct device *dev, enum pm_device_action action)
+{
+	struct npmx_data *data = dev->data;
+	npmx_adc_t *adc_instance = npmx_adc_get(&data->npmx_instance, 0);
+	npmx_adc_config_t adc_config;
+	int err;
+
+	switch (action) {
+	case PM_DEVICE_ACTION_SUSPEND:
+		services_pm(dev, true);
+
+		if (npmx_adc_config_get(adc_instance, &data->adc_config) != NPMX_SUCCESS) {
+			return -EIO;
+		}
+
+		adc_config = data->adc_config;
+		adc_config.vbat_auto = false;
+
+		if (npmx_adc_config_set(adc_instance, &adc_config) != NPMX_SUCCESS) {
+			return -EIO;
+		}
+
+		err = int_suspend(dev);
+		break;
+	case PM_DEVICE_ACTION_RESUME:
+		if (npmx_adc_config_set(adc_instance, &data->adc_config) != NPMX_SUCCESS) {
+			return -EIO;
+		}
+
+		err = int_resume(dev);
+
+		services_pm(dev, false);
+		break;
+	default:
+		err = -ENOTSUP;
+		break;
+	}
+
+	return err;
+}
+#endif
+
+npmx_instance_t *npmx_driver_instance_get(const struct device *p_dev)
+{
+	return (npmx_instance_t *)(&((struct npmx_data *)p_dev->data)->npmx_instance);
+}
+
+int npmx_driver_batch_begin(const struct device *p_dev)
+{
+#if defined(CONFIG_NPMX_BATCH)
+	struct npmx_data *data = p_dev->data;
+	k_timeout_t timeout = K_MSEC(CONFIG_NPMX_BATCH_WAIT_MS);
+
+	if (batch_owned(p_dev)) {
+		return -EBUSY;
+	}
+
+	/* The owner takes the instance lock to send the batch, so a holder of the lock cannot
+	 * wait for it.
+	 */
+	if (k_is_in_isr() || (data->lock.owner == k_current_get())) {
+		timeout = K_NO_WAIT;
+	}
+
+	if (k_sem_take(&data->batch.free, timeout) != 0) {
+		return -EBUSY;
+	}
+
+	atomic_ptr_set(&data->batch.owner, (atomic_ptr_val_t)k_current_get());
+#else
+	ARG_UNUSED(p_dev);
+#endif
+
+	return 0;
+}
+
+int npmx_driver_batch_read(const struct device *p_dev, uint32_t register_address,
+			   uint8_t *p_data, size_t num_of_bytes)
+{
+	if (cache_read(p_dev, register_address, p_data, num_of_bytes)) {
+		return 0;
+	}
+
+#if defined(CONFIG_NPMX_BATCH)
+	if (!batch_owned(p_dev)) {
+		return -EINVAL;
+	}
+
+	int err = batch_queue(p_dev, register_address, p_data, num_of_bytes, false);
+
+	if (err != -ENOMEM) {
+		return err;
+	}
+#endif
+
+	if (twi_read_function((void *)p_dev, register_address, p_data, num_of_bytes) !=
+	    NPMX_SUCCESS) {
 		return -EIO;
 	}
 
-	if ((config->host_int_gpio.port != NULL) && (config->pmic_int_pin != -1)) {
-		/* Clear all events before enabling interrupts. */
-		for (uint32_t i = 0; i < NPMX_EVENT_GROUP_COUNT; i++) {
-			if (npmx_core_event_interrupt_disable(npmx_instance, (npmx_event_group_t)i,
-							      NPMX_EVENT_GROUP_ALL_EVENTS_MASK) !=
-			    NPMX_SUCCESS) {
-				LOG_ERR("Failed to disable interrupts");
-				return -EIO;
-			}
+	return 0;
+}
+
+int npmx_driver_batch_end(const struct device *p_dev)
+{
+#if defined(CONFIG_NPMX_BATCH)
+	struct npmx_data *data = p_dev->data;
+
+	if (!batch_owned(p_dev)) {
+		return -EINVAL;
+	}
+
+	(void)k_mutex_lock(&data->lock, K_FOREVER);
+
+	batch_watchdog_piggyback(p_dev);
+
+	int err = batch_flush(p_dev);
+
+	k_mutex_unlock(&data->lock);
+
+	batch_release(p_dev);
+
+	return err;
+#else
+	ARG_UNUSED(p_dev);
+
+	return 0;
+#endif
+}
+
+int npmx_driver_batch_submit(const struct device *p_dev, npmx_driver_batch_cb_t cb,
+			     void *p_user_data)
+{
+#if defined(CONFIG_NPMX_ASYNC)
+	const struct npmx_config *config = p_dev->config;
+	struct npmx_data *data = p_dev->data;
+	struct npmx_batch *batch = &data->batch;
+
+	if (!batch_owned(p_dev)) {
+		return -EINVAL;
+	}
+
+	/* Only the start of the transfer is ordered with groups of other threads. */
+	(void)k_mutex_lock(&data->lock, K_FOREVER);
+
+	batch_watchdog_piggyback(p_dev);
+
+	if (batch->segment_count > 0) {
+		/* Keep the batch closed for all threads until the transfer completes. */
+		atomic_ptr_set(&batch->owner, (atomic_ptr_val_t)batch);
+		batch->cb = cb;
+		batch->p_user_data = p_user_data;
+
+		uint8_t num_msgs = batch_msgs_build(p_dev);
+
+#if defined(CONFIG_NPMX_STATS)
+		batch->num_msgs = num_msgs;
+		batch->start_cycles = k_cycle_get_32();
+#endif
+
+		int err = i2c_transfer_cb(config->i2c.bus, batch->msgs, num_msgs, config->i2c.addr,
+					  batch_transfer_cb, (void *)p_dev);
+
+#if defined(CONFIG_NPMX_STATS)
+		if (err != 0) {
+			/* The transfer is not started, a synchronous one is counted by itself. */
+			batch->num_msgs = 0;
+		}
+#endif
+
+		if (err == -ENOSYS) {
+			/* Bus driver does not support asynchronous transfers. */
+			batch_transfer_cb(config->i2c.bus,
+					  bus_transfer(p_dev, batch->msgs, num_msgs), (void *)p_dev);
+		} else if (err != 0) {
+			LOG_ERR("Failed to start I2C transfer: %d", err);
+			(void)batch_complete(p_dev, err);
+			batch_release(p_dev);
+			k_mutex_unlock(&data->lock);
+			return -EIO;
+		}
+
+		k_mutex_unlock(&data->lock);
+		return 0;
+	}
+
+	k_mutex_unlock(&data->lock);
+#endif
+
+	int err = npmx_driver_batch_end(p_dev);
+
+	if ((err == -EINVAL) || (cb == NULL)) {
+		return err;
+	}
+
+	cb(p_dev, err, p_user_data);
+
+	return 0;
+}
+
+int npmx_driver_lock(const struct device *p_dev, k_timeout_t timeout)
+{
+	struct npmx_data *data = p_dev->data;
+
+	return k_mutex_lock(&data->lock, timeout);
+}
+
+void npmx_driver_unlock(const struct device *p_dev)
+{
+	struct npmx_data *data = p_dev->data;
+
+	(void)k_mutex_unlock(&data->lock);
+}
+
+int npmx_driver_group_run(const struct device *p_dev, npmx_driver_group_cb_t cb,
+			  void *p_user_data)
+{
+	struct npmx_data *data = p_dev->data;
+	bool batched;
+	int err;
+	int result;
+
+	/* Opened before taking the lock, as the owner of another batch takes it to send the batch.
+	 * If the calling thread has already opened a batch, accesses of the group are sent as usual.
+	 */
+	batched = (npmx_driver_batch_begin(p_dev) == 0);
+
+	(void)k_mutex_lock(&data->lock, K_FOREVER);
+
+	result = cb(&data->npmx_instance, p_user_data);
+
+	err = batched ? npmx_driver_batch_end(p_dev) : 0;
+
+	k_mutex_unlock(&data->lock);
+
+	if (result != 0) {
+		return result;
+	}
+
+	return (err != 0) ? -EIO : 0;
+}
+
+/**
+ * @brief Function for waiting until all ADC events in the mask are set and clearing them.
+ *
+ * Used when the host interrupt is not available, so events are not handled by
+ * npmx_core_proc().
+ */
+static int adc_events_poll(const struct device *dev, uint8_t event_mask, int64_t deadline)
+{
+	struct npmx_data *data = dev->data;
+
+	while ((atomic_get(&data->adc_events) & event_mask) != event_mask) {
+		uint8_t events;
+
+		if (twi_read_function((void *)dev, NPMX_CONFIG_EVENTS_ADC_SET_ADDR, &events, 1) !=
+		    NPMX_SUCCESS) {
+			return -EIO;
+		}
+
+		events &= event_mask;
+		if (events != 0) {
+			if (twi_write_function((void *)dev, NPMX_CONFIG_EVENTS_ADC_CLR_ADDR, &events,
+					       1) != NPMX_SUCCESS) {
+				return -EIO;
+			}
+			continue;
+		}
+
+		if (k_uptime_get() >= deadline) {
+			return -ETIMEDOUT;
+		}
+
+		k_msleep(ADC_POLL_INTERVAL_MS);
+	}
+
+	return 0;
+}
+
+/* Trigger all ADC tasks in a single transfer if possible. */
+static int adc_tasks_trigger(const struct device *dev, npmx_adc_task_t const *p_tasks,
+			     size_t task_count)
+{
+	struct npmx_data *data = dev->data;
+	npmx_adc_t *adc_instance = npmx_adc_get(&data->npmx_instance, 0);
+	bool batch = (npmx_driver_batch_begin(dev) == 0);
+	int err = 0;
+
+	for (size_t i = 0; (i < task_count) && (err == 0); i++) {
+		if (npmx_adc_task_trigger(adc_instance, p_tasks[i]) != NPMX_SUCCESS) {
+			err = -EIO;
+		}
+	}
+
+	if (batch && (npmx_driver_batch_end(dev) != 0)) {
+		err = -EIO;
+	}
+
+	return err;
+}
+
+int npmx_driver_adc_meas_wait(const struct device *p_dev, npmx_adc_task_t task,
+			      uint8_t event_mask, uint32_t timeout_ms)
+{
+	return npmx_driver_adc_tasks_wait(p_dev, &task, 1, event_mask, timeout_ms);
+}
+
+int npmx_driver_adc_tasks_wait(const struct device *p_dev, npmx_adc_task_t const *p_tasks,
+			       size_t task_count, uint8_t event_mask, uint32_t timeout_ms)
+{
+	const struct npmx_config *config = p_dev->config;
+	struct npmx_data *data = p_dev->data;
+	npmx_instance_t *npmx_instance = &data->npmx_instance;
+	bool int_used = (config->host_int_gpio.port != NULL);
+	int64_t deadline = k_uptime_get() + timeout_ms;
+	uint8_t int_enabled = 0;
+	int err = 0;
+
+	if ((event_mask == 0) || (task_count == 0)) {
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&data->adc_lock, K_FOREVER);
+
+	if (int_used) {
+		/* Let the host interrupt report the measurement, the event is cleared in work_cb. */
+		if ((twi_read_function((void *)p_dev, NPMX_CONFIG_INTEN_ADC_SET_ADDR, &int_enabled,
+				       1) != NPMX_SUCCESS) ||
+		    (npmx_core_event_interrupt_enable(npmx_instance, NPMX_EVENT_GROUP_ADC,
+						      event_mask) != NPMX_SUCCESS)) {
+			k_mutex_unlock(&data->adc_lock);
+			return -EIO;
+		}
+	}
+
+	atomic_and(&data->adc_events, ~(atomic_val_t)event_mask);
+	k_sem_reset(&data->adc_sem);
+
+	if (adc_tasks_trigger(p_dev, p_tasks, task_count) != 0) {
+		err = -EIO;
+	} else if (int_used) {
+		while ((atomic_get(&data->adc_events) & event_mask) != event_mask) {
+			int64_t remaining = deadline - k_uptime_get();
+
+			if ((remaining <= 0) || (k_sem_take(&data->adc_sem, K_MSEC(remaining)) != 0)) {
+				err = -ETIMEDOUT;
+				break;
+			}
+		}
+	} else {
+		err = adc_events_poll(p_dev, event_mask, deadline);
+	}
+
+	/* Restore interrupts disabled before the wait. */
+	if (int_used && ((event_mask & ~int_enabled) != 0) &&
+	    (npmx_core_event_interrupt_disable(npmx_instance, NPMX_EVENT_GROUP_ADC,
+					       event_mask & ~int_enabled) != NPMX_SUCCESS)) {
+		err = (err == 0) ? -EIO : err;
+	}
+
+	k_mutex_unlock(&data->adc_lock);
+
+	return err;
+}
+
+void npmx_driver_adc_handler_set(const struct device *p_dev, npmx_driver_adc_handler_t handler,
+				  void *p_user_data)
+{
+	struct npmx_data *data = p_dev->data;
+	unsigned int key = irq_lock();
+
+	data->adc_handler = handler;
+	data->p_adc_handler_data = p_user_data;
+
+	irq_unlock(key);
+}
+
+int npmx_driver_event_subscribe(const struct device *p_dev,
+				struct npmx_driver_event_subscriber *p_subscriber)
+{
+	struct npmx_data *data = p_dev->data;
+	struct npmx_driver_event_subscriber *p_added;
+	int err = 0;
+
+	if ((p_subscriber->handler == NULL) || (p_subscriber->type >= NPMX_CALLBACK_TYPE_COUNT)) {
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&data->subscribers_lock, K_FOREVER);
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&data->subscribers, p_added, node) {
+		if (p_added == p_subscriber) {
+			err = -EALREADY;
+			break;
+		}
+	}
+
+	if (err == 0) {
+		sys_slist_append(&data->subscribers, &p_subscriber->node);
+	}
+
+	k_mutex_unlock(&data->subscribers_lock);
+
+	return err;
+}
+
+int npmx_driver_event_unsubscribe(const struct device *p_dev,
+				  struct npmx_driver_event_subscriber *p_subscriber)
+{
+	struct npmx_data *data = p_dev->data;
+	bool removed;
+
+	k_mutex_lock(&data->subscribers_lock, K_FOREVER);
+
+	/* A handler removing its own subscriber does not wait for itself. */
+	while ((data->p_handled == p_subscriber) && (data->delivery_thread != k_current_get())) {
+		(void)k_condvar_wait(&data->handler_done, &data->subscribers_lock, K_FOREVER);
+	}
+
+	if (data->p_delivery_next == &p_subscriber->node) {
+		data->p_delivery_next = sys_slist_peek_next(&p_subscriber->node);
+	}
+
+	removed = sys_slist_find_and_remove(&data->subscribers, &p_subscriber->node);
+
+	k_mutex_unlock(&data->subscribers_lock);
+
+	return removed ? 0 : -ENOENT;
+}
+
+int npmx_driver_latency_get(const struct device *p_dev, struct npmx_driver_latency *p_latency)
+{
+#if defined(CONFIG_NPMX_INT_LATENCY)
+	struct npmx_data *data = p_dev->data;
+	k_spinlock_key_t key = k_spin_lock(&data->latency_lock);
+
+	*p_latency = data->latency;
+
+	k_spin_unlock(&data->latency_lock, key);
+
+	return 0;
+#else
+	ARG_UNUSED(p_dev);
+	ARG_UNUSED(p_latency);
+
+	return -ENOTSUP;
+#endif
+}
+
+void npmx_driver_latency_reset(const struct device *p_dev)
+{
+#if defined(CONFIG_NPMX_INT_LATENCY)
+	struct npmx_data *data = p_dev->data;
+	k_spinlock_key_t key = k_spin_lock(&data->latency_lock);
+
+	data->latency = (struct npmx_driver_latency){ 0 };
+
+	k_spin_unlock(&data->latency_lock, key);
+#else
+	ARG_UNUSED(p_dev);
+#endif
+}
+
+int npmx_driver_bus_stats_get(const struct device *p_dev, struct npmx_driver_bus_stats *p_stats)
+{
+#if defined(CONFIG_NPMX_STATS)
+	struct npmx_data *data = p_dev->data;
+	struct npmx_bus_stats *stats = &data->stats;
+	k_spinlock_key_t key = k_spin_lock(&data->stats_lock);
+	uint32_t transfers = MAX(stats->transfers, 1);
+
+	*p_stats = (struct npmx_driver_bus_stats){
+		.transfers = stats->transfers,
+		.errors = stats->errors,
+		.min_us = (stats->transfers > 0) ? k_cyc_to_us_floor32(stats->min_cycles) : 0,
+		.avg_us = (uint32_t)k_cyc_to_us_floor64(stats->total_cycles / transfers),
+		.max_us = k_cyc_to_us_floor32(stats->max_cycles),
+		.total_us = k_cyc_to_us_floor64(stats->total_cycles),
+		.saved_reads = stats->saved_reads,
+		.untracked = stats->untracked,
+		.total = stats->total,
+	};
+	memcpy(p_stats->peripherals, stats->peripherals, sizeof(p_stats->peripherals));
+
+	k_spin_unlock(&data->stats_lock, key);
+
+	return 0;
+#else
+	ARG_UNUSED(p_dev);
+	ARG_UNUSED(p_stats);
+
+	return -ENOTSUP;
+#endif
+}
+
+int npmx_driver_bus_register_stats_get(const struct device *p_dev, size_t index,
+				       struct npmx_driver_bus_register_stats *p_stats)
+{
+#if defined(CONFIG_NPMX_STATS)
+	struct npmx_data *data = p_dev->data;
+	int err = -ENOENT;
+	k_spinlock_key_t key = k_spin_lock(&data->stats_lock);
+
+	if (index < data->stats.register_count) {
+		*p_stats = data->stats.registers[index];
+		err = 0;
+	}
+
+	k_spin_unlock(&data->stats_lock, key);
+
+	return err;
+#else
+	ARG_UNUSED(p_dev);
+	ARG_UNUSED(index);
+	ARG_UNUSED(p_stats);
+
+	return -ENOTSUP;
+#endif
+}
+
+void npmx_driver_bus_stats_reset(const struct device *p_dev)
+{
+#if defined(CONFIG_NPMX_STATS)
+	struct npmx_data *data = p_dev->data;
+	k_spinlock_key_t key = k_spin_lock(&data->stats_lock);
+
+	bus_stats_clear(&data->stats);
+
+	k_spin_unlock(&data->stats_lock, key);
+
+#if defined(CONFIG_STATS)
+	stats_reset(&data->stats_group.s_hdr);
+#endif
+#else
+	ARG_UNUSED(p_dev);
+#endif
+}
+
+int npmx_driver_bus_recovery_stats_get(const struct device *p_dev,
+				       struct npmx_driver_bus_recovery_stats *p_stats)
+{
+#if defined(CONFIG_NPMX_BUS_RETRY)
+	struct npmx_data *data = p_dev->data;
+	k_spinlock_key_t key = k_spin_lock(&data->recovery_lock);
+
+	*p_stats = data->recovery;
+
+	k_spin_unlock(&data->recovery_lock, key);
+
+	return 0;
+#else
+	ARG_UNUSED(p_dev);
+	ARG_UNUSED(p_stats);
+
+	return -ENOTSUP;
+#endif
+}
+
+int npmx_driver_config_span_get(size_t index, struct npmx_driver_config_span *p_span)
+{
+	if (index >= ARRAY_SIZE(config_spans)) {
+		return -ENOENT;
+	}
+
+	*p_span = config_spans[index];
+
+	return 0;
+}
+
+int npmx_driver_config_read(const struct device *p_dev, uint8_t *p_config)
+{
+	size_t offset = 0;
+	int err = 0;
+
+	if (npmx_driver_batch_begin(p_dev) != 0) {
+		return -EBUSY;
+	}
+
+	/* Spans not fitting in the batch are read separately, still giving a consistent snapshot. */
+	(void)npmx_driver_lock(p_dev, K_FOREVER);
+
+	for (size_t i = 0; (i < ARRAY_SIZE(config_spans)) && (err == 0); i++) {
+		struct npmx_driver_config_span const *span = &config_spans[i];
+
+		err = npmx_driver_batch_read(p_dev, span->register_address, &p_config[offset],
+					     span->len);
+		offset += span->len;
+	}
+
+	__ASSERT_NO_MSG(offset == NPMX_DRIVER_CONFIG_SIZE);
+
+	err = ((npmx_driver_batch_end(p_dev) != 0) || (err != 0)) ? -EIO : 0;
+
+	npmx_driver_unlock(p_dev);
+
+	return err;
+}
+
+int npmx_driver_config_write(const struct device *p_dev, uint8_t const *p_config)
+{
+	npmx_instance_t *npmx_instance = npmx_driver_instance_get(p_dev);
+	npmx_charger_t *charger_instance = npmx_charger_get(npmx_instance, 0);
+	size_t offset = 0;
+	uint32_t modules = 0;
+	bool failed;
+
+	if (npmx_driver_batch_begin(p_dev) != 0) {
+		return -EBUSY;
+	}
+
+	(void)npmx_driver_lock(p_dev, K_FOREVER);
+
+	/* Charging parameters can be changed only with the charger disabled. */
+	failed = (npmx_charger_module_get(charger_instance, &modules) != NPMX_SUCCESS) ||
+		 (npmx_charger_module_disable_set(charger_instance,
+						  NPMX_CHARGER_MODULE_CHARGER_MASK) != NPMX_SUCCESS);
+
+	for (size_t i = 0; (i < ARRAY_SIZE(config_spans)) && !failed; i++) {
+		/* The data is only copied to the batch or sent, never modified. */
+		failed = (twi_write_function((void *)p_dev, config_spans[i].register_address,
+					     (uint8_t *)&p_config[offset],
+					     config_spans[i].len) != NPMX_SUCCESS);
+		offset += config_spans[i].len;
+	}
+
+	if (!failed && ((modules & NPMX_CHARGER_MODULE_CHARGER_MASK) != 0)) {
+		failed = (npmx_charger_module_enable_set(charger_instance,
+							 NPMX_CHARGER_MODULE_CHARGER_MASK) !=
+			  NPMX_SUCCESS);
+	}
+
+	/* The written VBUS current limit takes effect only after this task. */
+	if (!failed) {
+		failed = (npmx_vbusin_task_trigger(npmx_vbusin_get(npmx_instance, 0),
+						   NPMX_VBUSIN_TASK_APPLY_CURRENT_LIMIT) !=
+			  NPMX_SUCCESS);
+	}
+
+	failed = (npmx_driver_batch_end(p_dev) != 0) || failed;
+
+	npmx_driver_unlock(p_dev);
+
+	return failed ? -EIO : 0;
+}
+
+int npmx_driver_watchdog_start(const struct device *p_dev, npmx_timer_config_t const *p_config,
+			       uint32_t required_mask)
+{
+#if defined(CONFIG_NPMX_WATCHDOG)
+	struct npmx_data *data = p_dev->data;
+
+	return npmx_watchdog_start(&data->watchdog, p_config, required_mask);
+#else
+	ARG_UNUSED(p_dev);
+	ARG_UNUSED(p_config);
+	ARG_UNUSED(required_mask);
+
+	return -ENOTSUP;
+#endif
+}
+
+int npmx_driver_watchdog_stop(const struct device *p_dev)
+{
+#if defined(CONFIG_NPMX_WATCHDOG)
+	struct npmx_data *data = p_dev->data;
+
+	return npmx_watchdog_stop(&data->watchdog);
+#else
+	ARG_UNUSED(p_dev);
+
+	return -ENOTSUP;
+#endif
+}
+
+void npmx_driver_watchdog_checkin(const struct device *p_dev, uint32_t mask)
+{
+#if defined(CONFIG_NPMX_WATCHDOG)
+	struct npmx_data *data = p_dev->data;
+
+	npmx_watchdog_checkin(&data->watchdog, mask);
+#else
+	ARG_UNUSED(p_dev);
+	ARG_UNUSED(mask);
+#endif
+}
+
+int npmx_driver_watchdog_stats_get(const struct device *p_dev,
+				   struct npmx_driver_watchdog_stats *p_stats)
+{
+#if defined(CONFIG_NPMX_WATCHDOG)
+	struct npmx_data *data = p_dev->data;
+
+	npmx_watchdog_stats_get(&data->watchdog, p_stats);
+
+	return 0;
+#else
+	ARG_UNUSED(p_dev);
+	ARG_UNUSED(p_stats);
+
+	return -ENOTSUP;
+#endif
+}
+
+int npmx_driver_charger_state_get(const struct device *p_dev,
+				  struct npmx_driver_charger_state *p_state)
+{
+#if defined(CONFIG_NPMX_CHARGER_STATE)
+	struct npmx_data *data = p_dev->data;
+
+	npmx_charger_state_get(&data->charger_state, p_state);
+
+	return 0;
+#else
+	ARG_UNUSED(p_dev);
+	ARG_UNUSED(p_state);
+
+	return -ENOTSUP;
+#endif
+}
+
+int npmx_driver_charger_state_refresh(const struct device *p_dev)
+{
+#if defined(CONFIG_NPMX_CHARGER_STATE)
+	struct npmx_data *data = p_dev->data;
+
+	return npmx_charger_state_refresh(&data->charger_state);
+#else
+	ARG_UNUSED(p_dev);
+
+	return -ENOTSUP;
+#endif
+}
+
+int npmx_driver_buck_voltage_scale(const struct device *p_dev,
+				   struct npmx_driver_buck_voltage const *p_voltages, size_t count)
+{
+#if defined(CONFIG_NPMX_DVFS)
+	struct npmx_data *data = p_dev->data;
+
+	return npmx_dvfs_scale(&data->dvfs, p_voltages, count);
+#else
+	ARG_UNUSED(p_dev);
+	ARG_UNUSED(p_voltages);
+	ARG_UNUSED(count);
+
+	return -ENOTSUP;
+#endif
+}
+
+int npmx_driver_buck_retention_voltage_set(const struct device *p_dev,
+					   struct npmx_driver_buck_voltage const *p_voltages,
+					   size_t count)
+{
+#if defined(CONFIG_NPMX_DVFS)
+	struct npmx_data *data = p_dev->data;
+
+	return npmx_dvfs_retention_voltage_set(&data->dvfs, p_voltages, count);
+#else
+	ARG_UNUSED(p_dev);
+	ARG_UNUSED(p_voltages);
+	ARG_UNUSED(count);
+
+	return -ENOTSUP;
+#endif
+}
+
+int npmx_driver_buck_retention_select(const struct device *p_dev, bool retention)
+{
+#if defined(CONFIG_NPMX_DVFS)
+	struct npmx_data *data = p_dev->data;
+
+	return npmx_dvfs_retention_select(&data->dvfs, retention);
+#else
+	ARG_UNUSED(p_dev);
+	ARG_UNUSED(retention);
+
+	return -ENOTSUP;
+#endif
+}
+
+int npmx_driver_led_pattern_start(const struct device *p_dev, uint8_t index,
+				  struct npmx_driver_led_pattern const *p_pattern)
+{
+#if defined(CONFIG_NPMX_LED_PATTERN)
+	struct npmx_data *data = p_dev->data;
+
+	return npmx_led_pattern_start(&data->led_pattern, index, p_pattern);
+#else
+	ARG_UNUSED(p_dev);
+	ARG_UNUSED(index);
+	ARG_UNUSED(p_pattern);
+
+	return -ENOTSUP;
+#endif
+}
+
+int npmx_driver_led_pattern_stop(const struct device *p_dev, uint8_t index, bool on)
+{
+#if defined(CONFIG_NPMX_LED_PATTERN)
+	struct npmx_data *data = p_dev->data;
+
+	return npmx_led_pattern_stop(&data->led_pattern, index, on);
+#else
+	ARG_UNUSED(p_dev);
+	ARG_UNUSED(index);
+	ARG_UNUSED(on);
+
+	return -ENOTSUP;
+#endif
+}
+
+#if defined(CONFIG_NPMX_SHIP) && defined(CONFIG_NPMX_TIMER)
+/** @brief Register writes of the hibernate entry, converted before the instance is locked. */
+struct hibernate_sequence {
+	npmx_timer_config_t timer; /* Wake-up TIMER configuration. */
+	bool wake; /* Hibernate mode with TIMER wake-up, otherwise ship mode. */
+	uint32_t flags; /* Outputs disabled before the ship task. */
+};
+
+/**
+ * @brief Function for converting the wake-up time to the TIMER configuration.
+ *
+ * The fast prescaler is used if the time fits the counter, for the best resolution.
+ *
+ * @retval 0       Configuration converted.
+ * @retval -EINVAL Time too long for the counter.
+ */
+static int hibernate_timer_convert(uint32_t wake_after_ms, npmx_timer_config_t *p_config)
+{
+	static const struct {
+		npmx_timer_prescaler_t prescaler;
+		uint32_t hz;
+	} prescalers[] = {
+		{ NPMX_TIMER_PRESCALER_FAST, 512 },
+		{ NPMX_TIMER_PRESCALER_SLOW, 64 },
+	};
+
+	for (size_t i = 0; i < ARRAY_SIZE(prescalers); i++) {
+		uint64_t ticks = DIV_ROUND_UP((uint64_t)wake_after_ms * prescalers[i].hz,
+					      MSEC_PER_SEC);
+
+		if (ticks <= NPM_TIMER_COUNTER_COMPARE_VALUE_MAX) {
+			p_config->mode = NPMX_TIMER_MODE_WAKEUP;
+			p_config->prescaler = prescalers[i].prescaler;
+			p_config->compare_value = (uint32_t)ticks;
+			return 0;
 		}
+	}
 
-		if (int_gpio_interrupt_init(dev) < 0) {
-			LOG_ERR("Failed to initialize interrupt");
-			return -EIO;
+	return -EINVAL;
+}
+
+static int hibernate_sequence_issue(npmx_instance_t *p_pm, void *p_user_data)
+{
+	struct hibernate_sequence const *p_seq = p_user_data;
+	bool failed = false;
+
+	if (p_seq->wake) {
+		failed |= (npmx_timer_config_set(npmx_timer_get(p_pm, 0), &p_seq->timer) !=
+			   NPMX_SUCCESS);
+	}
+
+	for (uint8_t i = 0; i < NPM_LDSW_COUNT; i++) {
+		if ((p_seq->flags & NPMX_DRIVER_HIBERNATE_LDSW_OFF(i)) != 0) {
+			failed |= (npmx_ldsw_task_trigger(npmx_ldsw_get(p_pm, i),
+							  NPMX_LDSW_TASK_DISABLE) != NPMX_SUCCESS);
 		}
-	} else if ((config->host_int_gpio.port != NULL) && (config->pmic_int_pin == -1)) {
-		LOG_ERR("PMIC INT pin not configured");
-		return -EIO;
-	} else if ((config->host_int_gpio.port == NULL) && (config->pmic_int_pin != -1)) {
-		LOG_ERR("HOST INT pin not configured");
-		return -EIO;
 	}
 
-	if (config->pmic_reset_pin != -1) {
-		/* Configure PMIC's GPIO to work as output reset. */
-		npmx_gpio_mode_set(npmx_gpio_get(npmx_instance, config->pmic_reset_pin),
-				   NPMX_GPIO_MODE_OUTPUT_RESET);
+	for (uint8_t i = 0; i < NPM_BUCK_COUNT; i++) {
+		if ((p_seq->flags & NPMX_DRIVER_HIBERNATE_BUCK_OFF(i)) != 0) {
+			failed |= (npmx_buck_task_trigger(npmx_buck_get(p_pm, i),
+							  NPMX_BUCK_TASK_DISABLE) != NPMX_SUCCESS);
+		}
+	}
+
+	failed |= (npmx_ship_task_trigger(npmx_ship_get(p_pm, 0),
+					  p_seq->wake ? NPMX_SHIP_TASK_HIBERNATE :
+							NPMX_SHIP_TASK_SHIPMODE) != NPMX_SUCCESS);
+
+	return failed ? -EIO : 0;
+}
+#endif
+
+int npmx_driver_hibernate(const struct device *p_dev, uint32_t wake_after_ms, uint32_t flags)
+{
+#if defined(CONFIG_NPMX_SHIP) && defined(CONFIG_NPMX_TIMER)
+	const uint32_t valid_flags = (NPMX_DRIVER_HIBERNATE_LDSW_OFF(NPM_LDSW_COUNT) - 1) |
+				     (NPMX_DRIVER_HIBERNATE_BUCK_OFF(NPM_BUCK_COUNT) -
+				      NPMX_DRIVER_HIBERNATE_BUCK_OFF(0));
+	struct npmx_data *data = p_dev->data;
+	const struct npmx_config *config = p_dev->config;
+	struct hibernate_sequence seq = {
+		.wake = (wake_after_ms != 0),
+		.flags = flags,
+	};
+	int err;
+
+	if (((flags & ~valid_flags) != 0) ||
+	    (seq.wake && (hibernate_timer_convert(wake_after_ms, &seq.timer) != 0))) {
+		return -EINVAL;
+	}
+
+	/* Events are not processed while the nPM device is switching off. */
+	if (config->host_int_gpio.port != NULL) {
+		(void)gpio_pin_interrupt_configure_dt(&config->host_int_gpio, GPIO_INT_DISABLE);
+	}
+
+#if defined(CONFIG_NPMX_BOOT_CONFIG)
+	npmx_boot_config_applied_clear(config->boot_config);
+#endif
+
+	err = npmx_driver_group_run(p_dev, hibernate_sequence_issue, &seq);
+
+#if defined(CONFIG_NPMX_CACHE)
+	/* The nPM device leaves the mode with its power-on configuration. After a failure, it is
+	 * not known which accesses of the sequence have reached it.
+	 */
+	npmx_cache_invalidate(&data->cache);
+#endif
+
+	if (err != 0) {
+		LOG_ERR("%s: failed to enter hibernate mode", p_dev->name);
+
+		/* Latched events are processed and the host interrupt is enabled again. */
+		if (config->host_int_gpio.port != NULL) {
+			(void)events_work_submit(data);
+		}
 	}
 
+	return err;
+#else
+	ARG_UNUSED(p_dev);
+	ARG_UNUSED(wake_after_ms);
+	ARG_UNUSED(flags);
+
+	return -ENOTSUP;
+#endif
+}
+
+int npmx_driver_power_account_add(const struct device *p_dev,
+				  struct npmx_adc_sample const *p_samples, size_t count)
+{
+#if defined(CONFIG_NPMX_POWER_ACCOUNT)
+	struct npmx_data *data = p_dev->data;
+
+	npmx_power_account_add(&data->power_account, p_samples, count);
+
 	return 0;
-};
+#else
+	ARG_UNUSED(p_dev);
+	ARG_UNUSED(p_samples);
+	ARG_UNUSED(count);
 
-npmx_instance_t *npmx_driver_instance_get(const struct device *p_dev)
+	return -ENOTSUP;
+#endif
+}
+
+void npmx_driver_adc_sampler_register(const struct device *p_dev,
+				      struct npmx_adc_sampler *p_sampler)
 {
-	return (npmx_instance_t *)(&((struct npmx_data *)p_dev->data)->npmx_instance);
+#if defined(CONFIG_NPMX_ADC_SAMPLER)
+	struct npmx_data *data = p_dev->data;
+	k_spinlock_key_t key = k_spin_lock(&data->samplers_lock);
+
+	sys_slist_append(&data->samplers, &p_sampler->node);
+
+	k_spin_unlock(&data->samplers_lock, key);
+#else
+	ARG_UNUSED(p_dev);
+	ARG_UNUSED(p_sampler);
+#endif
+}
+
+int npmx_driver_power_state_set(const struct device *p_dev, uint8_t state)
+{
+#if defined(CONFIG_NPMX_POWER_ACCOUNT)
+	struct npmx_data *data = p_dev->data;
+
+	return npmx_power_account_state_set(&data->power_account, state);
+#else
+	ARG_UNUSED(p_dev);
+	ARG_UNUSED(state);
+
+	return -ENOTSUP;
+#endif
+}
+
+int npmx_driver_power_account_get(const struct device *p_dev,
+				  struct npmx_driver_power_account *p_account)
+{
+#if defined(CONFIG_NPMX_POWER_ACCOUNT)
+	struct npmx_data *data = p_dev->data;
+
+	npmx_power_account_get(&data->power_account, p_account);
+
+	return 0;
+#else
+	ARG_UNUSED(p_dev);
+	ARG_UNUSED(p_account);
+
+	return -ENOTSUP;
+#endif
+}
+
+int npmx_driver_power_account_reset(const struct device *p_dev)
+{
+#if defined(CONFIG_NPMX_POWER_ACCOUNT)
+	struct npmx_data *data = p_dev->data;
+
+	npmx_power_account_reset(&data->power_account);
+
+	return 0;
+#else
+	ARG_UNUSED(p_dev);
+
+	return -ENOTSUP;
+#endif
+}
+
+int npmx_driver_event_log_read(const struct device *p_dev, uint32_t *p_seq,
+			       struct npmx_driver_event_record *p_records, size_t max_count)
+{
+#if defined(CONFIG_NPMX_EVENT_LOG)
+	struct npmx_data *data = p_dev->data;
+
+	return (int)npmx_event_log_read(&data->event_log, p_seq, p_records, max_count);
+#else
+	ARG_UNUSED(p_dev);
+	ARG_UNUSED(p_seq);
+	ARG_UNUSED(p_records);
+	ARG_UNUSED(max_count);
+
+	return -ENOTSUP;
+#endif
+}
+
+int npmx_driver_event_log_storage_set(const struct device *p_dev, struct nvs_fs *p_fs,
+				      uint16_t first_id)
+{
+#if defined(CONFIG_NPMX_EVENT_LOG_NVS)
+	struct npmx_data *data = p_dev->data;
+
+	return npmx_event_log_storage_set(&data->event_log, p_fs, first_id);
+#else
+	ARG_UNUSED(p_dev);
+	ARG_UNUSED(p_fs);
+	ARG_UNUSED(first_id);
+
+	return -ENOTSUP;
+#endif
+}
+
+int npmx_driver_event_log_flush(const struct device *p_dev)
+{
+#if defined(CONFIG_NPMX_EVENT_LOG_NVS)
+	struct npmx_data *data = p_dev->data;
+
+	return npmx_event_log_flush(&data->event_log);
+#else
+	ARG_UNUSED(p_dev);
+
+	return -ENOTSUP;
+#endif
+}
+
+int npmx_driver_event_log_stored_read(const struct device *p_dev, size_t index,
+				      struct npmx_driver_event_record *p_records,
+				      size_t max_count)
+{
+#if defined(CONFIG_NPMX_EVENT_LOG_NVS)
+	struct npmx_data *data = p_dev->data;
+
+	return npmx_event_log_stored_read(&data->event_log, index, p_records, max_count);
+#else
+	ARG_UNUSED(p_dev);
+	ARG_UNUSED(index);
+	ARG_UNUSED(p_records);
+	ARG_UNUSED(max_count);
+
+	return -ENOTSUP;
+#endif
+}
+
+bool npmx_driver_warm_boot_check(const struct device *p_dev)
+{
+#if defined(CONFIG_NPMX_WARM_BOOT)
+	struct npmx_data *data = p_dev->data;
+
+	return data->warm_boot;
+#else
+	ARG_UNUSED(p_dev);
+
+	return false;
+#endif
+}
+
+void npmx_driver_cache_invalidate(const struct device *p_dev)
+{
+#if defined(CONFIG_NPMX_CACHE)
+	struct npmx_data *data = p_dev->data;
+
+	npmx_cache_invalidate(&data->cache);
+#else
+	ARG_UNUSED(p_dev);
+#endif
 }
 
 int npmx_driver_register_pof_cb(const struct device *dev, npmx_pof_config_t const *p_config,
@@ -299,7 +3059,7 @@ int npmx_driver_register_pof_cb(const struct device *dev, npmx_pof_config_t cons
 		return -EINVAL;
 	}
 
-	if (config->host_pof_gpio.port == NULL) {
+	if (!NPMX_CONFIG_HOST_POF_USED || (config->host_pof_gpio.port == NULL)) {
 		LOG_ERR("HOST POF pin not configured");
 		return -EINVAL;
 	}
@@ -329,6 +3089,67 @@ int npmx_driver_register_pof_cb(const struct device *dev, npmx_pof_config_t cons
 	return err;
 }
 
+int npmx_driver_pof_actions_set(const struct device *p_dev,
+				struct npmx_driver_pof_action const *p_actions, size_t count)
+{
+#if defined(CONFIG_NPMX_POF_ACTIONS)
+	struct npmx_data *data = p_dev->data;
+	struct npmx_pof_actions *pof = &data->pof;
+
+	if (count > CONFIG_NPMX_POF_ACTIONS_MAX) {
+		return -ENOMEM;
+	}
+
+	/* The POF thread executes no actions until the new list is complete. */
+	pof->count = 0;
+	compiler_barrier();
+
+	pof->p_actions = p_actions;
+	pof->segments_used = 0;
+	pof->buf_used = 0;
+
+	for (size_t i = 0; i < count; i++) {
+		int err = pof_action_build(p_dev, i, &p_actions[i]);
+
+		if (err != 0) {
+			LOG_ERR("Failed to build POF action %zu: %d", i, err);
+			return err;
+		}
+	}
+
+	compiler_barrier();
+	pof->count = count;
+
+	return 0;
+#else
+	ARG_UNUSED(p_dev);
+	ARG_UNUSED(p_actions);
+	ARG_UNUSED(count);
+
+	return -ENOTSUP;
+#endif
+}
+
+int npmx_driver_pof_latency_get(const struct device *p_dev,
+				struct npmx_driver_latency *p_latency)
+{
+#if defined(CONFIG_NPMX_POF_ACTIONS)
+	struct npmx_data *data = p_dev->data;
+	k_spinlock_key_t key = k_spin_lock(&data->pof.latency_lock);
+
+	*p_latency = data->pof.latency;
+
+	k_spin_unlock(&data->pof.latency_lock, key);
+
+	return 0;
+#else
+	ARG_UNUSED(p_dev);
+	ARG_UNUSED(p_latency);
+
+	return -ENOTSUP;
+#endif
+}
+
 int npmx_driver_pof_pin_get(const struct device *p_dev)
 {
 	const struct npmx_config *pmic_config = p_dev->config;
@@ -350,7 +3171,23 @@ int npmx_driver_reset_pin_get(const struct device *p_dev)
 	return pmic_config->pmic_reset_pin;
 }
 
+#if defined(CONFIG_NPMX_BOOT_CONFIG)
+#define NPMX_BOOT_CONFIG_INIT(inst) .boot_config = NPMX_BOOT_CONFIG_GET(inst),
+#else
+#define NPMX_BOOT_CONFIG_DEFINE(inst)
+#define NPMX_BOOT_CONFIG_INIT(inst)
+#endif
+
+#if defined(CONFIG_NPMX_VBUS_LIMIT)
+#define NPMX_VBUS_LIMIT_INIT(inst) .p_vbus_limit = NPMX_VBUS_LIMIT_CONFIG_GET(inst),
+#else
+#define NPMX_VBUS_LIMIT_CONFIG_DEFINE(inst)
+#define NPMX_VBUS_LIMIT_INIT(inst)
+#endif
+
 #define NPMX_DEFINE(inst)                                                                          \
+	NPMX_BOOT_CONFIG_DEFINE(inst)                                                              \
+	NPMX_VBUS_LIMIT_CONFIG_DEFINE(inst)                                                        \
 	static struct npmx_data npmx_data_##inst;                                                  \
 	static const struct npmx_config npmx_config_##inst = {                                     \
 		.i2c = I2C_DT_SPEC_INST_GET(inst),                                                 \
@@ -359,9 +3196,14 @@ int npmx_driver_reset_pin_get(const struct device *p_dev)
 		.host_pof_gpio = GPIO_DT_SPEC_INST_GET_OR(inst, host_pof_gpios, { 0 }),            \
 		.pmic_pof_pin = DT_INST_PROP_OR(inst, pmic_pof_pin, -1),                           \
 		.pmic_reset_pin = DT_INST_PROP_OR(inst, pmic_reset_pin, -1),                       \
+		.host_retention_gpio = GPIO_DT_SPEC_INST_GET_OR(inst, host_retention_gpios, { 0 }),\
+		NPMX_BOOT_CONFIG_INIT(inst)                                                        \
+		NPMX_VBUS_LIMIT_INIT(inst)                                                         \
 	};                                                                                         \
-	DEVICE_DT_INST_DEFINE(inst, npmx_driver_init, NULL, &npmx_data_##inst,                     \
-			      &npmx_config_##inst, POST_KERNEL, CONFIG_NPMX_INIT_PRIORITY, NULL);
+	PM_DEVICE_DT_INST_DEFINE(inst, npmx_driver_pm_action);                                     \
+	DEVICE_DT_INST_DEFINE(inst, npmx_driver_init, PM_DEVICE_DT_INST_GET(inst),                 \
+			      &npmx_data_##inst, &npmx_config_##inst, POST_KERNEL,                 \
+			      CONFIG_NPMX_INIT_PRIORITY, NULL);
 
 DT_INST_FOREACH_STATUS_OKAY(NPMX_DEFINE)
 
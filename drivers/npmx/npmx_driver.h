@@ -9,30 +9,1065 @@
 
 #include <npmx_instance.h>
 #include <npmx_core.h>
+#include <npmx_adc.h>
+#include <npmx_timer.h>
+#include <npmx_config.h>
 
 #include <zephyr/device.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/slist.h>
+
+/**
+ * @brief Batch completion handler.
+ *
+ * @param[in] p_dev       Pointer to the nPM Zephyr device.
+ * @param[in] result      0 if all queued accesses completed successfully, -EIO otherwise.
+ * @param[in] p_user_data User data passed to @ref npmx_driver_batch_submit.
+ */
+typedef void (*npmx_driver_batch_cb_t)(const struct device *p_dev, int result, void *p_user_data);
+
+/**
+ * @brief Group of npmx API calls run with the instance lock held.
+ *
+ * @param[in] p_pm        Pointer to the npmx instance.
+ * @param[in] p_user_data User data passed to @ref npmx_driver_group_run.
+ *
+ * @retval 0        Group completed.
+ * @retval negative Errno code returned by @ref npmx_driver_group_run.
+ */
+typedef int (*npmx_driver_group_cb_t)(npmx_instance_t *p_pm, void *p_user_data);
+
+/**
+ * @brief ADC events handler.
+ *
+ * Called when ADC events are cleared, usually from the nPM event processing context.
+ * The nPM device must not be accessed from the handler.
+ *
+ * @param[in] p_dev       Pointer to the nPM Zephyr device.
+ * @param[in] events      Mask of handled ADC events, see @ref npmx_event_group_adc_mask_t.
+ * @param[in] p_user_data User data passed to @ref npmx_driver_adc_handler_set.
+ */
+typedef void (*npmx_driver_adc_handler_t)(const struct device *p_dev, uint8_t events,
+					  void *p_user_data);
+
+/** @brief nPM events of a single callback type, delivered to event subscribers. */
+struct npmx_driver_event {
+	const struct device *p_dev; /* Pointer to the nPM Zephyr device. */
+	npmx_callback_type_t type; /* Callback type. */
+	uint8_t mask; /* Mask of all events of the type, subscribed or not. */
+	uint32_t timestamp; /* Uptime in milliseconds when the events were handled. */
+};
+
+/**
+ * @brief Event subscriber handler.
+ *
+ * Called from the nPM event processing context. The same event structure is passed to all
+ * subscribers, so it must not be modified. The nPM device can be accessed and subscribers can be
+ * added or removed from the handler.
+ *
+ * @param[in] p_event     Pointer to the events.
+ * @param[in] p_user_data User data of the subscriber.
+ */
+typedef void (*npmx_driver_event_handler_t)(struct npmx_driver_event const *p_event,
+					    void *p_user_data);
+
+/** @brief Event subscriber. */
+struct npmx_driver_event_subscriber {
+	sys_snode_t node; /* Private, used by the driver. */
+	npmx_driver_event_handler_t handler; /* Handler of subscribed events. */
+	void *p_user_data; /* User data passed to the handler. */
+	npmx_callback_type_t type; /* Subscribed callback type. */
+	uint8_t mask; /* Mask of subscribed events of the type. */
+};
+
+/**
+ * @brief Macro for defining an event subscriber.
+ *
+ * @param _name      Name of the subscriber variable.
+ * @param _type      Subscribed callback type.
+ * @param _mask      Mask of subscribed events of the type.
+ * @param _handler   Handler of subscribed events.
+ * @param _user_data User data passed to the handler.
+ */
+#define NPMX_DRIVER_EVENT_SUBSCRIBER_DEFINE(_name, _type, _mask, _handler, _user_data)             \
+	static struct npmx_driver_event_subscriber _name = {                                       \
+		.handler = (_handler),                                                             \
+		.p_user_data = (_user_data),                                                       \
+		.type = (_type),                                                                   \
+		.mask = (_mask),                                                                   \
+	}
+
+/** @brief Emergency action types executed on the power-fail warning. */
+enum npmx_driver_pof_action_type {
+	NPMX_DRIVER_POF_ACTION_CALLBACK, /* Call the handler, for example to flush data to flash. */
+	NPMX_DRIVER_POF_ACTION_LDSW_DISABLE, /* Open the load switch. */
+	NPMX_DRIVER_POF_ACTION_BUCK_DISABLE, /* Disable the BUCK converter. */
+	NPMX_DRIVER_POF_ACTION_SHIP_MODE, /* Enter the ship mode. Requires CONFIG_NPMX_SHIP. */
+};
+
+/** @brief Emergency action executed on the power-fail warning. */
+struct npmx_driver_pof_action {
+	enum npmx_driver_pof_action_type type;
+	union {
+		/* NPMX_DRIVER_POF_ACTION_CALLBACK parameters. */
+		struct {
+			void (*handler)(const struct device *p_dev, void *p_user_data);
+			void *p_user_data;
+		} callback;
+		/* Instance index for NPMX_DRIVER_POF_ACTION_LDSW_DISABLE and
+		 * NPMX_DRIVER_POF_ACTION_BUCK_DISABLE.
+		 */
+		uint8_t index;
+	};
+};
+
+/** @brief Latency statistics of handling a host interrupt. */
+struct npmx_driver_latency {
+	uint32_t last_us; /* Latency of the most recent interrupt in microseconds. */
+	uint32_t max_us; /* Maximum latency in microseconds. */
+	uint32_t count; /* Number of measured interrupts. */
+};
+
+/** @brief Size of the nPM configuration snapshot in bytes. */
+#define NPMX_DRIVER_CONFIG_SIZE NPMX_CONFIG_SETTINGS_SIZE
+
+/** @brief Span of consecutive configuration registers in the nPM configuration snapshot. */
+struct npmx_driver_config_span {
+	uint16_t register_address; /* Address of the first register. */
+	uint8_t len; /* Number of registers. */
+};
+
+/** @brief Statistics of the watchdog kicking service. */
+struct npmx_driver_watchdog_stats {
+	uint32_t kicks; /* Number of watchdog kicks. */
+	uint32_t piggybacked; /* Kicks sent together with other register accesses. */
+	uint32_t missed; /* Deadlines without a kick because required check-ins were missing. */
+	uint32_t errors; /* Kicks that failed on the bus. */
+};
+
+/** @brief Charging phases tracked by the charger state tracker. */
+enum npmx_driver_charge_phase {
+	NPMX_DRIVER_CHARGE_PHASE_IDLE, /* Not charging. */
+	NPMX_DRIVER_CHARGE_PHASE_TRICKLE, /* Trickle charging. */
+	NPMX_DRIVER_CHARGE_PHASE_CC, /* Constant current charging. */
+	NPMX_DRIVER_CHARGE_PHASE_CV, /* Constant voltage charging. */
+	NPMX_DRIVER_CHARGE_PHASE_COMPLETED, /* Charging completed. */
+	NPMX_DRIVER_CHARGE_PHASE_ERROR, /* Charging stopped by a charger error. */
+};
+
+/** @brief Charger and VBUS state kept by the charger state tracker. */
+struct npmx_driver_charger_state {
+	bool vbus_connected; /* VBUS supply connected. */
+	bool battery_connected; /* Battery detected. */
+	enum npmx_driver_charge_phase phase; /* Charging phase. */
+	uint8_t status; /* Last read charger status, see npmx_charger_status_mask_t. */
+	uint32_t vbus_timestamp; /* Uptime in milliseconds of the last VBUS change. */
+	uint32_t battery_timestamp; /* Uptime in milliseconds of the last battery change. */
+	uint32_t phase_timestamp; /* Uptime in milliseconds of the last phase change. */
+};
+
+/** @brief Requested output voltage of a BUCK converter. */
+struct npmx_driver_buck_voltage {
+	uint8_t index; /* BUCK instance index. */
+	uint16_t voltage_mv; /* Output voltage in millivolts. */
+};
+
+/**
+ * @brief Flag of @ref npmx_driver_hibernate disabling the load switch before the ship task.
+ *
+ * @param index Load switch instance index.
+ */
+#define NPMX_DRIVER_HIBERNATE_LDSW_OFF(index) BIT(index)
+
+/**
+ * @brief Flag of @ref npmx_driver_hibernate disabling the BUCK converter before the ship task.
+ *
+ * @param index BUCK instance index.
+ */
+#define NPMX_DRIVER_HIBERNATE_BUCK_OFF(index) BIT(8 + (index))
+
+/** @brief Step of an LED pattern. */
+struct npmx_driver_led_step {
+	bool on; /* LED state during the step. */
+	uint16_t duration_ms; /* Step duration, rounded up to CONFIG_NPMX_LED_PATTERN_TICK_MS. */
+};
+
+/** @brief LED pattern run by the LED pattern service. */
+struct npmx_driver_led_pattern {
+	struct npmx_driver_led_step const *p_steps; /* Steps, run one after another. */
+	uint8_t step_count; /* Number of steps, at most CONFIG_NPMX_LED_PATTERN_MAX_STEPS. */
+	uint16_t repeat; /* Number of runs of all steps, 0 to repeat until stopped. */
+};
+
+/** @brief Index of the BUCK converter in the rail usages of the power account. */
+#define NPMX_DRIVER_POWER_RAIL_BUCK(index) (index)
+
+/** @brief Index of the load switch in the rail usages of the power account. */
+#define NPMX_DRIVER_POWER_RAIL_LDSW(index) (NPM_BUCK_COUNT + (index))
+
+/** @brief Number of outputs the battery charge is attributed to. */
+#define NPMX_DRIVER_POWER_RAIL_COUNT (NPM_BUCK_COUNT + NPM_LDSW_COUNT)
+
+/** @brief Number of application power states of the power account. */
+#if defined(CONFIG_NPMX_POWER_ACCOUNT)
+#define NPMX_DRIVER_POWER_STATE_COUNT CONFIG_NPMX_POWER_ACCOUNT_STATES
+#else
+#define NPMX_DRIVER_POWER_STATE_COUNT 1
+#endif
+
+/** @brief Battery charge drawn over the accounted time. */
+struct npmx_driver_power_usage {
+	int64_t charge_uc; /* Charge in microcoulombs, the average current in mA is charge/time. */
+	int64_t time_ms; /* Accounted time in milliseconds. */
+};
+
+/** @brief Power budget integrated from battery current samples. */
+struct npmx_driver_power_account {
+	struct npmx_driver_power_usage battery; /* Charge drawn while the battery supplies. */
+	struct npmx_driver_power_usage rails[NPMX_DRIVER_POWER_RAIL_COUNT]; /* Per output. */
+	struct npmx_driver_power_usage states[NPMX_DRIVER_POWER_STATE_COUNT]; /* Per state. */
+	int64_t charged_uc; /* Charge into the battery in microcoulombs. */
+	int64_t unattributed_ms; /* Time charging or with VBUS connected, not attributed. */
+	uint32_t samples; /* Number of samples integrated. */
+	uint8_t state; /* Current application power state. */
+};
+
+struct npmx_adc_sample;
+struct npmx_adc_sampler;
+
+/** @brief Record of nPM events of a single callback type, stored in the event log. */
+struct npmx_driver_event_record {
+	uint32_t seq; /* Sequence number of the record, counted from the driver initialization. */
+	uint32_t timestamp; /* Uptime in milliseconds when the events were handled. */
+	uint8_t type; /* Callback type, see npmx_callback_type_t. */
+	uint8_t mask; /* Mask of events. */
+};
+
+struct nvs_fs;
+
+/** @brief Number of peripherals distinguished by the bus statistics. */
+#define NPMX_DRIVER_BUS_STATS_PERIPHERALS 16U
+
+/** @brief Bus usage counters of a group of registers. */
+struct npmx_driver_bus_counters {
+	uint32_t reads; /* Number of read bus segments. */
+	uint32_t writes; /* Number of write bus segments. */
+	uint32_t bytes; /* Number of data bytes, register addresses excluded. */
+	uint32_t errors; /* Number of bus segments of failed transfers. */
+};
+
+/** @brief Bus usage counters of the register span starting at the given address. */
+struct npmx_driver_bus_register_stats {
+	uint16_t register_address; /* Address of the first register of the span. */
+	struct npmx_driver_bus_counters counters;
+};
+
+/** @brief Bus usage statistics of the nPM device. */
+struct npmx_driver_bus_stats {
+	uint32_t transfers; /* Number of I2C transfers. */
+	uint32_t errors; /* Number of failed I2C transfers. */
+	uint32_t min_us; /* Shortest transfer duration in microseconds. */
+	uint32_t avg_us; /* Average transfer duration in microseconds. */
+	uint32_t max_us; /* Longest transfer duration in microseconds. */
+	uint64_t total_us; /* Total duration of all transfers in microseconds. */
+	uint32_t saved_reads; /* Register reads served without a bus transfer. */
+	uint32_t untracked; /* Bus segments not counted per register, as the table was full. */
+	struct npmx_driver_bus_counters total; /* Counters of all bus segments. */
+	/* Counters indexed by the base address of the peripheral, the upper byte of the register
+	 * address. Registers of higher bases are counted in the last entry.
+	 */
+	struct npmx_driver_bus_counters peripherals[NPMX_DRIVER_BUS_STATS_PERIPHERALS];
+};
+
+/** @brief Bus error recovery counters of the nPM device. */
+struct npmx_driver_bus_recovery_stats {
+	uint32_t retries; /* Number of retries of failed transfers. */
+	uint32_t recovered; /* Transfers completed by a retry. */
+	uint32_t failed; /* Transfers failed after all retries. */
+	uint32_t bus_recoveries; /* Successful bus recoveries with i2c_recover_bus. */
+	uint32_t resyncs; /* Event processing repeated after failed transfers. */
+};
 
 /**
  * @brief Function for getting a pointer to the npmx instance.
  *
+ * The instance can be used from several threads, each register access is serialized. Sequences
+ * of npmx API calls which have to be atomic are run with @ref npmx_driver_group_run.
+ *
  * @param[in] p_dev Pointer to the nPM Zephyr device.
  *
  * @return Pointer to the npmx instance.
  */
 npmx_instance_t *npmx_driver_instance_get(const struct device *p_dev);
 
+/**
+ * @brief Function for opening a batch of register accesses.
+ *
+ * Until @ref npmx_driver_batch_end is called, register writes issued by the calling thread,
+ * also through npmx API functions, are queued and sent together in a single I2C transfer with
+ * repeated START between accesses. Writes and reads of consecutive register spans are merged
+ * into burst transfers. A read issued through npmx API functions sends all queued accesses
+ * together with the read, because its value is needed immediately.
+ * Other threads access the device as usual.
+ *
+ * A single batch can be open for each device. If another thread has opened it, the function
+ * waits up to CONFIG_NPMX_BATCH_WAIT_MS for it to be sent. It does not wait in an interrupt
+ * handler or while the calling thread holds the instance lock, see @ref npmx_driver_lock.
+ *
+ * If CONFIG_NPMX_BATCH is disabled, all accesses are performed immediately.
+ *
+ * @param[in] p_dev Pointer to the nPM Zephyr device.
+ *
+ * @retval 0      Batch opened.
+ * @retval -EBUSY Batch already opened by the calling thread, or not sent by another thread in
+ *                time.
+ */
+int npmx_driver_batch_begin(const struct device *p_dev);
+
+/**
+ * @brief Function for queuing a raw register read in the open batch.
+ *
+ * The data is available in @p p_data after @ref npmx_driver_batch_end returns.
+ *
+ * @param[in]  p_dev            Pointer to the nPM Zephyr device.
+ * @param[in]  register_address Address of the first register.
+ * @param[out] p_data           Pointer to the buffer for the register values.
+ * @param[in]  num_of_bytes     Number of registers to be read.
+ *
+ * @retval 0       Read queued or already completed.
+ * @retval -EINVAL Batch not opened by the calling thread.
+ * @retval -EIO    Error using IO bus line.
+ */
+int npmx_driver_batch_read(const struct device *p_dev, uint32_t register_address,
+			   uint8_t *p_data, size_t num_of_bytes);
+
+/**
+ * @brief Function for sending all queued register accesses and closing the batch.
+ *
+ * @param[in] p_dev Pointer to the nPM Zephyr device.
+ *
+ * @retval 0       All queued accesses completed successfully.
+ * @retval -EINVAL Batch not opened by the calling thread.
+ * @retval -EIO    Error using IO bus line.
+ */
+int npmx_driver_batch_end(const struct device *p_dev);
+
+/**
+ * @brief Function for sending all queued register accesses without waiting for completion.
+ *
+ * The batch is closed and the calling thread can continue while the I2C transfer is ongoing.
+ * The completion handler is called from the I2C driver callback context, usually an interrupt,
+ * and data of queued reads is available in the destination buffers when it is called.
+ * No new batch can be opened until the transfer completes.
+ *
+ * If CONFIG_NPMX_ASYNC is disabled, or the I2C bus driver does not support asynchronous
+ * transfers, the accesses are sent immediately and the handler is called before the function
+ * returns.
+ *
+ * @param[in] p_dev       Pointer to the nPM Zephyr device.
+ * @param[in] cb          Completion handler, can be NULL.
+ * @param[in] p_user_data User data passed to the completion handler.
+ *
+ * @retval 0       Transfer started, result is reported to the completion handler.
+ * @retval -EINVAL Batch not opened by the calling thread.
+ * @retval -EIO    Error using IO bus line.
+ */
+int npmx_driver_batch_submit(const struct device *p_dev, npmx_driver_batch_cb_t cb,
+			     void *p_user_data);
+
+/**
+ * @brief Function for taking the instance lock of the nPM device.
+ *
+ * Each register access of the npmx instance takes the lock, so while a thread holds it, accesses
+ * of all other threads wait, including event processing of the driver. Used to make sequences of
+ * npmx API calls atomic, for example read-modify-write of registers shared with other threads.
+ * The lock can be taken recursively. It has priority inheritance, so a lower priority holder
+ * runs at the priority of the waiting event processing thread until it releases the lock.
+ *
+ * The holder must not wait for nPM events, as they are not processed until the lock is
+ * released. Emergency actions of CONFIG_NPMX_POF_ACTIONS do not wait for the lock.
+ *
+ * @param[in] p_dev   Pointer to the nPM Zephyr device.
+ * @param[in] timeout Maximum time to wait for the lock.
+ *
+ * @retval 0       Lock taken.
+ * @retval -EBUSY  Lock held by another thread, with K_NO_WAIT.
+ * @retval -EAGAIN Waiting for the lock timed out.
+ */
+int npmx_driver_lock(const struct device *p_dev, k_timeout_t timeout);
+
+/**
+ * @brief Function for releasing the instance lock taken with @ref npmx_driver_lock.
+ *
+ * @param[in] p_dev Pointer to the nPM Zephyr device.
+ */
+void npmx_driver_unlock(const struct device *p_dev);
+
+/**
+ * @brief Function for running a group of npmx API calls atomically.
+ *
+ * The group is called with the instance lock held, see @ref npmx_driver_lock. Its register
+ * writes are sent in a batch, unless a batch is already open, see @ref npmx_driver_batch_begin.
+ *
+ * @param[in] p_dev       Pointer to the nPM Zephyr device.
+ * @param[in] cb          Group of npmx API calls.
+ * @param[in] p_user_data User data passed to the group.
+ *
+ * @retval 0        Group completed.
+ * @retval -EIO     Error using IO bus line when sending the batch.
+ * @retval negative Errno code returned by the group.
+ */
+int npmx_driver_group_run(const struct device *p_dev, npmx_driver_group_cb_t cb,
+			  void *p_user_data);
+
+/**
+ * @brief Function for triggering the ADC measurement and waiting for its completion.
+ *
+ * If the host interrupt is configured, the calling thread sleeps until the ADC events are
+ * reported through it. Interrupts of the ADC events are enabled for the time of the wait.
+ * Otherwise, the ADC events are checked every millisecond.
+ *
+ * Results are read afterwards with npmx_adc_meas_get or npmx_adc_meas_all_get.
+ *
+ * @param[in] p_dev      Pointer to the nPM Zephyr device.
+ * @param[in] task       ADC task to be triggered.
+ * @param[in] event_mask Mask of ADC events to wait for, see @ref npmx_event_group_adc_mask_t.
+ * @param[in] timeout_ms Maximum time to wait in milliseconds.
+ *
+ * @retval 0          Measurement completed.
+ * @retval -EINVAL    Empty event mask.
+ * @retval -ETIMEDOUT Measurement not completed in time.
+ * @retval -EIO       Error using IO bus line.
+ */
+int npmx_driver_adc_meas_wait(const struct device *p_dev, npmx_adc_task_t task,
+			      uint8_t event_mask, uint32_t timeout_ms);
+
+/**
+ * @brief Function for triggering several ADC measurements and waiting for their completion.
+ *
+ * Works as @ref npmx_driver_adc_meas_wait, with all tasks triggered in a single I2C transfer
+ * when CONFIG_NPMX_BATCH is enabled.
+ *
+ * @param[in] p_dev      Pointer to the nPM Zephyr device.
+ * @param[in] p_tasks    Pointer to the array of ADC tasks to be triggered.
+ * @param[in] task_count Number of ADC tasks.
+ * @param[in] event_mask Mask of ADC events to wait for, see @ref npmx_event_group_adc_mask_t.
+ * @param[in] timeout_ms Maximum time to wait in milliseconds.
+ *
+ * @retval 0          Measurements completed.
+ * @retval -EINVAL    Empty event mask or no tasks.
+ * @retval -ETIMEDOUT Measurements not completed in time.
+ * @retval -EIO       Error using IO bus line.
+ */
+int npmx_driver_adc_tasks_wait(const struct device *p_dev, npmx_adc_task_t const *p_tasks,
+			       size_t task_count, uint8_t event_mask, uint32_t timeout_ms);
+
+/**
+ * @brief Function for setting the handler of ADC events.
+ *
+ * With the host interrupt configured, the handler is called for ADC events with interrupts
+ * enabled, as only those are handled by the nPM event processing.
+ *
+ * @param[in] p_dev       Pointer to the nPM Zephyr device.
+ * @param[in] handler     ADC events handler, NULL to remove the handler.
+ * @param[in] p_user_data User data passed to the handler.
+ */
+void npmx_driver_adc_handler_set(const struct device *p_dev, npmx_driver_adc_handler_t handler,
+				 void *p_user_data);
+
+/**
+ * @brief Function for subscribing to nPM events.
+ *
+ * Any number of subscribers can be added for each callback type. The subscriber is called with
+ * events of its type passed to the generic callback of the driver, if any of them is in its
+ * mask. Events of callback types with a callback registered with npmx_core_register_cb() are
+ * not delivered, unless the registered callback calls the generic callback.
+ *
+ * The subscriber can be removed from its own handler.
+ *
+ * @param[in] p_dev        Pointer to the nPM Zephyr device.
+ * @param[in] p_subscriber Pointer to the subscriber, kept by the driver until it is removed.
+ *
+ * @retval 0         Subscriber added.
+ * @retval -EINVAL   Invalid callback type or no handler.
+ * @retval -EALREADY Subscriber already added.
+ */
+int npmx_driver_event_subscribe(const struct device *p_dev,
+				struct npmx_driver_event_subscriber *p_subscriber);
+
+/**
+ * @brief Function for removing the event subscriber.
+ *
+ * The handler of the subscriber is not called after the function returns. If the handler is
+ * running in another thread, the function waits for it to return, so it must not be called while
+ * holding a resource the handler waits for.
+ *
+ * @param[in] p_dev        Pointer to the nPM Zephyr device.
+ * @param[in] p_subscriber Pointer to the subscriber.
+ *
+ * @retval 0       Subscriber removed.
+ * @retval -ENOENT Subscriber not added.
+ */
+int npmx_driver_event_unsubscribe(const struct device *p_dev,
+				  struct npmx_driver_event_subscriber *p_subscriber);
+
+/**
+ * @brief Function for reading the interrupt latency statistics.
+ *
+ * @param[in]  p_dev     Pointer to the nPM Zephyr device.
+ * @param[out] p_latency Pointer to the structure for the statistics.
+ *
+ * @retval 0        Statistics read.
+ * @retval -ENOTSUP CONFIG_NPMX_INT_LATENCY is disabled.
+ */
+int npmx_driver_latency_get(const struct device *p_dev, struct npmx_driver_latency *p_latency);
+
+/**
+ * @brief Function for clearing the interrupt latency statistics.
+ *
+ * @param[in] p_dev Pointer to the nPM Zephyr device.
+ */
+void npmx_driver_latency_reset(const struct device *p_dev);
+
+/**
+ * @brief Function for checking if the boot configuration was skipped at init.
+ *
+ * With CONFIG_NPMX_WARM_BOOT enabled, the devicetree boot configuration is not written again
+ * after a SoC reset if it is unchanged and the nPM device has kept it. The application can use
+ * this function to skip its own configuration sequence in the same case.
+ *
+ * @param[in] p_dev Pointer to the nPM Zephyr device.
+ *
+ * @retval true  Boot configuration kept by the nPM device was found at init.
+ * @retval false Boot configuration was applied at init, or CONFIG_NPMX_WARM_BOOT is disabled.
+ */
+bool npmx_driver_warm_boot_check(const struct device *p_dev);
+
+/**
+ * @brief Function for invalidating the register cache.
+ *
+ * Has to be called when the nPM device may have lost its configuration without the SoC being
+ * reset, for example after the nPM reset or after exiting the ship mode.
+ * Does nothing if CONFIG_NPMX_CACHE is disabled.
+ *
+ * @param[in] p_dev Pointer to the nPM Zephyr device.
+ */
+void npmx_driver_cache_invalidate(const struct device *p_dev);
+
 /**
  * @brief Function for configuring power fail comparator and registering callback handler.
  *
  * @param[in] dev      Pointer to nPM Zephyr device.
  * @param[in] p_config Pointer to POF configuration structure.
- * @param[in] p_cb     Pointer to POF callback handler.
+ * @param[in] p_cb     Pointer to POF callback handler. Called from the GPIO interrupt, or from
+ *                     the POF thread if CONFIG_NPMX_POF_ACTIONS is enabled.
  *
  * @return Error code if error occurred, or 0 if succeeded.
  */
 int npmx_driver_register_pof_cb(const struct device *dev, npmx_pof_config_t const *p_config,
 				void (*p_cb)(npmx_instance_t *p_pm));
 
+/**
+ * @brief Function for setting the list of emergency actions executed on the power-fail warning.
+ *
+ * Actions are executed in order by a thread of the highest priority, woken up by the POF host
+ * interrupt. I2C messages of all register actions are built by this function, so nothing is
+ * computed when the warning occurs. Actions are executed after the callback registered with
+ * @ref npmx_driver_register_pof_cb, which is also called from that thread.
+ *
+ * @param[in] p_dev     Pointer to the nPM Zephyr device.
+ * @param[in] p_actions Pointer to the array of actions. Has to stay valid while it is set.
+ * @param[in] count     Number of actions, 0 to clear the list.
+ *
+ * @retval 0        Actions set.
+ * @retval -EINVAL  Invalid action.
+ * @retval -ENOMEM  Messages of the actions do not fit in the buffers.
+ * @retval -EBUSY   Batch of another thread not sent in time.
+ * @retval -ENOTSUP CONFIG_NPMX_POF_ACTIONS is disabled.
+ */
+int npmx_driver_pof_actions_set(const struct device *p_dev,
+				struct npmx_driver_pof_action const *p_actions, size_t count);
+
+/**
+ * @brief Function for getting the power-fail warning latency statistics.
+ *
+ * The latency is measured from the POF host interrupt to the completion of all emergency
+ * actions.
+ *
+ * @param[in]  p_dev     Pointer to the nPM Zephyr device.
+ * @param[out] p_latency Pointer to the structure for the statistics.
+ *
+ * @retval 0        Statistics read.
+ * @retval -ENOTSUP CONFIG_NPMX_POF_ACTIONS is disabled.
+ */
+int npmx_driver_pof_latency_get(const struct device *p_dev,
+				struct npmx_driver_latency *p_latency);
+
+/**
+ * @brief Function for reading the bus usage statistics.
+ *
+ * @param[in]  p_dev   Pointer to the nPM Zephyr device.
+ * @param[out] p_stats Pointer to the structure for the statistics.
+ *
+ * @retval 0        Statistics read.
+ * @retval -ENOTSUP CONFIG_NPMX_STATS is disabled.
+ */
+int npmx_driver_bus_stats_get(const struct device *p_dev, struct npmx_driver_bus_stats *p_stats);
+
+/**
+ * @brief Function for reading the bus usage counters of a single register span.
+ *
+ * Register spans are numbered in the order of their first access.
+ *
+ * @param[in]  p_dev   Pointer to the nPM Zephyr device.
+ * @param[in]  index   Index of the register span.
+ * @param[out] p_stats Pointer to the structure for the counters.
+ *
+ * @retval 0        Counters read.
+ * @retval -ENOENT  No register span with such index.
+ * @retval -ENOTSUP CONFIG_NPMX_STATS is disabled.
+ */
+int npmx_driver_bus_register_stats_get(const struct device *p_dev, size_t index,
+				       struct npmx_driver_bus_register_stats *p_stats);
+
+/**
+ * @brief Function for clearing the bus usage statistics.
+ *
+ * @param[in] p_dev Pointer to the nPM Zephyr device.
+ */
+void npmx_driver_bus_stats_reset(const struct device *p_dev);
+
+/**
+ * @brief Function for reading the bus error recovery counters.
+ *
+ * Failed I2C transfers are retried with backoff, with the bus recovered before each retry after
+ * the first one. If a transfer done while processing events fails after all retries, the host
+ * interrupt is kept disabled and all events are read again after CONFIG_NPMX_BUS_RESYNC_DELAY_MS,
+ * so latched events are not lost and do not fire the interrupt repeatedly. Asynchronous batch
+ * transfers are not retried.
+ *
+ * @param[in]  p_dev   Pointer to the nPM Zephyr device.
+ * @param[out] p_stats Pointer to the structure for the counters.
+ *
+ * @retval 0        Counters read.
+ * @retval -ENOTSUP CONFIG_NPMX_BUS_RETRY is disabled.
+ */
+int npmx_driver_bus_recovery_stats_get(const struct device *p_dev,
+				       struct npmx_driver_bus_recovery_stats *p_stats);
+
+/**
+ * @brief Function for getting a span of registers included in the nPM configuration snapshot.
+ *
+ * Spans are stored in the snapshot one after another, in the order of their indices.
+ *
+ * @param[in]  index  Index of the span.
+ * @param[out] p_span Pointer to the structure for the span.
+ *
+ * @retval 0       Span read.
+ * @retval -ENOENT No span with such index.
+ */
+int npmx_driver_config_span_get(size_t index, struct npmx_driver_config_span *p_span);
+
+/**
+ * @brief Function for reading all configuration registers of the nPM device.
+ *
+ * Registers are read in a batch, as a single I2C transfer if they fit in it, or from the
+ * register cache if CONFIG_NPMX_CACHE is enabled.
+ *
+ * @param[in]  p_dev    Pointer to the nPM Zephyr device.
+ * @param[out] p_config Pointer to the buffer for the snapshot, of @ref NPMX_DRIVER_CONFIG_SIZE
+ *                      bytes.
+ *
+ * @retval 0      Configuration read.
+ * @retval -EBUSY Batch of another thread not sent in time.
+ * @retval -EIO   Error using IO bus line.
+ */
+int npmx_driver_config_read(const struct device *p_dev, uint8_t *p_config);
+
+/**
+ * @brief Function for writing all configuration registers of the nPM device.
+ *
+ * Registers are written in a batch, in the order of spans. The snapshot is expected to be taken
+ * with @ref npmx_driver_config_read, from a device with the same firmware.
+ *
+ * The charger is disabled while its parameters are written and enabled again afterwards if it was
+ * enabled before. The written VBUS current limit is applied at the end.
+ *
+ * @param[in] p_dev    Pointer to the nPM Zephyr device.
+ * @param[in] p_config Pointer to the snapshot of @ref NPMX_DRIVER_CONFIG_SIZE bytes.
+ *
+ * @retval 0      Configuration written.
+ * @retval -EBUSY Batch of another thread not sent in time.
+ * @retval -EIO   Error using IO bus line.
+ */
+int npmx_driver_config_write(const struct device *p_dev, uint8_t const *p_config);
+
+/**
+ * @brief Function for configuring the TIMER as watchdog and kicking it from the driver.
+ *
+ * The kick interval is computed from the prescaler and the compare value, leaving
+ * CONFIG_NPMX_WATCHDOG_MARGIN_PERCENT of the watchdog period as a margin. A single kick is sent
+ * per interval from the system work queue. Once CONFIG_NPMX_WATCHDOG_PIGGYBACK_PERCENT of the
+ * interval has elapsed, the kick is instead added to the next batch of register accesses sent
+ * to the device, and the deadline restarts from there.
+ *
+ * If @p required_mask is not 0, the watchdog is kicked only after all its bits have been set
+ * with @ref npmx_driver_watchdog_checkin since the previous kick. A deadline with missing
+ * check-ins stops kicking, so the watchdog expires.
+ *
+ * @param[in] p_dev         Pointer to the nPM Zephyr device.
+ * @param[in] p_config      Pointer to the TIMER configuration, in one of the watchdog modes.
+ * @param[in] required_mask Check-in bits required before each kick, one per monitored thread.
+ *
+ * @retval 0        Watchdog started.
+ * @retval -EINVAL  Invalid configuration.
+ * @retval -EIO     Error using IO bus line.
+ * @retval -ENOTSUP CONFIG_NPMX_WATCHDOG is disabled.
+ */
+int npmx_driver_watchdog_start(const struct device *p_dev, npmx_timer_config_t const *p_config,
+			       uint32_t required_mask);
+
+/**
+ * @brief Function for stopping kicking the watchdog and disabling the TIMER.
+ *
+ * @param[in] p_dev Pointer to the nPM Zephyr device.
+ *
+ * @retval 0        Watchdog stopped.
+ * @retval -EIO     Error using IO bus line.
+ * @retval -ENOTSUP CONFIG_NPMX_WATCHDOG is disabled.
+ */
+int npmx_driver_watchdog_stop(const struct device *p_dev);
+
+/**
+ * @brief Function for reporting liveness of application threads to the watchdog service.
+ *
+ * Can be called from any context, no bus access is done.
+ *
+ * @param[in] p_dev Pointer to the nPM Zephyr device.
+ * @param[in] mask  Check-in bits of the calling thread.
+ */
+void npmx_driver_watchdog_checkin(const struct device *p_dev, uint32_t mask);
+
+/**
+ * @brief Function for reading the watchdog kicking service statistics.
+ *
+ * @param[in]  p_dev   Pointer to the nPM Zephyr device.
+ * @param[out] p_stats Pointer to the structure for the statistics.
+ *
+ * @retval 0        Statistics read.
+ * @retval -ENOTSUP CONFIG_NPMX_WATCHDOG is disabled.
+ */
+int npmx_driver_watchdog_stats_get(const struct device *p_dev,
+				   struct npmx_driver_watchdog_stats *p_stats);
+
+/**
+ * @brief Function for getting the charger and VBUS state.
+ *
+ * The state is kept by the driver from VBUSIN, battery and charger status events, enabled at
+ * initialization, so no bus access is done. Can be called from any context. Events of callback
+ * types with a callback registered with npmx_core_register_cb() are not seen by the tracker,
+ * unless the registered callback calls the generic callback.
+ *
+ * @param[in]  p_dev   Pointer to the nPM Zephyr device.
+ * @param[out] p_state Pointer to the structure for the state.
+ *
+ * @retval 0        State copied.
+ * @retval -ENOTSUP CONFIG_NPMX_CHARGER_STATE is disabled.
+ */
+int npmx_driver_charger_state_get(const struct device *p_dev,
+				  struct npmx_driver_charger_state *p_state);
+
+/**
+ * @brief Function for reading the charger and VBUS state from the nPM device.
+ *
+ * Used when events cannot be received, for example without the host interrupt configured.
+ *
+ * @param[in] p_dev Pointer to the nPM Zephyr device.
+ *
+ * @retval 0        State updated.
+ * @retval -EIO     Error using IO bus line.
+ * @retval -ENOTSUP CONFIG_NPMX_CHARGER_STATE is disabled.
+ */
+int npmx_driver_charger_state_refresh(const struct device *p_dev);
+
+/**
+ * @brief Function for changing normal output voltages of BUCK converters together.
+ *
+ * All requests are checked before any register is written. The voltages and the software output
+ * voltage selection of all raised BUCKs are written in a single batch, followed by the lowered
+ * BUCKs in another batch once the raised outputs settle. The function returns when all outputs
+ * settle, after the time computed from the largest voltage step, CONFIG_NPMX_DVFS_SETTLE_TIME_US
+ * and CONFIG_NPMX_DVFS_SLEW_RATE.
+ *
+ * The last set voltages are kept by the driver, so the device is read only at the first change
+ * of each BUCK. Voltages changed with other functions are not seen.
+ *
+ * @param[in] p_dev      Pointer to the nPM Zephyr device.
+ * @param[in] p_voltages Pointer to the requested voltages, at most one per BUCK.
+ * @param[in] count      Number of requested voltages.
+ *
+ * @retval 0        Voltages changed and settled.
+ * @retval -EINVAL  Invalid BUCK index, repeated BUCK, or voltage not supported by the device.
+ * @retval -EBUSY   Retention voltages selected, or batch of another thread not sent in time.
+ * @retval -EIO     Error using IO bus line.
+ * @retval -ENOTSUP CONFIG_NPMX_DVFS is disabled.
+ */
+int npmx_driver_buck_voltage_scale(const struct device *p_dev,
+				   struct npmx_driver_buck_voltage const *p_voltages, size_t count);
+
+/**
+ * @brief Function for changing retention output voltages of BUCK converters in a single batch.
+ *
+ * Used to prepare the voltages selected with @ref npmx_driver_buck_retention_select. If the
+ * retention voltages are selected, the function returns when the outputs settle.
+ *
+ * @param[in] p_dev      Pointer to the nPM Zephyr device.
+ * @param[in] p_voltages Pointer to the requested voltages, at most one per BUCK.
+ * @param[in] count      Number of requested voltages.
+ *
+ * @retval 0        Voltages changed.
+ * @retval -EINVAL  Invalid BUCK index, repeated BUCK, or voltage not supported by the device.
+ * @retval -EBUSY   Batch of another thread not sent in time.
+ * @retval -EIO     Error using IO bus line.
+ * @retval -ENOTSUP CONFIG_NPMX_DVFS is disabled.
+ */
+int npmx_driver_buck_retention_voltage_set(const struct device *p_dev,
+					   struct npmx_driver_buck_voltage const *p_voltages,
+					   size_t count);
+
+/**
+ * @brief Function for switching BUCK converters between normal and retention voltages.
+ *
+ * The switch is done with the host GPIO from the host-retention-gpios devicetree property,
+ * without bus access. The nPM GPIO driven by it has to be configured as the retention input of
+ * the BUCKs, for example with npmx_buck_retention_gpio_config_set(). The function returns when
+ * the outputs settle.
+ *
+ * @param[in] p_dev     Pointer to the nPM Zephyr device.
+ * @param[in] retention True to select retention voltages, false to select normal voltages.
+ *
+ * @retval 0        Voltages selected and settled.
+ * @retval -EIO     Error using IO bus line when reading voltages not set yet.
+ * @retval -ENOTSUP CONFIG_NPMX_DVFS is disabled, or host-retention-gpios is not set.
+ * @retval other    Errno codes of the GPIO driver.
+ */
+int npmx_driver_buck_retention_select(const struct device *p_dev, bool retention);
+
+/**
+ * @brief Function for running a pattern on the LED in the host mode.
+ *
+ * The pattern is converted to a timeline of state changes on the grid of
+ * CONFIG_NPMX_LED_PATTERN_TICK_MS ticks, shared by all LEDs. The driver wakes up only at
+ * ticks where the state of any LED changes, and writes all LEDs changed at the tick in a single
+ * batch. A pattern with one state, or with consecutive steps of the same state, needs no wake-ups
+ * for them. After the last run of a pattern with a limited number of runs, the LED is
+ * switched off.
+ *
+ * @param[in] p_dev     Pointer to the nPM Zephyr device.
+ * @param[in] index     LED index.
+ * @param[in] p_pattern Pointer to the pattern. Steps are copied, so the pattern does not have to
+ *                      be kept.
+ *
+ * @retval 0        Pattern started, replacing the previous pattern of the LED.
+ * @retval -EINVAL  Invalid LED index, no steps, or too many steps.
+ * @retval -EIO     Error using IO bus line.
+ * @retval -ENOTSUP CONFIG_NPMX_LED_PATTERN is disabled.
+ */
+int npmx_driver_led_pattern_start(const struct device *p_dev, uint8_t index,
+				  struct npmx_driver_led_pattern const *p_pattern);
+
+/**
+ * @brief Function for stopping the LED pattern and setting the LED state.
+ *
+ * @param[in] p_dev Pointer to the nPM Zephyr device.
+ * @param[in] index LED index.
+ * @param[in] on    True to leave the LED on, false to leave it off.
+ *
+ * @retval 0        Pattern stopped, or no pattern was running.
+ * @retval -EINVAL  Invalid LED index.
+ * @retval -EIO     Error using IO bus line.
+ * @retval -ENOTSUP CONFIG_NPMX_LED_PATTERN is disabled.
+ */
+int npmx_driver_led_pattern_stop(const struct device *p_dev, uint8_t index, bool on);
+
+/**
+ * @brief Function for entering the hibernate mode, with wake-up by the TIMER, or the ship mode.
+ *
+ * The wake-up TIMER configuration, the disabling of the outputs selected in @p flags and the
+ * ship task are written in a single batch, with the host interrupt disabled and the npmx
+ * instance locked, so no other access is sent in between. Outputs are disabled in order of
+ * load switches, then BUCKs. The BUCK supplying the host must not be selected, as the ship task
+ * would not be sent. The nPM device leaves the hibernate and ship modes with its power-on
+ * configuration, so with CONFIG_NPMX_WARM_BOOT the boot configuration is applied again on the
+ * next boot. The register cache of CONFIG_NPMX_CACHE is invalidated.
+ *
+ * After the mode is entered, the host interrupt is left disabled. The nPM device loses the
+ * interrupt GPIO mode with the rest of its configuration, so a host that stays powered has to
+ * initialize the nPM device again, for example by rebooting, before events are delivered.
+ *
+ * @param[in] p_dev         Pointer to the nPM Zephyr device.
+ * @param[in] wake_after_ms Time in the hibernate mode, after which the TIMER wakes the nPM
+ *                          device. 0 to enter the ship mode, left only with the SHPHLD button
+ *                          or VBUS connection.
+ * @param[in] flags         Outputs disabled before the ship task, a mask of
+ *                          @ref NPMX_DRIVER_HIBERNATE_LDSW_OFF and
+ *                          @ref NPMX_DRIVER_HIBERNATE_BUCK_OFF.
+ *
+ * @retval 0        Mode entered, the nPM device switches off its outputs.
+ * @retval -EINVAL  Wake-up time beyond the TIMER range, or invalid output in @p flags.
+ * @retval -EIO     Error using IO bus line, the host interrupt is enabled again.
+ * @retval -ENOTSUP CONFIG_NPMX_SHIP or CONFIG_NPMX_TIMER is disabled.
+ */
+int npmx_driver_hibernate(const struct device *p_dev, uint32_t wake_after_ms, uint32_t flags);
+
+/**
+ * @brief Function for integrating battery current samples into the power account.
+ *
+ * Called by the consumer of the ADC sampler with the samples it takes, so that the fuel gauge
+ * and the power account work from the same measurements. The battery current is integrated
+ * between consecutive samples with the trapezoidal rule. The charge of each interval is added
+ * to the BUCK and load switch outputs enabled at its start, and to the application power
+ * states set with @ref npmx_driver_power_state_set during it. The battery current is measured
+ * for the whole system, so the usage of an output is the charge drawn while it was enabled,
+ * not its own consumption. Intervals in which the battery is charging, or with
+ * CONFIG_NPMX_CHARGER_STATE also the VBUS is connected, are not attributed. Intervals across
+ * a sampling restart are skipped.
+ *
+ * @param[in] p_dev     Pointer to the nPM Zephyr device.
+ * @param[in] p_samples Pointer to the samples, oldest first.
+ * @param[in] count     Number of samples.
+ *
+ * @retval 0        Samples integrated.
+ * @retval -ENOTSUP CONFIG_NPMX_POWER_ACCOUNT is disabled.
+ */
+int npmx_driver_power_account_add(const struct device *p_dev,
+				  struct npmx_adc_sample const *p_samples, size_t count);
+
+/**
+ * @brief Function for registering the ADC sampler with the nPM device.
+ *
+ * Called by npmx_adc_sampler_init. Registered samplers are paused while the device is suspended
+ * with CONFIG_PM_DEVICE. Samplers cannot be unregistered.
+ *
+ * @param[in] p_dev     Pointer to the nPM Zephyr device.
+ * @param[in] p_sampler Pointer to the ADC sampler instance.
+ */
+void npmx_driver_adc_sampler_register(const struct device *p_dev,
+				      struct npmx_adc_sampler *p_sampler);
+
+/**
+ * @brief Function for setting the application power state the battery charge is attributed to.
+ *
+ * Can be called from interrupt context. Only the last change between two samples is tracked,
+ * the time up to it is attributed to the state it replaces.
+ *
+ * @param[in] p_dev Pointer to the nPM Zephyr device.
+ * @param[in] state Power state, lower than CONFIG_NPMX_POWER_ACCOUNT_STATES.
+ *
+ * @retval 0        State set.
+ * @retval -EINVAL  Invalid state.
+ * @retval -ENOTSUP CONFIG_NPMX_POWER_ACCOUNT is disabled.
+ */
+int npmx_driver_power_state_set(const struct device *p_dev, uint8_t state);
+
+/**
+ * @brief Function for copying the power account.
+ *
+ * @param[in]  p_dev     Pointer to the nPM Zephyr device.
+ * @param[out] p_account Pointer to the structure for the account.
+ *
+ * @retval 0        Account copied.
+ * @retval -ENOTSUP CONFIG_NPMX_POWER_ACCOUNT is disabled.
+ */
+int npmx_driver_power_account_get(const struct device *p_dev,
+				  struct npmx_driver_power_account *p_account);
+
+/**
+ * @brief Function for clearing the power account.
+ *
+ * The current power state is kept and the next interval starts at the next sample.
+ *
+ * @param[in] p_dev Pointer to the nPM Zephyr device.
+ *
+ * @retval 0        Account cleared.
+ * @retval -ENOTSUP CONFIG_NPMX_POWER_ACCOUNT is disabled.
+ */
+int npmx_driver_power_account_reset(const struct device *p_dev);
+
+/**
+ * @brief Function for reading records from the event log.
+ *
+ * The log keeps the last CONFIG_NPMX_EVENT_LOG_SIZE records of events passed to the generic
+ * callback of the driver. Can be called from any context, also while events are being logged.
+ * Records overwritten before they are read are skipped, which the caller can detect from the
+ * gaps in sequence numbers.
+ *
+ * @param[in]     p_dev     Pointer to the nPM Zephyr device.
+ * @param[in,out] p_seq     Pointer to the sequence number of the first record to be read, set to
+ *                          the sequence number following the last read record. Pass 0 to read
+ *                          from the oldest record, UINT32_MAX to get the next sequence number.
+ * @param[out]    p_records Pointer to the array for records, oldest first.
+ * @param[in]     max_count Maximum number of records to be read.
+ *
+ * @retval non-negative Number of read records.
+ * @retval -ENOTSUP     CONFIG_NPMX_EVENT_LOG is disabled.
+ */
+int npmx_driver_event_log_read(const struct device *p_dev, uint32_t *p_seq,
+			       struct npmx_driver_event_record *p_records, size_t max_count);
+
+/**
+ * @brief Function for attaching NVS storage to the event log.
+ *
+ * Records are written to the storage in blocks of CONFIG_NPMX_EVENT_LOG_NVS_BLOCK_SIZE records,
+ * from the system work queue, using CONFIG_NPMX_EVENT_LOG_NVS_BLOCKS NVS entries starting at
+ * @p first_id in rotation. Blocks written before the reset are kept until they are overwritten.
+ * Records logged before the storage is attached are written with the first block.
+ *
+ * @param[in] p_dev    Pointer to the nPM Zephyr device.
+ * @param[in] p_fs     Pointer to the mounted NVS file system.
+ * @param[in] first_id First NVS entry identifier used by the event log.
+ *
+ * @retval 0         Storage attached.
+ * @retval -EALREADY Storage already attached.
+ * @retval -ENOTSUP  CONFIG_NPMX_EVENT_LOG_NVS is disabled.
+ */
+int npmx_driver_event_log_storage_set(const struct device *p_dev, struct nvs_fs *p_fs,
+				      uint16_t first_id);
+
+/**
+ * @brief Function for writing records not yet stored to the event log NVS storage.
+ *
+ * Used before a planned power-off, as blocks are otherwise written only when full.
+ *
+ * @param[in] p_dev Pointer to the nPM Zephyr device.
+ *
+ * @retval 0        Records written.
+ * @retval -ENODEV  Storage not attached.
+ * @retval -EIO     Error writing to the storage.
+ * @retval -ENOTSUP CONFIG_NPMX_EVENT_LOG_NVS is disabled.
+ */
+int npmx_driver_event_log_flush(const struct device *p_dev);
+
+/**
+ * @brief Function for reading a block of records from the event log NVS storage.
+ *
+ * Sequence numbers of records are counted from the initialization of the driver in the boot in
+ * which the records were logged, so they restart in blocks written after a reset.
+ *
+ * @param[in]  p_dev     Pointer to the nPM Zephyr device.
+ * @param[in]  index     Index of the block, 0 for the most recently written one.
+ * @param[out] p_records Pointer to the array for records, oldest first.
+ * @param[in]  max_count Maximum number of records to be read.
+ *
+ * @retval non-negative Number of read records.
+ * @retval -ENODEV      Storage not attached.
+ * @retval -ENOENT      No block with the given index is stored.
+ * @retval -ENOTSUP     CONFIG_NPMX_EVENT_LOG_NVS is disabled.
+ */
+int npmx_driver_event_log_stored_read(const struct device *p_dev, size_t index,
+				      struct npmx_driver_event_record *p_records,
+				      size_t max_count);
+
 /**
  * @brief Function for getting POF pin index from nPM Zephyr device.
  *
@@ -0,0 +1,358 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <npmx_buck.h>
+#include "npmx_dvfs.h"
+
+#include <stdlib.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(NPMX, CONFIG_NPMX_LOG_LEVEL);
+
+/**
+ * @brief Function for checking the requested voltages and converting them to a table indexed by
+ *        the BUCK instance index.
+ *
+ * @param[in]  p_voltages  Pointer to the requested voltages.
+ * @param[in]  count       Number of requested voltages.
+ * @param[out] p_target_mv Pointer to the table of voltages, 0 for BUCKs not requested.
+ *
+ * @retval 0       Voltages converted.
+ * @retval -EINVAL Invalid BUCK index, repeated BUCK, or voltage not supported by the device.
+ */
+static int targets_get(struct npmx_driver_buck_voltage const *p_voltages, size_t count,
+		       uint16_t *p_target_mv)
+{
+	for (size_t i = 0; i < NPM_BUCK_COUNT; i++) {
+		p_target_mv[i] = 0;
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		uint8_t index = p_voltages[i].index;
+		npmx_buck_voltage_t voltage = npmx_buck_voltage_convert(p_voltages[i].voltage_mv);
+		uint32_t voltage_mv;
+
+		if ((index >= NPM_BUCK_COUNT) || (p_target_mv[index] != 0) ||
+		    (voltage == NPMX_BUCK_VOLTAGE_INVALID) ||
+		    !npmx_buck_voltage_convert_to_mv(voltage, &voltage_mv)) {
+			return -EINVAL;
+		}
+
+		p_target_mv[index] = (uint16_t)voltage_mv;
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Function for getting the last set voltage of the BUCK, read from the device if unknown.
+ *
+ * @param[in] p_dvfs    Pointer to the voltage scaling state.
+ * @param[in] index     BUCK instance index.
+ * @param[in] retention True for the retention voltage, false for the normal voltage.
+ *
+ * @return Voltage in millivolts, or -EIO if reading failed.
+ */
+static int voltage_get(struct npmx_dvfs *p_dvfs, uint8_t index, bool retention)
+{
+	uint16_t *p_mv = retention ? &p_dvfs->retention_mv[index] : &p_dvfs->normal_mv[index];
+	npmx_buck_t *buck_instance = npmx_buck_get(npmx_driver_instance_get(p_dvfs->p_dev), index);
+	npmx_buck_voltage_t voltage;
+	npmx_error_t err_code;
+	uint32_t voltage_mv;
+
+	if (*p_mv != 0) {
+		return *p_mv;
+	}
+
+	/* The status holds the output voltage also when it is selected with the VSET pin. */
+	err_code = retention ? npmx_buck_retention_voltage_get(buck_instance, &voltage) :
+			       npmx_buck_status_voltage_get(buck_instance, &voltage);
+
+	if ((err_code != NPMX_SUCCESS) || !npmx_buck_voltage_convert_to_mv(voltage, &voltage_mv)) {
+		return -EIO;
+	}
+
+	*p_mv = (uint16_t)voltage_mv;
+
+	return *p_mv;
+}
+
+static void settle_wait(struct npmx_dvfs *p_dvfs, uint32_t step_mv)
+{
+	uint32_t settle_us = CONFIG_NPMX_DVFS_SETTLE_TIME_US +
+			     ((step_mv * USEC_PER_MSEC) / CONFIG_NPMX_DVFS_SLEW_RATE);
+
+	LOG_DBG("%s: BUCK voltage step %u mV, settling %u us", p_dvfs->p_dev->name, step_mv,
+		settle_us);
+
+	k_usleep(settle_us);
+}
+
+/**
+ * @brief Function for writing voltages of the selected BUCKs in a single batch.
+ *
+ * @param[in] p_dvfs      Pointer to the voltage scaling state.
+ * @param[in] p_target_mv Pointer to the table of voltages, 0 for BUCKs not written.
+ * @param[in] mask        Mask of BUCKs to be written.
+ * @param[in] retention   True for retention voltages, false for normal voltages.
+ *
+ * @retval 0      Voltages written.
+ * @retval -EBUSY Batch of another thread not sent in time.
+ * @retval -EIO   Error using IO bus line.
+ */
+static int voltages_write(struct npmx_dvfs *p_dvfs, uint16_t const *p_target_mv, uint32_t mask,
+			  bool retention)
+{
+	npmx_instance_t *npmx_instance = npmx_driver_instance_get(p_dvfs->p_dev);
+	bool failed = false;
+	int err;
+
+	err = npmx_driver_batch_begin(p_dvfs->p_dev);
+	if (err != 0) {
+		return err;
+	}
+
+	for (uint8_t i = 0; (i < NPM_BUCK_COUNT) && !failed; i++) {
+		npmx_buck_t *buck_instance = npmx_buck_get(npmx_instance, i);
+		npmx_buck_voltage_t voltage = npmx_buck_voltage_convert(p_target_mv[i]);
+
+		if ((mask & BIT(i)) == 0) {
+			continue;
+		}
+
+		if (retention) {
+			failed = (npmx_buck_retention_voltage_set(buck_instance, voltage) !=
+				  NPMX_SUCCESS);
+		} else {
+			/* The normal voltage is applied when the software selection is written. */
+			failed = (npmx_buck_normal_voltage_set(buck_instance, voltage) !=
+				  NPMX_SUCCESS) ||
+				 (npmx_buck_vout_select_set(buck_instance,
+							    NPMX_BUCK_VOUT_SELECT_SOFTWARE) !=
+				  NPMX_SUCCESS);
+		}
+	}
+
+	err = npmx_driver_batch_end(p_dvfs->p_dev);
+
+	for (uint8_t i = 0; i < NPM_BUCK_COUNT; i++) {
+		uint16_t *p_mv = retention ? &p_dvfs->retention_mv[i] : &p_dvfs->normal_mv[i];
+
+		if ((mask & BIT(i)) != 0) {
+			/* After a failure, the voltage is read from the device next time. */
+			*p_mv = (failed || (err != 0)) ? 0 : p_target_mv[i];
+		}
+	}
+
+	return (failed || (err != 0)) ? -EIO : 0;
+}
+
+static int scale_locked(struct npmx_dvfs *p_dvfs, uint16_t const *p_target_mv)
+{
+	uint32_t up_mask = 0;
+	uint32_t down_mask = 0;
+	uint32_t up_mv = 0;
+	uint32_t down_mv = 0;
+	int err;
+
+	if (p_dvfs->retention) {
+		return -EBUSY;
+	}
+
+	for (uint8_t i = 0; i < NPM_BUCK_COUNT; i++) {
+		int current_mv;
+
+		if (p_target_mv[i] == 0) {
+			continue;
+		}
+
+		current_mv = voltage_get(p_dvfs, i, false);
+		if (current_mv < 0) {
+			return current_mv;
+		}
+
+		if (p_target_mv[i] > current_mv) {
+			up_mask |= BIT(i);
+			up_mv = MAX(up_mv, p_target_mv[i] - current_mv);
+		} else if (p_target_mv[i] < current_mv) {
+			down_mask |= BIT(i);
+			down_mv = MAX(down_mv, current_mv - p_target_mv[i]);
+		}
+	}
+
+	/* Raised outputs settle before any output is lowered, so that outputs which have to stay
+	 * above other outputs do not cross them during the change.
+	 */
+	if (up_mask != 0) {
+		err = voltages_write(p_dvfs, p_target_mv, up_mask, false);
+		if (err != 0) {
+			return err;
+		}
+
+		settle_wait(p_dvfs, up_mv);
+	}
+
+	if (down_mask != 0) {
+		err = voltages_write(p_dvfs, p_target_mv, down_mask, false);
+		if (err != 0) {
+			return err;
+		}
+
+		settle_wait(p_dvfs, down_mv);
+	}
+
+	return 0;
+}
+
+static int retention_voltage_set_locked(struct npmx_dvfs *p_dvfs, uint16_t const *p_target_mv)
+{
+	uint32_t mask = 0;
+	uint32_t step_mv = 0;
+	int err;
+
+	for (uint8_t i = 0; i < NPM_BUCK_COUNT; i++) {
+		int current_mv;
+
+		if (p_target_mv[i] == 0) {
+			continue;
+		}
+
+		mask |= BIT(i);
+
+		if (p_dvfs->retention) {
+			/* Retention voltages are the outputs now, so they have to settle. */
+			current_mv = voltage_get(p_dvfs, i, true);
+			if (current_mv < 0) {
+				return current_mv;
+			}
+
+			step_mv = MAX(step_mv, (uint32_t)abs(p_target_mv[i] - current_mv));
+		}
+	}
+
+	if (mask == 0) {
+		return 0;
+	}
+
+	err = voltages_write(p_dvfs, p_target_mv, mask, true);
+	if (err != 0) {
+		return err;
+	}
+
+	if (p_dvfs->retention) {
+		settle_wait(p_dvfs, step_mv);
+	}
+
+	return 0;
+}
+
+static int retention_select_locked(struct npmx_dvfs *p_dvfs, bool retention)
+{
+	uint32_t step_mv = 0;
+	int err;
+
+	if (p_dvfs->retention == retention) {
+		return 0;
+	}
+
+	for (uint8_t i = 0; i < NPM_BUCK_COUNT; i++) {
+		int normal_mv = voltage_get(p_dvfs, i, false);
+		int retention_mv = voltage_get(p_dvfs, i, true);
+
+		if ((normal_mv < 0) || (retention_mv < 0)) {
+			return -EIO;
+		}
+
+		step_mv = MAX(step_mv, (uint32_t)abs(normal_mv - retention_mv));
+	}
+
+	err = gpio_pin_set_dt(p_dvfs->p_retention_gpio, retention ? 1 : 0);
+	if (err != 0) {
+		return err;
+	}
+
+	p_dvfs->retention = retention;
+
+	settle_wait(p_dvfs, step_mv);
+
+	return 0;
+}
+
+int npmx_dvfs_init(struct npmx_dvfs *p_dvfs, const struct device *p_dev,
+		   const struct gpio_dt_spec *p_retention_gpio)
+{
+	p_dvfs->p_dev = p_dev;
+	p_dvfs->p_retention_gpio = p_retention_gpio;
+	p_dvfs->retention = false;
+
+	for (size_t i = 0; i < NPM_BUCK_COUNT; i++) {
+		p_dvfs->normal_mv[i] = 0;
+		p_dvfs->retention_mv[i] = 0;
+	}
+
+	k_mutex_init(&p_dvfs->lock);
+
+	if (p_retention_gpio == NULL) {
+		return 0;
+	}
+
+	if (!device_is_ready(p_retention_gpio->port)) {
+		return -ENODEV;
+	}
+
+	return gpio_pin_configure_dt(p_retention_gpio, GPIO_OUTPUT_INACTIVE);
+}
+
+int npmx_dvfs_scale(struct npmx_dvfs *p_dvfs, struct npmx_driver_buck_voltage const *p_voltages,
+		    size_t count)
+{
+	uint16_t target_mv[NPM_BUCK_COUNT];
+	int err = targets_get(p_voltages, count, target_mv);
+
+	if (err != 0) {
+		return err;
+	}
+
+	k_mutex_lock(&p_dvfs->lock, K_FOREVER);
+	err = scale_locked(p_dvfs, target_mv);
+	k_mutex_unlock(&p_dvfs->lock);
+
+	return err;
+}
+
+int npmx_dvfs_retention_voltage_set(struct npmx_dvfs *p_dvfs,
+				    struct npmx_driver_buck_voltage const *p_voltages,
+				    size_t count)
+{
+	uint16_t target_mv[NPM_BUCK_COUNT];
+	int err = targets_get(p_voltages, count, target_mv);
+
+	if (err != 0) {
+		return err;
+	}
+
+	k_mutex_lock(&p_dvfs->lock, K_FOREVER);
+	err = retention_voltage_set_locked(p_dvfs, target_mv);
+	k_mutex_unlock(&p_dvfs->lock);
+
+	return err;
+}
+
+int npmx_dvfs_retention_select(struct npmx_dvfs *p_dvfs, bool retention)
+{
+	int err;
+
+	if (p_dvfs->p_retention_gpio == NULL) {
+		return -ENOTSUP;
+	}
+
+	k_mutex_lock(&p_dvfs->lock, K_FOREVER);
+	err = retention_select_locked(p_dvfs, retention);
+	k_mutex_unlock(&p_dvfs->lock);
+
+	return err;
+}
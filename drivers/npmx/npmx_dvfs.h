@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef ZEPHYR_DRIVERS_NPMX_NPMX_DVFS_H__
+#define ZEPHYR_DRIVERS_NPMX_NPMX_DVFS_H__
+
+#include <npmx_driver.h>
+
+#include <zephyr/device.h>
+#include <zephyr/drivers/gpio.h>
+#include <zephyr/kernel.h>
+
+/** @brief BUCK voltage scaling state. All fields are private. */
+struct npmx_dvfs {
+	const struct device *p_dev; /* Pointer to the nPM Zephyr device. */
+	const struct gpio_dt_spec *p_retention_gpio; /* Host GPIO selecting retention, or NULL. */
+	struct k_mutex lock; /* Serializes voltage changes. */
+	bool retention; /* Retention voltages selected with the host GPIO. */
+	uint16_t normal_mv[NPM_BUCK_COUNT]; /* Last set normal voltages, 0 if unknown. */
+	uint16_t retention_mv[NPM_BUCK_COUNT]; /* Last set retention voltages, 0 if unknown. */
+};
+
+/**
+ * @brief Function for initializing the voltage scaling state.
+ *
+ * The host GPIO, if any, is configured as an output with normal voltages selected.
+ *
+ * @param[in] p_dvfs           Pointer to the voltage scaling state.
+ * @param[in] p_dev            Pointer to the nPM Zephyr device.
+ * @param[in] p_retention_gpio Pointer to the host GPIO selecting retention voltages, or NULL.
+ *
+ * @retval 0       On success.
+ * @retval -ENODEV GPIO device not ready.
+ * @retval other   Errno codes of the GPIO configuration.
+ */
+int npmx_dvfs_init(struct npmx_dvfs *p_dvfs, const struct device *p_dev,
+		   const struct gpio_dt_spec *p_retention_gpio);
+
+/**
+ * @brief Function for changing normal voltages of BUCK converters, see
+ *        @ref npmx_driver_buck_voltage_scale.
+ */
+int npmx_dvfs_scale(struct npmx_dvfs *p_dvfs, struct npmx_driver_buck_voltage const *p_voltages,
+		    size_t count);
+
+/**
+ * @brief Function for changing retention voltages of BUCK converters, see
+ *        @ref npmx_driver_buck_retention_voltage_set.
+ */
+int npmx_dvfs_retention_voltage_set(struct npmx_dvfs *p_dvfs,
+				    struct npmx_driver_buck_voltage const *p_voltages,
+				    size_t count);
+
+/**
+ * @brief Function for switching BUCK converters between normal and retention voltages, see
+ *        @ref npmx_driver_buck_retention_select.
+ */
+int npmx_dvfs_retention_select(struct npmx_dvfs *p_dvfs, bool retention);
+
+#endif /* ZEPHYR_DRIVERS_NPMX_NPMX_DVFS_H__ */
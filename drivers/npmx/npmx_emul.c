@@ -0,0 +1,405 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <npmx_config.h>
+#include <npmx_core.h>
+
+#include "npmx_emul.h"
+
+#include <zephyr/device.h>
+#include <zephyr/drivers/emul.h>
+#include <zephyr/drivers/gpio.h>
+#include <zephyr/drivers/i2c.h>
+#include <zephyr/drivers/i2c_emul.h>
+#include <zephyr/sys/byteorder.h>
+
+#if defined(CONFIG_GPIO_EMUL)
+#include <zephyr/drivers/gpio/gpio_emul.h>
+#endif
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(NPMX, CONFIG_NPMX_LOG_LEVEL);
+
+#define DT_DRV_COMPAT nordic_npmx_npm1300
+
+/* Number of registers of each peripheral. */
+#define PERIPHERAL_SIZE 0x100U
+
+/* Size of the emulated register file. */
+#define REGS_SIZE (NPMX_EMUL_PERIPHERALS * PERIPHERAL_SIZE)
+
+/* Address of the TASKSWRESET register. */
+#define TASK_SW_RESET_ADDR 0x0001U
+
+/* Address of the first ADC task register, TASKVBATMEASURE. */
+#define ADC_TASKS_ADDR 0x0500U
+
+/* Events raised in the EVENTSADC register when the conversion started by each ADC task is done. */
+static const uint8_t adc_task_events[] = {
+	[0] = BIT(0), /* TASKVBATMEASURE: EVENTADCVBATRDY. */
+	[1] = BIT(1), /* TASKNTCMEASURE: EVENTADCNTCRDY. */
+	[2] = BIT(2), /* TASKTEMPMEASURE: EVENTADCTEMPRDY. */
+	[3] = BIT(3), /* TASKVSYSMEASURE: EVENTADCVSYSRDY. */
+	[6] = BIT(6), /* TASKIBATMEASURE: EVENTADCIBATRDY. */
+	[7] = BIT(7), /* TASKVBUS7MEASURE: EVENTADCVBUS7RDY. */
+	[8] = BIT(0), /* TASKDELAYEDVBATMEASURE: EVENTADCVBATRDY. */
+};
+
+/* Addresses of the EVENTS*SET registers of event groups, in npmx_event_group_t order. Kept apart
+ * from the driver configuration, so that a wrong map in the driver is not hidden.
+ */
+static const uint16_t event_group_addrs[] = {
+	0x0002, /* EVENTSADCSET. */
+	0x0006, /* EVENTSBCHARGER0SET. */
+	0x000A, /* EVENTSBCHARGER1SET. */
+	0x000E, /* EVENTSBCHARGER2SET. */
+	0x0012, /* EVENTSSHPHLDSET. */
+	0x0016, /* EVENTSVBUSIN0SET. */
+	0x001A, /* EVENTSVBUSIN1SET. */
+	0x0022, /* EVENTSGPIOSET. */
+};
+
+BUILD_ASSERT(ARRAY_SIZE(event_group_addrs) == NPMX_EVENT_GROUP_COUNT);
+
+struct npmx_emul_data {
+	const struct emul *target;
+	struct k_spinlock lock;
+	uint8_t regs[REGS_SIZE]; /* Register file, indexed by the register address. */
+	uint8_t adc_pending; /* EVENTSADC events of ongoing conversions. */
+	struct k_work_delayable adc_work;
+	bool int_active; /* Current state of the host interrupt line. */
+	uint32_t transfer_count;
+	uint32_t segment_count; /* Register accesses in all transfers. */
+	uint32_t fail_count; /* Number of next transfers to fail. */
+	uint32_t sw_reset_count; /* Software resets requested with TASKSWRESET. */
+};
+
+struct npmx_emul_config {
+	const struct gpio_dt_spec host_int_gpio;
+};
+
+static bool regs_range_check(uint32_t register_address, size_t num_of_bytes)
+{
+	return (register_address + num_of_bytes) <= REGS_SIZE;
+}
+
+static uint16_t event_group_address(size_t group)
+{
+	return event_group_addrs[group];
+}
+
+/* Events are read from both EVENTS*SET and EVENTS*CLR, interrupt enables from both INTEN*SET and
+ * INTEN*CLR, so each pair is kept with the same value.
+ */
+static void events_set(struct npmx_emul_data *data, size_t group, uint8_t events)
+{
+	uint16_t address = event_group_address(group);
+
+	data->regs[address] = events;
+	data->regs[address + NPMX_CONFIG_EVENT_GROUP_CLR_OFFSET] = events;
+}
+
+static void int_enable_set(struct npmx_emul_data *data, size_t group, uint8_t mask)
+{
+	uint16_t address = event_group_address(group);
+
+	data->regs[address + NPMX_CONFIG_EVENT_GROUP_INTENSET_OFFSET] = mask;
+	data->regs[address + NPMX_CONFIG_EVENT_GROUP_INTENCLR_OFFSET] = mask;
+}
+
+/**
+ * @brief Function for handling the write of an event or interrupt enable register.
+ *
+ * @retval true  Register handled.
+ * @retval false Register is not an event or interrupt enable register.
+ */
+static bool event_reg_write(struct npmx_emul_data *data, uint16_t register_address, uint8_t value)
+{
+	for (size_t group = 0; group < ARRAY_SIZE(event_group_addrs); group++) {
+		uint16_t address = event_group_address(group);
+		uint8_t events = data->regs[address];
+		uint8_t enabled = data->regs[address + NPMX_CONFIG_EVENT_GROUP_INTENSET_OFFSET];
+
+		if ((register_address < address) ||
+		    (register_address > (address + NPMX_CONFIG_EVENT_GROUP_INTENCLR_OFFSET))) {
+			continue;
+		}
+
+		switch (register_address - address) {
+		case 0:
+			events_set(data, group, events | value);
+			break;
+		case NPMX_CONFIG_EVENT_GROUP_CLR_OFFSET:
+			events_set(data, group, events & ~value);
+			break;
+		case NPMX_CONFIG_EVENT_GROUP_INTENSET_OFFSET:
+			int_enable_set(data, group, enabled | value);
+			break;
+		case NPMX_CONFIG_EVENT_GROUP_INTENCLR_OFFSET:
+			int_enable_set(data, group, enabled & ~value);
+			break;
+		default:
+			break;
+		}
+
+		return true;
+	}
+
+	return false;
+}
+
+static void reg_write(struct npmx_emul_data *data, uint16_t register_address, uint8_t value)
+{
+	if (event_reg_write(data, register_address, value)) {
+		return;
+	}
+
+	if (register_address == TASK_SW_RESET_ADDR) {
+		/* The register file is kept, so that tests can check what triggered the reset. */
+		if (value != 0) {
+			data->sw_reset_count++;
+			LOG_WRN("Emulated software reset requested");
+		}
+		return;
+	}
+
+	if ((register_address >= ADC_TASKS_ADDR) &&
+	    (register_address < (ADC_TASKS_ADDR + ARRAY_SIZE(adc_task_events)))) {
+		/* Task registers read as 0, the result is reported with an event. */
+		if (value != 0) {
+			data->adc_pending |= adc_task_events[register_address - ADC_TASKS_ADDR];
+			(void)k_work_schedule(&data->adc_work,
+					      K_USEC(CONFIG_NPMX_EMUL_ADC_CONVERSION_US));
+		}
+		return;
+	}
+
+	data->regs[register_address] = value;
+}
+
+/* Drives the host interrupt line if any event has its interrupt enabled. */
+static void int_update(const struct emul *target)
+{
+	const struct npmx_emul_config *config = target->cfg;
+	struct npmx_emul_data *data = target->data;
+	bool active = false;
+	bool changed;
+	k_spinlock_key_t key = k_spin_lock(&data->lock);
+
+	for (size_t group = 0; group < ARRAY_SIZE(event_group_addrs); group++) {
+		uint16_t address = event_group_address(group);
+
+		if ((data->regs[address] &
+		     data->regs[address + NPMX_CONFIG_EVENT_GROUP_INTENSET_OFFSET]) != 0) {
+			active = true;
+		}
+	}
+
+	changed = (active != data->int_active);
+	data->int_active = active;
+
+	k_spin_unlock(&data->lock, key);
+
+	if (!changed || (config->host_int_gpio.port == NULL)) {
+		return;
+	}
+
+#if defined(CONFIG_GPIO_EMUL)
+	bool active_low = (config->host_int_gpio.dt_flags & GPIO_ACTIVE_LOW) != 0;
+
+	(void)gpio_emul_input_set(config->host_int_gpio.port, config->host_int_gpio.pin,
+				  active != active_low);
+#endif
+}
+
+static void adc_work_handler(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct npmx_emul_data *data = CONTAINER_OF(dwork, struct npmx_emul_data, adc_work);
+	k_spinlock_key_t key = k_spin_lock(&data->lock);
+
+	events_set(data, NPMX_EVENT_GROUP_ADC,
+		   data->regs[event_group_address(NPMX_EVENT_GROUP_ADC)] | data->adc_pending);
+	data->adc_pending = 0;
+
+	k_spin_unlock(&data->lock, key);
+
+	int_update(data->target);
+}
+
+/* Each segment is the register address followed by data to be read or written, either in the
+ * same message or in the next one.
+ */
+static int npmx_emul_transfer(const struct emul *target, struct i2c_msg *msgs, int num_msgs,
+			      int addr)
+{
+	struct npmx_emul_data *data = target->data;
+	int err = 0;
+	k_spinlock_key_t key = k_spin_lock(&data->lock);
+
+	ARG_UNUSED(addr);
+
+	data->transfer_count++;
+
+	if (data->fail_count > 0) {
+		data->fail_count--;
+		k_spin_unlock(&data->lock, key);
+		return -EIO;
+	}
+
+	for (int i = 0; (i < num_msgs) && (err == 0); i++) {
+		if (((msgs[i].flags & I2C_MSG_READ) != 0) || (msgs[i].len < 2)) {
+			LOG_ERR("Emulator: register address expected");
+			err = -EIO;
+			break;
+		}
+
+		uint16_t register_address = sys_get_be16(msgs[i].buf);
+		uint8_t *p_data = &msgs[i].buf[2];
+		size_t num_of_bytes = msgs[i].len - 2;
+		bool read = false;
+
+		data->segment_count++;
+
+		if ((num_of_bytes == 0) && ((i + 1) < num_msgs)) {
+			i++;
+			p_data = msgs[i].buf;
+			num_of_bytes = msgs[i].len;
+			read = (msgs[i].flags & I2C_MSG_READ) != 0;
+		}
+
+		if (!regs_range_check(register_address, num_of_bytes)) {
+			LOG_ERR("Emulator: no register at 0x%04X", register_address);
+			err = -EIO;
+		} else if (read) {
+			memcpy(p_data, &data->regs[register_address], num_of_bytes);
+		} else {
+			for (size_t j = 0; j < num_of_bytes; j++) {
+				reg_write(data, register_address + j, p_data[j]);
+			}
+		}
+	}
+
+	k_spin_unlock(&data->lock, key);
+
+	int_update(target);
+
+	return err;
+}
+
+int npmx_emul_reg_set(const struct emul *target, uint16_t register_address, uint8_t const *p_data,
+		      size_t num_of_bytes)
+{
+	struct npmx_emul_data *data = target->data;
+
+	if (!regs_range_check(register_address, num_of_bytes)) {
+		return -EINVAL;
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&data->lock);
+
+	memcpy(&data->regs[register_address], p_data, num_of_bytes);
+
+	k_spin_unlock(&data->lock, key);
+
+	int_update(target);
+
+	return 0;
+}
+
+int npmx_emul_reg_get(const struct emul *target, uint16_t register_address, uint8_t *p_data,
+		      size_t num_of_bytes)
+{
+	struct npmx_emul_data *data = target->data;
+
+	if (!regs_range_check(register_address, num_of_bytes)) {
+		return -EINVAL;
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&data->lock);
+
+	memcpy(p_data, &data->regs[register_address], num_of_bytes);
+
+	k_spin_unlock(&data->lock, key);
+
+	return 0;
+}
+
+int npmx_emul_event_raise(const struct emul *target, uint8_t group, uint8_t mask)
+{
+	struct npmx_emul_data *data = target->data;
+
+	if (group >= ARRAY_SIZE(event_group_addrs)) {
+		return -EINVAL;
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&data->lock);
+
+	events_set(data, group, data->regs[event_group_address(group)] | mask);
+
+	k_spin_unlock(&data->lock, key);
+
+	int_update(target);
+
+	return 0;
+}
+
+uint32_t npmx_emul_transfer_count_get(const struct emul *target)
+{
+	struct npmx_emul_data *data = target->data;
+
+	return data->transfer_count;
+}
+
+uint32_t npmx_emul_segment_count_get(const struct emul *target)
+{
+	struct npmx_emul_data *data = target->data;
+
+	return data->segment_count;
+}
+
+void npmx_emul_transfer_fail_set(const struct emul *target, uint32_t count)
+{
+	struct npmx_emul_data *data = target->data;
+	k_spinlock_key_t key = k_spin_lock(&data->lock);
+
+	data->fail_count = count;
+
+	k_spin_unlock(&data->lock, key);
+}
+
+uint32_t npmx_emul_sw_reset_count_get(const struct emul *target)
+{
+	struct npmx_emul_data *data = target->data;
+
+	return data->sw_reset_count;
+}
+
+static int npmx_emul_init(const struct emul *target, const struct device *parent)
+{
+	struct npmx_emul_data *data = target->data;
+
+	ARG_UNUSED(parent);
+
+	data->target = target;
+	k_work_init_delayable(&data->adc_work, adc_work_handler);
+
+	return 0;
+}
+
+static const struct i2c_emul_api npmx_emul_api = {
+	.transfer = npmx_emul_transfer,
+};
+
+#define NPMX_EMUL_DEFINE(inst)                                                                     \
+	static struct npmx_emul_data npmx_emul_data_##inst;                                        \
+	static const struct npmx_emul_config npmx_emul_config_##inst = {                           \
+		.host_int_gpio = GPIO_DT_SPEC_INST_GET_OR(inst, host_int_gpios, { 0 }),            \
+	};                                                                                         \
+	EMUL_DT_INST_DEFINE(inst, npmx_emul_init, &npmx_emul_data_##inst,                          \
+			    &npmx_emul_config_##inst, &npmx_emul_api, NULL);
+
+DT_INST_FOREACH_STATUS_OKAY(NPMX_EMUL_DEFINE)
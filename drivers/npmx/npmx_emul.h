@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef ZEPHYR_DRIVERS_NPMX_NPMX_EMUL_H__
+#define ZEPHYR_DRIVERS_NPMX_NPMX_EMUL_H__
+
+#include <zephyr/drivers/emul.h>
+
+/** @brief Number of peripherals in the emulated register file. */
+#define NPMX_EMUL_PERIPHERALS 16U
+
+/**
+ * @brief Function for setting emulated register values without a bus transfer.
+ *
+ * Used to provide status and measurement result registers read by the driver. Event and interrupt
+ * enable registers are written as they are, without the SET/CLR semantics.
+ *
+ * @param[in] target           Pointer to the nPM emulator.
+ * @param[in] register_address Address of the first register.
+ * @param[in] p_data           Pointer to the register values.
+ * @param[in] num_of_bytes     Number of registers to be set.
+ *
+ * @retval 0       Registers set.
+ * @retval -EINVAL Registers out of the emulated register file.
+ */
+int npmx_emul_reg_set(const struct emul *target, uint16_t register_address, uint8_t const *p_data,
+		      size_t num_of_bytes);
+
+/**
+ * @brief Function for getting emulated register values without a bus transfer.
+ *
+ * @param[in]  target           Pointer to the nPM emulator.
+ * @param[in]  register_address Address of the first register.
+ * @param[out] p_data           Pointer to the buffer for the register values.
+ * @param[in]  num_of_bytes     Number of registers to be read.
+ *
+ * @retval 0       Registers read.
+ * @retval -EINVAL Registers out of the emulated register file.
+ */
+int npmx_emul_reg_get(const struct emul *target, uint16_t register_address, uint8_t *p_data,
+		      size_t num_of_bytes);
+
+/**
+ * @brief Function for raising events, as done by the nPM device hardware.
+ *
+ * The host interrupt is asserted if any of the events has its interrupt enabled.
+ *
+ * @param[in] target Pointer to the nPM emulator.
+ * @param[in] group  Index of the event group, in npmx_event_group_t order.
+ * @param[in] mask   Mask of events to be raised.
+ *
+ * @retval 0       Events raised.
+ * @retval -EINVAL No such event group.
+ */
+int npmx_emul_event_raise(const struct emul *target, uint8_t group, uint8_t mask);
+
+/**
+ * @brief Function for getting the number of I2C transfers handled by the emulator.
+ *
+ * @param[in] target Pointer to the nPM emulator.
+ *
+ * @return Number of transfers since the emulator initialization.
+ */
+uint32_t npmx_emul_transfer_count_get(const struct emul *target);
+
+/**
+ * @brief Function for getting the number of register accesses handled by the emulator.
+ *
+ * Each access is a register address followed by the data read or written, so accesses merged into
+ * a single burst are counted once.
+ *
+ * @param[in] target Pointer to the nPM emulator.
+ *
+ * @return Number of accesses since the emulator initialization.
+ */
+uint32_t npmx_emul_segment_count_get(const struct emul *target);
+
+/**
+ * @brief Function for making the next I2C transfers fail, as on a disturbed bus.
+ *
+ * Failed transfers return -EIO without accessing the register file. They are counted by
+ * @ref npmx_emul_transfer_count_get.
+ *
+ * @param[in] target Pointer to the nPM emulator.
+ * @param[in] count  Number of transfers to fail, 0 to stop failing transfers.
+ */
+void npmx_emul_transfer_fail_set(const struct emul *target, uint32_t count);
+
+/**
+ * @brief Function for getting the number of software resets requested with TASKSWRESET.
+ *
+ * The emulator does not reset its register file when the task is triggered.
+ *
+ * @param[in] target Pointer to the nPM emulator.
+ *
+ * @return Number of software resets since the emulator initialization.
+ */
+uint32_t npmx_emul_sw_reset_count_get(const struct emul *target);
+
+#endif /* ZEPHYR_DRIVERS_NPMX_NPMX_EMUL_H__ */
@@ -0,0 +1,266 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "npmx_event_log.h"
+
+#if defined(CONFIG_NPMX_EVENT_LOG_NVS)
+#include <zephyr/fs/nvs.h>
+#endif
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(NPMX, CONFIG_NPMX_LOG_LEVEL);
+
+BUILD_ASSERT(IS_POWER_OF_TWO(CONFIG_NPMX_EVENT_LOG_SIZE),
+	     "Event log size has to be a power of two");
+
+#define RING_INDEX(seq) ((seq) & (CONFIG_NPMX_EVENT_LOG_SIZE - 1))
+
+#if defined(CONFIG_NPMX_EVENT_LOG_NVS)
+BUILD_ASSERT(CONFIG_NPMX_EVENT_LOG_NVS_BLOCK_SIZE <= CONFIG_NPMX_EVENT_LOG_SIZE,
+	     "Event log block cannot be larger than the event log");
+
+/* Size of the block with the given number of records. */
+#define BLOCK_SIZE(count)                                                                          \
+	(offsetof(struct npmx_event_log_block, records) +                                          \
+	 ((count) * sizeof(struct npmx_driver_event_record)))
+
+/* NVS entry identifier of the block with the given number. */
+#define BLOCK_ID(p_log, block_seq)                                                                 \
+	((p_log)->first_id + ((block_seq) % CONFIG_NPMX_EVENT_LOG_NVS_BLOCKS))
+
+static uint32_t pending_get(struct npmx_event_log *p_log)
+{
+	return (uint32_t)atomic_get(&p_log->head) - (uint32_t)atomic_get(&p_log->stored);
+}
+
+/**
+ * @brief Function for writing pending records to the storage, in blocks.
+ *
+ * Called with the storage lock held.
+ *
+ * @param[in] p_log   Pointer to the event log state.
+ * @param[in] partial Write also the last block, if it is not full.
+ *
+ * @retval 0    Records written.
+ * @retval -EIO Error writing to the storage.
+ */
+static int storage_write(struct npmx_event_log *p_log, bool partial)
+{
+	struct npmx_event_log_block *p_block = &p_log->block;
+
+	while ((pending_get(p_log) >= CONFIG_NPMX_EVENT_LOG_NVS_BLOCK_SIZE) ||
+	       (partial && (pending_get(p_log) != 0))) {
+		uint32_t seq = (uint32_t)atomic_get(&p_log->stored);
+		size_t count = npmx_event_log_read(
+			p_log, &seq, p_block->records,
+			MIN(pending_get(p_log), CONFIG_NPMX_EVENT_LOG_NVS_BLOCK_SIZE));
+
+		if (count == 0) {
+			/* The next record is still being written, store it later. */
+			break;
+		}
+
+		p_block->block_seq = p_log->block_seq;
+		p_block->count = count;
+
+		if (nvs_write(p_log->p_fs, BLOCK_ID(p_log, p_log->block_seq), p_block,
+			      BLOCK_SIZE(count)) < 0) {
+			LOG_ERR("Failed to store event log block %u", p_log->block_seq);
+			return -EIO;
+		}
+
+		p_log->block_seq++;
+		atomic_set(&p_log->stored, seq);
+	}
+
+	return 0;
+}
+
+static void storage_work_cb(struct k_work *work)
+{
+	struct npmx_event_log *p_log = CONTAINER_OF(work, struct npmx_event_log, work);
+
+	k_mutex_lock(&p_log->storage_lock, K_FOREVER);
+
+	(void)storage_write(p_log, false);
+
+	k_mutex_unlock(&p_log->storage_lock);
+}
+
+/**
+ * @brief Function for reading the stored block with the given number.
+ *
+ * Called with the storage lock held.
+ *
+ * @retval true  Block read to the storage access buffer.
+ * @retval false Block not stored.
+ */
+static bool storage_block_read(struct npmx_event_log *p_log, uint32_t block_seq)
+{
+	struct npmx_event_log_block *p_block = &p_log->block;
+	ssize_t len = nvs_read(p_log->p_fs, BLOCK_ID(p_log, block_seq), p_block, sizeof(*p_block));
+
+	return (len >= (ssize_t)BLOCK_SIZE(0)) && (p_block->block_seq == block_seq) &&
+	       (p_block->count <= CONFIG_NPMX_EVENT_LOG_NVS_BLOCK_SIZE) &&
+	       (len >= (ssize_t)BLOCK_SIZE(p_block->count));
+}
+#endif /* defined(CONFIG_NPMX_EVENT_LOG_NVS) */
+
+void npmx_event_log_init(struct npmx_event_log *p_log)
+{
+	atomic_set(&p_log->head, 0);
+
+	for (size_t i = 0; i < CONFIG_NPMX_EVENT_LOG_SIZE; i++) {
+		atomic_set(&p_log->ring[i].stamp, 0);
+	}
+
+#if defined(CONFIG_NPMX_EVENT_LOG_NVS)
+	k_mutex_init(&p_log->storage_lock);
+	k_work_init(&p_log->work, storage_work_cb);
+	p_log->p_fs = NULL;
+	atomic_set(&p_log->stored, 0);
+#endif
+}
+
+void npmx_event_log_add(struct npmx_event_log *p_log, npmx_callback_type_t type, uint8_t mask)
+{
+	/* Reserving the sequence number gives each producer its own slot. */
+	uint32_t seq = (uint32_t)atomic_inc(&p_log->head);
+	struct npmx_event_log_slot *p_slot = &p_log->ring[RING_INDEX(seq)];
+
+	/* Readers discard the slot content until the new record is complete. */
+	atomic_set(&p_slot->stamp, 0);
+
+	p_slot->record.seq = seq;
+	p_slot->record.timestamp = k_uptime_get_32();
+	p_slot->record.type = (uint8_t)type;
+	p_slot->record.mask = mask;
+
+	atomic_set(&p_slot->stamp, (atomic_val_t)(seq + 1));
+
+#if defined(CONFIG_NPMX_EVENT_LOG_NVS)
+	if ((p_log->p_fs != NULL) && (pending_get(p_log) >= CONFIG_NPMX_EVENT_LOG_NVS_BLOCK_SIZE)) {
+		(void)k_work_submit(&p_log->work);
+	}
+#endif
+}
+
+size_t npmx_event_log_read(struct npmx_event_log *p_log, uint32_t *p_seq,
+			   struct npmx_driver_event_record *p_records, size_t max_count)
+{
+	uint32_t head = (uint32_t)atomic_get(&p_log->head);
+	uint32_t seq = *p_seq;
+	size_t count = 0;
+
+	if ((int32_t)(head - seq) < 0) {
+		seq = head;
+	} else if ((head - seq) > CONFIG_NPMX_EVENT_LOG_SIZE) {
+		seq = head - CONFIG_NPMX_EVENT_LOG_SIZE;
+	}
+
+	while ((count < max_count) && (seq != head)) {
+		struct npmx_event_log_slot *p_slot = &p_log->ring[RING_INDEX(seq)];
+		uint32_t stamp = (uint32_t)atomic_get(&p_slot->stamp);
+		uint32_t lag;
+
+		p_records[count] = p_slot->record;
+
+		/* The copy is valid only if the slot was not rewritten in the meantime. */
+		if ((stamp == (seq + 1)) && ((uint32_t)atomic_get(&p_slot->stamp) == stamp)) {
+			count++;
+			seq++;
+			continue;
+		}
+
+		lag = (uint32_t)atomic_get(&p_log->head) - seq;
+		if (lag <= CONFIG_NPMX_EVENT_LOG_SIZE) {
+			/* The record is still being written, read it next time. */
+			break;
+		}
+
+		seq++;
+	}
+
+	*p_seq = seq;
+
+	return count;
+}
+
+#if defined(CONFIG_NPMX_EVENT_LOG_NVS)
+int npmx_event_log_storage_set(struct npmx_event_log *p_log, struct nvs_fs *p_fs,
+			       uint16_t first_id)
+{
+	int err = 0;
+
+	k_mutex_lock(&p_log->storage_lock, K_FOREVER);
+
+	if (p_log->p_fs != NULL) {
+		err = -EALREADY;
+	} else {
+		p_log->p_fs = p_fs;
+		p_log->first_id = first_id;
+		p_log->block_seq = 0;
+
+		/* Continue after the most recent block written before the reset. */
+		for (uint32_t i = 0; i < CONFIG_NPMX_EVENT_LOG_NVS_BLOCKS; i++) {
+			ssize_t len = nvs_read(p_fs, first_id + i, &p_log->block, BLOCK_SIZE(0));
+
+			if ((len >= (ssize_t)BLOCK_SIZE(0)) &&
+			    ((p_log->block.block_seq % CONFIG_NPMX_EVENT_LOG_NVS_BLOCKS) == i) &&
+			    (p_log->block.block_seq >= p_log->block_seq)) {
+				p_log->block_seq = p_log->block.block_seq + 1;
+			}
+		}
+
+		LOG_DBG("Event log storage attached, next block %u", p_log->block_seq);
+	}
+
+	k_mutex_unlock(&p_log->storage_lock);
+
+	if ((err == 0) && (pending_get(p_log) >= CONFIG_NPMX_EVENT_LOG_NVS_BLOCK_SIZE)) {
+		(void)k_work_submit(&p_log->work);
+	}
+
+	return err;
+}
+
+int npmx_event_log_flush(struct npmx_event_log *p_log)
+{
+	int err;
+
+	k_mutex_lock(&p_log->storage_lock, K_FOREVER);
+
+	err = (p_log->p_fs != NULL) ? storage_write(p_log, true) : -ENODEV;
+
+	k_mutex_unlock(&p_log->storage_lock);
+
+	return err;
+}
+
+int npmx_event_log_stored_read(struct npmx_event_log *p_log, size_t index,
+			       struct npmx_driver_event_record *p_records, size_t max_count)
+{
+	size_t count;
+	int ret;
+
+	k_mutex_lock(&p_log->storage_lock, K_FOREVER);
+
+	if (p_log->p_fs == NULL) {
+		ret = -ENODEV;
+	} else if ((index >= CONFIG_NPMX_EVENT_LOG_NVS_BLOCKS) || (index >= p_log->block_seq) ||
+		   !storage_block_read(p_log, p_log->block_seq - 1 - index)) {
+		ret = -ENOENT;
+	} else {
+		count = MIN(p_log->block.count, max_count);
+		memcpy(p_records, p_log->block.records, count * sizeof(p_records[0]));
+		ret = (int)count;
+	}
+
+	k_mutex_unlock(&p_log->storage_lock);
+
+	return ret;
+}
+#endif /* defined(CONFIG_NPMX_EVENT_LOG_NVS) */
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef ZEPHYR_DRIVERS_NPMX_NPMX_EVENT_LOG_H__
+#define ZEPHYR_DRIVERS_NPMX_NPMX_EVENT_LOG_H__
+
+#include <npmx_driver.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+
+/** @brief Event log ring buffer entry. */
+struct npmx_event_log_slot {
+	atomic_t stamp; /* Sequence number of the record plus one, 0 while it is being written. */
+	struct npmx_driver_event_record record;
+};
+
+#if defined(CONFIG_NPMX_EVENT_LOG_NVS)
+/** @brief Block of records written to a single NVS entry. */
+struct npmx_event_log_block {
+	uint32_t block_seq; /* Number of the block, counted over resets. */
+	uint32_t count; /* Number of valid records. */
+	struct npmx_driver_event_record records[CONFIG_NPMX_EVENT_LOG_NVS_BLOCK_SIZE];
+};
+#endif
+
+/** @brief Event log state. All fields are private. */
+struct npmx_event_log {
+	atomic_t head; /* Sequence number of the next record. */
+	struct npmx_event_log_slot ring[CONFIG_NPMX_EVENT_LOG_SIZE];
+#if defined(CONFIG_NPMX_EVENT_LOG_NVS)
+	struct k_mutex storage_lock; /* Serializes storage accesses. */
+	struct k_work work; /* Writes full blocks to the storage. */
+	struct nvs_fs *p_fs; /* Storage, NULL if not attached. */
+	uint16_t first_id; /* First NVS entry identifier. */
+	uint32_t block_seq; /* Number of the next block to be written. */
+	atomic_t stored; /* Sequence number of the first record not written to the storage. */
+	struct npmx_event_log_block block; /* Storage access buffer. */
+#endif
+};
+
+/**
+ * @brief Function for initializing the event log.
+ *
+ * @param[in] p_log Pointer to the event log state.
+ */
+void npmx_event_log_init(struct npmx_event_log *p_log);
+
+/**
+ * @brief Function for adding the record to the event log.
+ *
+ * Can be called concurrently from several threads, no locks are taken.
+ *
+ * @param[in] p_log Pointer to the event log state.
+ * @param[in] type  Callback type.
+ * @param[in] mask  Mask of events.
+ */
+void npmx_event_log_add(struct npmx_event_log *p_log, npmx_callback_type_t type, uint8_t mask);
+
+/**
+ * @brief Function for reading records from the event log.
+ *
+ * @param[in]     p_log     Pointer to the event log state.
+ * @param[in,out] p_seq     Pointer to the sequence number of the first record to be read, set to
+ *                          the sequence number following the last read record.
+ * @param[out]    p_records Pointer to the array for records.
+ * @param[in]     max_count Maximum number of records to be read.
+ *
+ * @return Number of read records.
+ */
+size_t npmx_event_log_read(struct npmx_event_log *p_log, uint32_t *p_seq,
+			   struct npmx_driver_event_record *p_records, size_t max_count);
+
+#if defined(CONFIG_NPMX_EVENT_LOG_NVS)
+/**
+ * @brief Function for attaching the NVS storage to the event log.
+ *
+ * @param[in] p_log    Pointer to the event log state.
+ * @param[in] p_fs     Pointer to the mounted NVS file system.
+ * @param[in] first_id First NVS entry identifier.
+ *
+ * @retval 0         Storage attached.
+ * @retval -EALREADY Storage already attached.
+ */
+int npmx_event_log_storage_set(struct npmx_event_log *p_log, struct nvs_fs *p_fs,
+			       uint16_t first_id);
+
+/**
+ * @brief Function for writing all records not yet stored to the storage.
+ *
+ * @param[in] p_log Pointer to the event log state.
+ *
+ * @retval 0       Records written.
+ * @retval -ENODEV Storage not attached.
+ * @retval -EIO    Error writing to the storage.
+ */
+int npmx_event_log_flush(struct npmx_event_log *p_log);
+
+/**
+ * @brief Function for reading the stored block of records.
+ *
+ * @param[in]  p_log     Pointer to the event log state.
+ * @param[in]  index     Index of the block, 0 for the most recently written one.
+ * @param[out] p_records Pointer to the array for records.
+ * @param[in]  max_count Maximum number of records to be read.
+ *
+ * @retval non-negative Number of read records.
+ * @retval -ENODEV      Storage not attached.
+ * @retval -ENOENT      No block with the given index is stored.
+ */
+int npmx_event_log_stored_read(struct npmx_event_log *p_log, size_t index,
+			       struct npmx_driver_event_record *p_records, size_t max_count);
+#endif
+
+#endif /* ZEPHYR_DRIVERS_NPMX_NPMX_EVENT_LOG_H__ */
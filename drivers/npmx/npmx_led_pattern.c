@@ -0,0 +1,239 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <npmx_led.h>
+#include "npmx_led_pattern.h"
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(NPMX, CONFIG_NPMX_LOG_LEVEL);
+
+/* All patterns share the tick grid, so edges of several LEDs are written in one update. */
+static int64_t tick_now(void)
+{
+	return k_uptime_get() / CONFIG_NPMX_LED_PATTERN_TICK_MS;
+}
+
+/**
+ * @brief Function for getting the LED state of the timeline at the tick.
+ *
+ * The timeline is deactivated when it has no further state changes.
+ *
+ * @param[in]     p_tl   Pointer to the timeline.
+ * @param[in]     now    Current tick.
+ * @param[in,out] p_next Pointer to the tick of the next update, lowered to the next state change.
+ *
+ * @return LED state at the tick.
+ */
+static bool timeline_state(struct npmx_led_timeline *p_tl, int64_t now, int64_t *p_next)
+{
+	uint32_t period = p_tl->ends[p_tl->count - 1];
+	int64_t elapsed = now - p_tl->start;
+	int64_t run = elapsed / period;
+	uint32_t position = (uint32_t)(elapsed % period);
+	uint8_t step = 0;
+
+	if ((p_tl->repeat != 0) && (run >= p_tl->repeat)) {
+		/* The LED is left off after the last run. */
+		p_tl->active = false;
+		return false;
+	}
+
+	if ((p_tl->count == 1) && (p_tl->repeat == 0)) {
+		/* Steady state, written once. */
+		p_tl->active = false;
+		return (p_tl->states & BIT(0)) != 0;
+	}
+
+	while (position >= p_tl->ends[step]) {
+		step++;
+	}
+
+	*p_next = MIN(*p_next, p_tl->start + (run * period) + p_tl->ends[step]);
+
+	return (p_tl->states & BIT(step)) != 0;
+}
+
+/**
+ * @brief Function for writing changed LED states and scheduling the next update.
+ *
+ * Called with the lock held.
+ *
+ * @retval 0    States written.
+ * @retval -EIO Error using IO bus line, the update is retried at the next tick.
+ */
+static int leds_update(struct npmx_led_pattern *p_lp)
+{
+	npmx_instance_t *npmx_instance = npmx_driver_instance_get(p_lp->p_dev);
+	int64_t now = tick_now();
+	int64_t next = INT64_MAX;
+	uint8_t on = p_lp->on;
+	uint8_t changed;
+	bool batched;
+	bool failed = false;
+
+	for (uint8_t i = 0; i < NPM_LEDDRV_COUNT; i++) {
+		if (p_lp->leds[i].active) {
+			WRITE_BIT(on, i, timeline_state(&p_lp->leds[i], now, &next));
+		}
+	}
+
+	changed = (on ^ p_lp->on) | p_lp->stale;
+
+	if (changed != 0) {
+		/* Unbatched if another thread has opened a batch. */
+		batched = (npmx_driver_batch_begin(p_lp->p_dev) == 0);
+
+		for (uint8_t i = 0; i < NPM_LEDDRV_COUNT; i++) {
+			if (((changed & BIT(i)) != 0) &&
+			    (npmx_led_state_set(npmx_led_get(npmx_instance, i),
+						(on & BIT(i)) != 0) != NPMX_SUCCESS)) {
+				failed = true;
+			}
+		}
+
+		if (batched && (npmx_driver_batch_end(p_lp->p_dev) != 0)) {
+			failed = true;
+		}
+
+		p_lp->on = on;
+		p_lp->stale = failed ? changed : 0;
+	}
+
+	if (failed) {
+		LOG_ERR("%s: failed to set LED states", p_lp->p_dev->name);
+		next = MIN(next, now + 1);
+	}
+
+	if ((next != INT64_MAX) && !p_lp->suspended) {
+		int64_t delay_ms = (next * CONFIG_NPMX_LED_PATTERN_TICK_MS) - k_uptime_get();
+
+		(void)k_work_reschedule(&p_lp->work, K_MSEC(MAX(delay_ms, 0)));
+	}
+
+	return failed ? -EIO : 0;
+}
+
+static void led_pattern_work_cb(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct npmx_led_pattern *p_lp = CONTAINER_OF(dwork, struct npmx_led_pattern, work);
+
+	k_mutex_lock(&p_lp->lock, K_FOREVER);
+
+	(void)leds_update(p_lp);
+
+	k_mutex_unlock(&p_lp->lock);
+}
+
+void npmx_led_pattern_init(struct npmx_led_pattern *p_lp, const struct device *p_dev)
+{
+	p_lp->p_dev = p_dev;
+	p_lp->on = 0;
+	p_lp->stale = 0;
+	p_lp->suspended = false;
+
+	for (uint8_t i = 0; i < NPM_LEDDRV_COUNT; i++) {
+		p_lp->leds[i].active = false;
+	}
+
+	k_mutex_init(&p_lp->lock);
+	k_work_init_delayable(&p_lp->work, led_pattern_work_cb);
+}
+
+int npmx_led_pattern_start(struct npmx_led_pattern *p_lp, uint8_t index,
+			   struct npmx_driver_led_pattern const *p_pattern)
+{
+	npmx_instance_t *npmx_instance = npmx_driver_instance_get(p_lp->p_dev);
+	struct npmx_led_timeline timeline = {
+		.repeat = p_pattern->repeat,
+		.active = true,
+	};
+	uint32_t end = 0;
+	int err;
+
+	if ((index >= NPM_LEDDRV_COUNT) || (p_pattern->step_count == 0) ||
+	    (p_pattern->step_count > CONFIG_NPMX_LED_PATTERN_MAX_STEPS)) {
+		return -EINVAL;
+	}
+
+	for (uint8_t i = 0; i < p_pattern->step_count; i++) {
+		bool on = p_pattern->p_steps[i].on;
+
+		/* Rounded up to the tick, steps of zero duration still last one. */
+		end += MAX(DIV_ROUND_UP(p_pattern->p_steps[i].duration_ms,
+					CONFIG_NPMX_LED_PATTERN_TICK_MS),
+			   1);
+
+		if ((timeline.count > 0) &&
+		    (((timeline.states & BIT(timeline.count - 1)) != 0) == on)) {
+			/* Steps of the same state are merged, so that no update is scheduled. */
+			timeline.ends[timeline.count - 1] = end;
+		} else {
+			WRITE_BIT(timeline.states, timeline.count, on);
+			timeline.ends[timeline.count++] = end;
+		}
+	}
+
+	if (npmx_led_mode_set(npmx_led_get(npmx_instance, index), NPMX_LED_MODE_HOST) !=
+	    NPMX_SUCCESS) {
+		return -EIO;
+	}
+
+	k_mutex_lock(&p_lp->lock, K_FOREVER);
+
+	timeline.start = tick_now();
+	p_lp->leds[index] = timeline;
+	p_lp->stale |= BIT(index);
+	err = leds_update(p_lp);
+
+	k_mutex_unlock(&p_lp->lock);
+
+	return err;
+}
+
+int npmx_led_pattern_stop(struct npmx_led_pattern *p_lp, uint8_t index, bool on)
+{
+	int err;
+
+	if (index >= NPM_LEDDRV_COUNT) {
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&p_lp->lock, K_FOREVER);
+
+	p_lp->leds[index].active = false;
+	WRITE_BIT(p_lp->on, index, on);
+	p_lp->stale |= BIT(index);
+	err = leds_update(p_lp);
+
+	k_mutex_unlock(&p_lp->lock);
+
+	return err;
+}
+
+void npmx_led_pattern_suspend(struct npmx_led_pattern *p_lp)
+{
+	struct k_work_sync sync;
+
+	k_mutex_lock(&p_lp->lock, K_FOREVER);
+
+	p_lp->suspended = true;
+
+	k_mutex_unlock(&p_lp->lock);
+
+	/* The work takes the lock, so it is cancelled without holding it. */
+	(void)k_work_cancel_delayable_sync(&p_lp->work, &sync);
+}
+
+void npmx_led_pattern_resume(struct npmx_led_pattern *p_lp)
+{
+	k_mutex_lock(&p_lp->lock, K_FOREVER);
+
+	p_lp->suspended = false;
+	(void)leds_update(p_lp);
+
+	k_mutex_unlock(&p_lp->lock);
+}
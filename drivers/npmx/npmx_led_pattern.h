@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef ZEPHYR_DRIVERS_NPMX_NPMX_LED_PATTERN_H__
+#define ZEPHYR_DRIVERS_NPMX_NPMX_LED_PATTERN_H__
+
+#include <npmx_driver.h>
+
+#include <zephyr/device.h>
+#include <zephyr/kernel.h>
+
+/** @brief Timeline of the pattern of a single LED, in ticks of CONFIG_NPMX_LED_PATTERN_TICK_MS. */
+struct npmx_led_timeline {
+	uint32_t ends[CONFIG_NPMX_LED_PATTERN_MAX_STEPS]; /* End of each step from the run start. */
+	uint32_t states; /* Bit n set if the LED is on in step n. */
+	uint8_t count; /* Number of steps, after merging steps of the same state. */
+	uint16_t repeat; /* Number of runs, 0 to repeat until stopped. */
+	int64_t start; /* Tick of the pattern start. */
+	bool active; /* Pattern is running. */
+};
+
+/** @brief LED pattern service state. All fields are private. */
+struct npmx_led_pattern {
+	const struct device *p_dev; /* Pointer to the nPM Zephyr device. */
+	struct k_work_delayable work; /* Writes the LED states at the next edge. */
+	struct k_mutex lock; /* Protects the timelines and the written states. */
+	struct npmx_led_timeline leds[NPM_LEDDRV_COUNT];
+	uint8_t on; /* Mask of LEDs switched on in the nPM device. */
+	uint8_t stale; /* Mask of LEDs whose state in the nPM device is not known. */
+	bool suspended; /* Updates are not scheduled while the nPM device is suspended. */
+};
+
+/**
+ * @brief Function for initializing the LED pattern service.
+ *
+ * @param[in] p_lp  Pointer to the service state.
+ * @param[in] p_dev Pointer to the nPM Zephyr device.
+ */
+void npmx_led_pattern_init(struct npmx_led_pattern *p_lp, const struct device *p_dev);
+
+/**
+ * @brief Function for converting the pattern to a timeline and starting it.
+ *
+ * @param[in] p_lp      Pointer to the service state.
+ * @param[in] index     LED index.
+ * @param[in] p_pattern Pointer to the pattern.
+ *
+ * @retval 0       Pattern started.
+ * @retval -EINVAL Invalid LED index or pattern.
+ * @retval -EIO    Error using IO bus line.
+ */
+int npmx_led_pattern_start(struct npmx_led_pattern *p_lp, uint8_t index,
+			   struct npmx_driver_led_pattern const *p_pattern);
+
+/**
+ * @brief Function for stopping the pattern and setting the LED state.
+ *
+ * @param[in] p_lp  Pointer to the service state.
+ * @param[in] index LED index.
+ * @param[in] on    True to leave the LED on, false to leave it off.
+ *
+ * @retval 0       Pattern stopped.
+ * @retval -EINVAL Invalid LED index.
+ * @retval -EIO    Error using IO bus line.
+ */
+int npmx_led_pattern_stop(struct npmx_led_pattern *p_lp, uint8_t index, bool on);
+
+/**
+ * @brief Function for pausing LED updates while the nPM device is suspended.
+ *
+ * LEDs are left in their current states.
+ *
+ * @param[in] p_lp Pointer to the service state.
+ */
+void npmx_led_pattern_suspend(struct npmx_led_pattern *p_lp);
+
+/**
+ * @brief Function for resuming LED updates paused by @ref npmx_led_pattern_suspend.
+ *
+ * Running patterns continue from the current time, as if they were not paused.
+ *
+ * @param[in] p_lp Pointer to the service state.
+ */
+void npmx_led_pattern_resume(struct npmx_led_pattern *p_lp);
+
+#endif /* ZEPHYR_DRIVERS_NPMX_NPMX_LED_PATTERN_H__ */
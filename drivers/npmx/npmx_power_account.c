@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "npmx_power_account.h"
+
+#include <string.h>
+
+static void usage_add(struct npmx_driver_power_usage *p_usage, int64_t charge_uc, int64_t time_ms)
+{
+	p_usage->charge_uc += charge_uc;
+	p_usage->time_ms += time_ms;
+}
+
+/**
+ * @brief Function for attributing the charge drawn between two samples.
+ *
+ * Called with the lock held.
+ *
+ * @param[in] p_pa     Pointer to the power account.
+ * @param[in] p_start  Pointer to the sample at the start of the interval.
+ * @param[in] p_end    Pointer to the sample at the end of the interval.
+ * @param[in] external True if the system may be supplied from VBUS during the interval.
+ */
+static void interval_add(struct npmx_power_account *p_pa, struct npmx_adc_sample const *p_start,
+			 struct npmx_adc_sample const *p_end, bool external)
+{
+	struct npmx_driver_power_account *p_account = &p_pa->account;
+	int64_t time_ms = p_end->timestamp - p_start->timestamp;
+	int64_t charge_uc = (((int64_t)p_start->ibat + p_end->ibat) * time_ms) / 2;
+	int64_t before_ms;
+	int64_t before_uc;
+
+	if (charge_uc < 0) {
+		p_account->charged_uc -= charge_uc;
+	}
+
+	/* The battery current does not show the load supplied from VBUS. */
+	if (external || (charge_uc < 0)) {
+		p_account->unattributed_ms += time_ms;
+		return;
+	}
+
+	usage_add(&p_account->battery, charge_uc, time_ms);
+
+	/* Outputs are attributed as read at the start of the interval. */
+	for (uint8_t i = 0; i < NPMX_DRIVER_POWER_RAIL_COUNT; i++) {
+		if ((p_start->rails & BIT(i)) != 0) {
+			usage_add(&p_account->rails[i], charge_uc, time_ms);
+		}
+	}
+
+	/* The interval is split at the last power state change, proportionally to the time. */
+	before_ms = CLAMP(p_pa->state_time - p_start->timestamp, 0, time_ms);
+	before_uc = (charge_uc * before_ms) / time_ms;
+
+	if (before_ms > 0) {
+		usage_add(&p_account->states[p_pa->prev_state], before_uc, before_ms);
+	}
+
+	if (before_ms < time_ms) {
+		usage_add(&p_account->states[p_account->state], charge_uc - before_uc,
+			  time_ms - before_ms);
+	}
+}
+
+void npmx_power_account_init(struct npmx_power_account *p_pa, const struct device *p_dev)
+{
+	memset(&p_pa->account, 0, sizeof(p_pa->account));
+
+	p_pa->p_dev = p_dev;
+	p_pa->last_valid = false;
+	p_pa->prev_state = 0;
+	p_pa->state_time = 0;
+}
+
+void npmx_power_account_add(struct npmx_power_account *p_pa,
+			    struct npmx_adc_sample const *p_samples, size_t count)
+{
+	bool vbus_connected = false;
+	int64_t vbus_time = 0;
+
+#if defined(CONFIG_NPMX_CHARGER_STATE)
+	struct npmx_driver_charger_state charger_state;
+
+	/* Read once, the state is kept by the charger state tracker without bus access. */
+	if (npmx_driver_charger_state_get(p_pa->p_dev, &charger_state) == 0) {
+		vbus_connected = charger_state.vbus_connected;
+		vbus_time = charger_state.vbus_timestamp;
+	}
+#endif
+
+	k_spinlock_key_t key = k_spin_lock(&p_pa->lock);
+
+	for (size_t i = 0; i < count; i++) {
+		struct npmx_adc_sample const *p_sample = &p_samples[i];
+
+		/* Samples across a sampling restart do not delimit an interval. */
+		if (p_pa->last_valid && !p_sample->first &&
+		    (p_sample->timestamp > p_pa->last.timestamp)) {
+			/* VBUS timestamps are 32-bit uptimes. */
+			bool external = vbus_connected ||
+					((int32_t)((uint32_t)vbus_time -
+						   (uint32_t)p_pa->last.timestamp) > 0);
+
+			interval_add(p_pa, &p_pa->last, p_sample, external);
+		}
+
+		p_pa->last = *p_sample;
+		p_pa->last_valid = true;
+		p_pa->account.samples++;
+	}
+
+	k_spin_unlock(&p_pa->lock, key);
+}
+
+int npmx_power_account_state_set(struct npmx_power_account *p_pa, uint8_t state)
+{
+	if (state >= CONFIG_NPMX_POWER_ACCOUNT_STATES) {
+		return -EINVAL;
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&p_pa->lock);
+
+	if (state != p_pa->account.state) {
+		p_pa->prev_state = p_pa->account.state;
+		p_pa->account.state = state;
+		p_pa->state_time = k_uptime_get();
+	}
+
+	k_spin_unlock(&p_pa->lock, key);
+
+	return 0;
+}
+
+void npmx_power_account_get(struct npmx_power_account *p_pa,
+			    struct npmx_driver_power_account *p_account)
+{
+	k_spinlock_key_t key = k_spin_lock(&p_pa->lock);
+
+	*p_account = p_pa->account;
+
+	k_spin_unlock(&p_pa->lock, key);
+}
+
+void npmx_power_account_reset(struct npmx_power_account *p_pa)
+{
+	k_spinlock_key_t key = k_spin_lock(&p_pa->lock);
+	uint8_t state = p_pa->account.state;
+
+	memset(&p_pa->account, 0, sizeof(p_pa->account));
+
+	p_pa->account.state = state;
+	p_pa->last_valid = false;
+
+	k_spin_unlock(&p_pa->lock, key);
+}
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef ZEPHYR_DRIVERS_NPMX_NPMX_POWER_ACCOUNT_H__
+#define ZEPHYR_DRIVERS_NPMX_NPMX_POWER_ACCOUNT_H__
+
+#include <npmx_driver.h>
+#include <npmx_adc_sampler.h>
+
+#include <zephyr/device.h>
+#include <zephyr/spinlock.h>
+
+/** @brief Power account state. All fields are private. */
+struct npmx_power_account {
+	const struct device *p_dev; /* Pointer to the nPM Zephyr device. */
+	struct k_spinlock lock; /* Protects the account and the power states. */
+	struct npmx_driver_power_account account;
+	struct npmx_adc_sample last; /* Sample at the start of the next interval. */
+	bool last_valid; /* There is a sample to start the next interval. */
+	uint8_t prev_state; /* Power state before the last change. */
+	int64_t state_time; /* Uptime in milliseconds of the last power state change. */
+};
+
+/**
+ * @brief Function for initializing the power account.
+ *
+ * @param[in] p_pa  Pointer to the power account.
+ * @param[in] p_dev Pointer to the nPM Zephyr device.
+ */
+void npmx_power_account_init(struct npmx_power_account *p_pa, const struct device *p_dev);
+
+/**
+ * @brief Function for integrating battery current samples.
+ *
+ * @param[in] p_pa      Pointer to the power account.
+ * @param[in] p_samples Pointer to the samples, oldest first.
+ * @param[in] count     Number of samples.
+ */
+void npmx_power_account_add(struct npmx_power_account *p_pa,
+			    struct npmx_adc_sample const *p_samples, size_t count);
+
+/**
+ * @brief Function for setting the application power state.
+ *
+ * @param[in] p_pa  Pointer to the power account.
+ * @param[in] state Power state.
+ *
+ * @retval 0       State set.
+ * @retval -EINVAL Invalid state.
+ */
+int npmx_power_account_state_set(struct npmx_power_account *p_pa, uint8_t state);
+
+/**
+ * @brief Function for copying the power account.
+ *
+ * @param[in]  p_pa      Pointer to the power account.
+ * @param[out] p_account Pointer to the structure for the account.
+ */
+void npmx_power_account_get(struct npmx_power_account *p_pa,
+			    struct npmx_driver_power_account *p_account);
+
+/**
+ * @brief Function for clearing the power account, keeping the current power state.
+ *
+ * @param[in] p_pa Pointer to the power account.
+ */
+void npmx_power_account_reset(struct npmx_power_account *p_pa);
+
+#endif /* ZEPHYR_DRIVERS_NPMX_NPMX_POWER_ACCOUNT_H__ */
@@ -0,0 +1,414 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <npmx_buck.h>
+#include <npmx_driver.h>
+#include <npmx_ldsw.h>
+
+#include <zephyr/device.h>
+#include <zephyr/drivers/regulator.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/slist.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(NPMX, CONFIG_NPMX_LOG_LEVEL);
+
+/* Output voltage range of BUCK converters and of LDSWs in LDO mode. */
+#define VOLTAGE_MIN_MV  1000
+#define VOLTAGE_MAX_MV  3300
+#define VOLTAGE_STEP_MV 100
+
+/* Number of microvolts in a millivolt. */
+#define UV_PER_MV 1000
+
+/* Retry period of state changes which could not be written. */
+#define APPLY_RETRY_MS 100
+
+enum regulator_npmx_type {
+	REGULATOR_NPMX_BUCK, /* BUCK converter. */
+	REGULATOR_NPMX_LDSW, /* Load switch, working as a load switch or as an LDO. */
+};
+
+struct regulator_npmx_config {
+	struct regulator_common_config common; /* Has to be the first member. */
+	const struct device *pmic_dev;
+	enum regulator_npmx_type type;
+	uint8_t index;
+};
+
+struct regulator_npmx_data {
+	struct regulator_common_data common; /* Has to be the first member. */
+	const struct device *dev;
+	sys_snode_t node; /* Node of the regulators list. */
+	bool target; /* Requested state, protected by the lock. */
+	bool enabled; /* Last written state, accessed with the apply lock taken. */
+	bool written; /* State being written, accessed with the apply lock taken. */
+};
+
+static void apply_work_cb(struct k_work *work);
+
+/* All initialized regulators. Appended only at initialization. */
+static sys_slist_t regulators = SYS_SLIST_STATIC_INIT(&regulators);
+
+/* Protects requested states of all regulators. */
+static struct k_spinlock lock;
+
+/* Serializes writing of state changes. */
+static K_MUTEX_DEFINE(apply_lock);
+
+/* Writes state changes requested within the coalescing window. */
+static K_WORK_DELAYABLE_DEFINE(apply_work, apply_work_cb);
+
+static npmx_error_t state_write(const struct device *dev, bool enable)
+{
+	const struct regulator_npmx_config *config = dev->config;
+	npmx_instance_t *npmx_instance = npmx_driver_instance_get(config->pmic_dev);
+
+	if (config->type == REGULATOR_NPMX_BUCK) {
+		return npmx_buck_task_trigger(npmx_buck_get(npmx_instance, config->index),
+					      enable ? NPMX_BUCK_TASK_ENABLE :
+						       NPMX_BUCK_TASK_DISABLE);
+	}
+
+	return npmx_ldsw_task_trigger(npmx_ldsw_get(npmx_instance, config->index),
+				      enable ? NPMX_LDSW_TASK_ENABLE : NPMX_LDSW_TASK_DISABLE);
+}
+
+/**
+ * @brief Function for writing pending state changes of all regulators of the nPM device.
+ *
+ * Changes are written in a single batch. If another thread has opened a batch, they are written
+ * one by one. Has to be called with the apply lock taken.
+ *
+ * @param[in] pmic_dev Pointer to the nPM Zephyr device.
+ *
+ * @retval 0    Changes written, or no change pending.
+ * @retval -EIO Error using IO bus line.
+ */
+static int pmic_changes_apply(const struct device *pmic_dev)
+{
+	struct regulator_npmx_data *p_data;
+	uint32_t count = 0;
+	bool batched;
+	bool failed = false;
+	int err;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&regulators, p_data, node) {
+		const struct regulator_npmx_config *config = p_data->dev->config;
+		k_spinlock_key_t key = k_spin_lock(&lock);
+
+		p_data->written = p_data->target;
+
+		k_spin_unlock(&lock, key);
+
+		if ((config->pmic_dev == pmic_dev) && (p_data->written != p_data->enabled)) {
+			count++;
+		}
+	}
+
+	if (count == 0) {
+		return 0;
+	}
+
+	batched = (npmx_driver_batch_begin(pmic_dev) == 0);
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&regulators, p_data, node) {
+		const struct regulator_npmx_config *config = p_data->dev->config;
+
+		if ((config->pmic_dev != pmic_dev) || (p_data->written == p_data->enabled)) {
+			continue;
+		}
+
+		if (state_write(p_data->dev, p_data->written) != NPMX_SUCCESS) {
+			failed = true;
+		} else if (!batched) {
+			p_data->enabled = p_data->written;
+		}
+	}
+
+	if (!batched) {
+		return failed ? -EIO : 0;
+	}
+
+	err = npmx_driver_batch_end(pmic_dev);
+	if ((err != 0) || failed) {
+		return -EIO;
+	}
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&regulators, p_data, node) {
+		const struct regulator_npmx_config *config = p_data->dev->config;
+
+		if (config->pmic_dev == pmic_dev) {
+			p_data->enabled = p_data->written;
+		}
+	}
+
+	LOG_DBG("%s: %u regulator state changes written", pmic_dev->name, count);
+
+	return 0;
+}
+
+static void apply_work_cb(struct k_work *work)
+{
+	struct regulator_npmx_data *p_data;
+	struct regulator_npmx_data *p_prev;
+
+	ARG_UNUSED(work);
+
+	(void)k_mutex_lock(&apply_lock, K_FOREVER);
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&regulators, p_data, node) {
+		const struct regulator_npmx_config *config = p_data->dev->config;
+		bool first = true;
+
+		/* Apply the changes once for each nPM device. */
+		SYS_SLIST_FOR_EACH_CONTAINER(&regulators, p_prev, node) {
+			const struct regulator_npmx_config *prev_config = p_prev->dev->config;
+
+			if (p_prev == p_data) {
+				break;
+			}
+
+			first = first && (prev_config->pmic_dev != config->pmic_dev);
+		}
+
+		if (first && (pmic_changes_apply(config->pmic_dev) != 0)) {
+			LOG_ERR("%s: unable to change regulator states", config->pmic_dev->name);
+			(void)k_work_schedule(&apply_work, K_MSEC(APPLY_RETRY_MS));
+		}
+	}
+
+	k_mutex_unlock(&apply_lock);
+}
+
+static void state_request(const struct device *dev, bool enable)
+{
+	struct regulator_npmx_data *data = dev->data;
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	data->target = enable;
+
+	k_spin_unlock(&lock, key);
+}
+
+static int regulator_npmx_enable(const struct device *dev)
+{
+	const struct regulator_npmx_config *config = dev->config;
+	int err;
+
+	state_request(dev, true);
+
+	/* The output has to be powered when the function returns, so the change is written now,
+	 * together with changes requested by other consumers in the meantime. If a disable of the
+	 * output is still pending, nothing is written.
+	 */
+	(void)k_mutex_lock(&apply_lock, K_FOREVER);
+
+	err = pmic_changes_apply(config->pmic_dev);
+
+	k_mutex_unlock(&apply_lock);
+
+	if (err != 0) {
+		state_request(dev, false);
+	}
+
+	return err;
+}
+
+static int regulator_npmx_disable(const struct device *dev)
+{
+	state_request(dev, false);
+
+	/* The window is not extended by later requests, so the output is disabled in time. */
+	(void)k_work_schedule(&apply_work, K_MSEC(CONFIG_NPMX_REGULATOR_COALESCE_MS));
+
+	return 0;
+}
+
+static unsigned int regulator_npmx_count_voltages(const struct device *dev)
+{
+	ARG_UNUSED(dev);
+
+	return ((VOLTAGE_MAX_MV - VOLTAGE_MIN_MV) / VOLTAGE_STEP_MV) + 1;
+}
+
+static int regulator_npmx_list_voltage(const struct device *dev, unsigned int idx,
+				       int32_t *volt_uv)
+{
+	if (idx >= regulator_npmx_count_voltages(dev)) {
+		return -EINVAL;
+	}
+
+	*volt_uv = (VOLTAGE_MIN_MV + (idx * VOLTAGE_STEP_MV)) * UV_PER_MV;
+
+	return 0;
+}
+
+static int regulator_npmx_set_voltage(const struct device *dev, int32_t min_uv, int32_t max_uv)
+{
+	const struct regulator_npmx_config *config = dev->config;
+	npmx_instance_t *npmx_instance = npmx_driver_instance_get(config->pmic_dev);
+	int32_t voltage_mv = MAX(DIV_ROUND_UP(min_uv, UV_PER_MV), VOLTAGE_MIN_MV);
+	npmx_error_t err_code;
+	bool batched;
+	int err;
+
+	/* Lowest supported voltage within the range. */
+	voltage_mv = ROUND_UP(voltage_mv - VOLTAGE_MIN_MV, VOLTAGE_STEP_MV) + VOLTAGE_MIN_MV;
+	if ((voltage_mv > VOLTAGE_MAX_MV) || ((voltage_mv * UV_PER_MV) > max_uv)) {
+		return -EINVAL;
+	}
+
+	if (config->type == REGULATOR_NPMX_LDSW) {
+		err_code = npmx_ldsw_ldo_voltage_set(npmx_ldsw_get(npmx_instance, config->index),
+						     npmx_ldsw_voltage_convert(voltage_mv));
+		return (err_code == NPMX_SUCCESS) ? 0 : -EIO;
+	}
+
+	npmx_buck_t *buck_instance = npmx_buck_get(npmx_instance, config->index);
+
+	batched = (npmx_driver_batch_begin(config->pmic_dev) == 0);
+
+	err_code = npmx_buck_normal_voltage_set(buck_instance,
+						npmx_buck_voltage_convert(voltage_mv));
+	if (err_code == NPMX_SUCCESS) {
+		err_code = npmx_buck_vout_select_set(buck_instance, NPMX_BUCK_VOUT_SELECT_SOFTWARE);
+	}
+
+	err = batched ? npmx_driver_batch_end(config->pmic_dev) : 0;
+
+	return ((err_code == NPMX_SUCCESS) && (err == 0)) ? 0 : -EIO;
+}
+
+static int regulator_npmx_get_voltage(const struct device *dev, int32_t *volt_uv)
+{
+	const struct regulator_npmx_config *config = dev->config;
+	npmx_instance_t *npmx_instance = npmx_driver_instance_get(config->pmic_dev);
+	uint32_t voltage_mv;
+	bool converted;
+
+	if (config->type == REGULATOR_NPMX_BUCK) {
+		npmx_buck_voltage_t voltage;
+
+		if (npmx_buck_status_voltage_get(npmx_buck_get(npmx_instance, config->index),
+						 &voltage) != NPMX_SUCCESS) {
+			return -EIO;
+		}
+
+		converted = npmx_buck_voltage_convert_to_mv(voltage, &voltage_mv);
+	} else {
+		npmx_ldsw_voltage_t voltage;
+
+		if (npmx_ldsw_ldo_voltage_get(npmx_ldsw_get(npmx_instance, config->index),
+					      &voltage) != NPMX_SUCCESS) {
+			return -EIO;
+		}
+
+		converted = npmx_ldsw_voltage_convert_to_mv(voltage, &voltage_mv);
+	}
+
+	if (!converted) {
+		return -EIO;
+	}
+
+	*volt_uv = voltage_mv * UV_PER_MV;
+
+	return 0;
+}
+
+static const struct regulator_driver_api regulator_npmx_api = {
+	.enable = regulator_npmx_enable,
+	.disable = regulator_npmx_disable,
+	.count_voltages = regulator_npmx_count_voltages,
+	.list_voltage = regulator_npmx_list_voltage,
+	.set_voltage = regulator_npmx_set_voltage,
+	.get_voltage = regulator_npmx_get_voltage,
+};
+
+static int state_read(const struct device *dev, bool *p_enabled)
+{
+	const struct regulator_npmx_config *config = dev->config;
+	npmx_instance_t *npmx_instance = npmx_driver_instance_get(config->pmic_dev);
+
+	if (config->type == REGULATOR_NPMX_BUCK) {
+		npmx_buck_status_t status;
+
+		if (npmx_buck_status_get(npmx_buck_get(npmx_instance, config->index), &status) !=
+		    NPMX_SUCCESS) {
+			return -EIO;
+		}
+
+		*p_enabled = status.powered;
+		return 0;
+	}
+
+	uint8_t status_mask;
+	uint8_t check_mask = (config->index == 0) ? (NPMX_LDSW_STATUS_POWERUP_LDSW_1_MASK |
+						     NPMX_LDSW_STATUS_POWERUP_LDO_1_MASK) :
+						    (NPMX_LDSW_STATUS_POWERUP_LDSW_2_MASK |
+						     NPMX_LDSW_STATUS_POWERUP_LDO_2_MASK);
+
+	if (npmx_ldsw_status_get(npmx_ldsw_get(npmx_instance, config->index), &status_mask) !=
+	    NPMX_SUCCESS) {
+		return -EIO;
+	}
+
+	*p_enabled = ((status_mask & check_mask) != 0);
+	return 0;
+}
+
+static int regulator_npmx_init(const struct device *dev)
+{
+	const struct regulator_npmx_config *config = dev->config;
+	struct regulator_npmx_data *data = dev->data;
+	bool enabled;
+
+	regulator_common_data_init(dev);
+
+	if (!device_is_ready(config->pmic_dev)) {
+		LOG_ERR("%s: nPM device %s is not ready", dev->name, config->pmic_dev->name);
+		return -ENODEV;
+	}
+
+	/* The state could have been set by the boot configuration of the nPM device. */
+	if (state_read(dev, &enabled) != 0) {
+		LOG_ERR("%s: unable to read regulator state", dev->name);
+		return -EIO;
+	}
+
+	data->dev = dev;
+	data->target = enabled;
+	data->enabled = enabled;
+	sys_slist_append(&regulators, &data->node);
+
+	return regulator_common_init(dev, enabled);
+}
+
+#define REGULATOR_NPMX_DEFINE(inst, _name, _type)                                                  \
+	static struct regulator_npmx_data regulator_npmx_data_##_name##inst;                       \
+	static const struct regulator_npmx_config regulator_npmx_config_##_name##inst = {          \
+		.common = REGULATOR_DT_INST_COMMON_CONFIG_INIT(inst),                              \
+		.pmic_dev = DEVICE_DT_GET(DT_INST_PARENT(inst)),                                   \
+		.type = _type,                                                                     \
+		.index = DT_INST_PROP(inst, index),                                                \
+	};                                                                                         \
+	DEVICE_DT_INST_DEFINE(inst, regulator_npmx_init, NULL, &regulator_npmx_data_##_name##inst, \
+			      &regulator_npmx_config_##_name##inst, POST_KERNEL,                   \
+			      CONFIG_NPMX_REGULATOR_INIT_PRIORITY, &regulator_npmx_api);
+
+#define DT_DRV_COMPAT nordic_npmx_npm1300_buck
+#define REGULATOR_NPMX_BUCK_DEFINE(inst) REGULATOR_NPMX_DEFINE(inst, buck, REGULATOR_NPMX_BUCK)
+DT_INST_FOREACH_STATUS_OKAY(REGULATOR_NPMX_BUCK_DEFINE)
+
+#undef DT_DRV_COMPAT
+#define DT_DRV_COMPAT nordic_npmx_npm1300_ldsw
+#define REGULATOR_NPMX_LDSW_DEFINE(inst) REGULATOR_NPMX_DEFINE(inst, ldsw, REGULATOR_NPMX_LDSW)
+DT_INST_FOREACH_STATUS_OKAY(REGULATOR_NPMX_LDSW_DEFINE)
+
+/*
+ * Make sure that this driver is not initialized before the nPM device is available.
+ */
+BUILD_ASSERT(CONFIG_NPMX_REGULATOR_INIT_PRIORITY > CONFIG_NPMX_INIT_PRIORITY);
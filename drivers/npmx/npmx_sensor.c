@@ -0,0 +1,262 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <npmx_adc.h>
+#include <npmx_driver.h>
+
+#include <zephyr/device.h>
+#include <zephyr/drivers/sensor.h>
+#include <zephyr/kernel.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(NPMX, CONFIG_NPMX_LOG_LEVEL);
+
+#define DT_DRV_COMPAT nordic_npmx_npm1300_adc
+
+/* Maximum time of all ADC measurements triggered by a single fetch. */
+#define SENSOR_MEAS_TIMEOUT_MS 100
+
+/* ADC events reported when all measurements triggered by a single fetch are completed. */
+#define SENSOR_MEAS_EVENTS                                                                         \
+	(NPMX_EVENT_GROUP_ADC_BAT_READY_MASK | NPMX_EVENT_GROUP_ADC_IBAT_READY_MASK |              \
+	 NPMX_EVENT_GROUP_ADC_NTC_READY_MASK | NPMX_EVENT_GROUP_ADC_DIE_TEMP_READY_MASK)
+
+struct npmx_sensor_config {
+	const struct device *pmic_dev;
+};
+
+struct npmx_sensor_data {
+	const struct device *dev;
+	npmx_adc_meas_all_t meas; /* Results of the last fetch. */
+#if defined(CONFIG_NPMX_SENSOR_TRIGGER)
+	struct k_work work; /* Work item calling the data ready handler. */
+	sensor_trigger_handler_t handler; /* Data ready trigger handler. */
+	const struct sensor_trigger *trigger; /* Data ready trigger. */
+	uint8_t trigger_events; /* ADC events reporting data ready. */
+#endif
+};
+
+static const npmx_adc_task_t meas_tasks[] = {
+	NPMX_ADC_TASK_SINGLE_SHOT_VBAT,
+	NPMX_ADC_TASK_SINGLE_SHOT_NTC,
+	NPMX_ADC_TASK_SINGLE_SHOT_DIE_TEMP,
+};
+
+static bool channel_supported(enum sensor_channel chan)
+{
+	switch (chan) {
+	case SENSOR_CHAN_ALL:
+	case SENSOR_CHAN_GAUGE_VOLTAGE:
+	case SENSOR_CHAN_GAUGE_AVG_CURRENT:
+	case SENSOR_CHAN_GAUGE_TEMP:
+	case SENSOR_CHAN_DIE_TEMP:
+		return true;
+	default:
+		return false;
+	}
+}
+
+static int npmx_sensor_sample_fetch(const struct device *dev, enum sensor_channel chan)
+{
+	const struct npmx_sensor_config *config = dev->config;
+	struct npmx_sensor_data *data = dev->data;
+	npmx_adc_t *adc_instance = npmx_adc_get(npmx_driver_instance_get(config->pmic_dev), 0);
+	bool trigger_meas = true;
+	int err;
+
+	if (!channel_supported(chan)) {
+		return -ENOTSUP;
+	}
+
+#if defined(CONFIG_NPMX_SENSOR_TRIGGER)
+	/* With the data ready trigger set, measurements are started by the application or the
+	 * ADC auto measurement, so only take their results.
+	 */
+	trigger_meas = (data->handler == NULL);
+#endif
+
+	if (trigger_meas) {
+		err = npmx_driver_adc_tasks_wait(config->pmic_dev, meas_tasks,
+						 ARRAY_SIZE(meas_tasks), SENSOR_MEAS_EVENTS,
+						 SENSOR_MEAS_TIMEOUT_MS);
+		if (err != 0) {
+			LOG_ERR("ADC measurements failed: %d", err);
+			return err;
+		}
+	}
+
+	/* All results are read in a single burst. */
+	if (npmx_adc_meas_all_get(adc_instance, &data->meas) != NPMX_SUCCESS) {
+		return -EIO;
+	}
+
+	return 0;
+}
+
+static void milli_to_sensor_value(int32_t milli, struct sensor_value *val)
+{
+	val->val1 = milli / 1000;
+	val->val2 = (milli % 1000) * 1000;
+}
+
+static int npmx_sensor_channel_get(const struct device *dev, enum sensor_channel chan,
+				   struct sensor_value *val)
+{
+	struct npmx_sensor_data *data = dev->data;
+
+	switch (chan) {
+	case SENSOR_CHAN_GAUGE_VOLTAGE:
+		milli_to_sensor_value(data->meas.values[NPMX_ADC_MEAS_VBAT], val);
+		break;
+	case SENSOR_CHAN_GAUGE_AVG_CURRENT:
+		milli_to_sensor_value(data->meas.values[NPMX_ADC_MEAS_VBAT2_IBAT], val);
+		break;
+	case SENSOR_CHAN_GAUGE_TEMP:
+		milli_to_sensor_value(data->meas.values[NPMX_ADC_MEAS_BAT_TEMP], val);
+		break;
+	case SENSOR_CHAN_DIE_TEMP:
+		milli_to_sensor_value(data->meas.values[NPMX_ADC_MEAS_DIE_TEMP], val);
+		break;
+	default:
+		return -ENOTSUP;
+	}
+
+	return 0;
+}
+
+#if defined(CONFIG_NPMX_SENSOR_TRIGGER)
+static void trigger_work_cb(struct k_work *work)
+{
+	struct npmx_sensor_data *data = CONTAINER_OF(work, struct npmx_sensor_data, work);
+	sensor_trigger_handler_t handler = data->handler;
+
+	if (handler != NULL) {
+		handler(data->dev, data->trigger);
+	}
+}
+
+static void adc_handler(const struct device *pmic_dev, uint8_t events, void *p_user_data)
+{
+	struct npmx_sensor_data *data = p_user_data;
+
+	ARG_UNUSED(pmic_dev);
+
+	/* The nPM device cannot be accessed from here, so the handler is called from the work. */
+	if ((events & data->trigger_events) != 0) {
+		k_work_submit(&data->work);
+	}
+}
+
+static uint8_t channel_events_get(enum sensor_channel chan)
+{
+	switch (chan) {
+	case SENSOR_CHAN_ALL:
+	case SENSOR_CHAN_GAUGE_VOLTAGE:
+		return NPMX_EVENT_GROUP_ADC_BAT_READY_MASK;
+	case SENSOR_CHAN_GAUGE_AVG_CURRENT:
+		return NPMX_EVENT_GROUP_ADC_IBAT_READY_MASK;
+	case SENSOR_CHAN_GAUGE_TEMP:
+		return NPMX_EVENT_GROUP_ADC_NTC_READY_MASK;
+	case SENSOR_CHAN_DIE_TEMP:
+		return NPMX_EVENT_GROUP_ADC_DIE_TEMP_READY_MASK;
+	default:
+		return 0;
+	}
+}
+
+static int npmx_sensor_trigger_set(const struct device *dev, const struct sensor_trigger *trig,
+				   sensor_trigger_handler_t handler)
+{
+	const struct npmx_sensor_config *config = dev->config;
+	struct npmx_sensor_data *data = dev->data;
+	npmx_instance_t *npmx_instance = npmx_driver_instance_get(config->pmic_dev);
+	uint8_t events = channel_events_get(trig->chan);
+	npmx_error_t err_code;
+
+	if ((trig->type != SENSOR_TRIG_DATA_READY) || (events == 0)) {
+		return -ENOTSUP;
+	}
+
+	if (npmx_driver_int_pin_get(config->pmic_dev) == -1) {
+		LOG_ERR("Data ready trigger requires the host interrupt");
+		return -ENOTSUP;
+	}
+
+	if (data->trigger_events != 0) {
+		err_code = npmx_core_event_interrupt_disable(npmx_instance, NPMX_EVENT_GROUP_ADC,
+							     data->trigger_events);
+		if (err_code != NPMX_SUCCESS) {
+			return -EIO;
+		}
+	}
+
+	data->handler = handler;
+	data->trigger = trig;
+	data->trigger_events = (handler != NULL) ? events : 0;
+
+	if (handler == NULL) {
+		npmx_driver_adc_handler_set(config->pmic_dev, NULL, NULL);
+		return 0;
+	}
+
+	npmx_driver_adc_handler_set(config->pmic_dev, adc_handler, data);
+
+	err_code = npmx_core_event_interrupt_enable(npmx_instance, NPMX_EVENT_GROUP_ADC, events);
+
+	return (err_code == NPMX_SUCCESS) ? 0 : -EIO;
+}
+#endif
+
+static const struct sensor_driver_api npmx_sensor_api = {
+#if defined(CONFIG_NPMX_SENSOR_TRIGGER)
+	.trigger_set = npmx_sensor_trigger_set,
+#endif
+	.sample_fetch = npmx_sensor_sample_fetch,
+	.channel_get = npmx_sensor_channel_get,
+};
+
+static int npmx_sensor_init(const struct device *dev)
+{
+	const struct npmx_sensor_config *config = dev->config;
+	struct npmx_sensor_data *data = dev->data;
+
+	if (!device_is_ready(config->pmic_dev)) {
+		LOG_ERR("%s: nPM device %s is not ready", dev->name, config->pmic_dev->name);
+		return -ENODEV;
+	}
+
+	data->dev = dev;
+
+#if defined(CONFIG_NPMX_SENSOR_TRIGGER)
+	k_work_init(&data->work, trigger_work_cb);
+#endif
+
+	/* Measure the battery current after each battery voltage measurement. */
+	if (npmx_adc_ibat_meas_enable_set(
+		    npmx_adc_get(npmx_driver_instance_get(config->pmic_dev), 0), true) !=
+	    NPMX_SUCCESS) {
+		LOG_ERR("Unable to enable battery current measurement");
+		return -EIO;
+	}
+
+	return 0;
+}
+
+#define NPMX_SENSOR_DEFINE(inst)                                                                   \
+	static struct npmx_sensor_data npmx_sensor_data_##inst;                                    \
+	static const struct npmx_sensor_config npmx_sensor_config_##inst = {                       \
+		.pmic_dev = DEVICE_DT_GET(DT_INST_PARENT(inst)),                                   \
+	};                                                                                         \
+	DEVICE_DT_INST_DEFINE(inst, npmx_sensor_init, NULL, &npmx_sensor_data_##inst,              \
+			      &npmx_sensor_config_##inst, POST_KERNEL,                             \
+			      CONFIG_NPMX_SENSOR_INIT_PRIORITY, &npmx_sensor_api);
+
+DT_INST_FOREACH_STATUS_OKAY(NPMX_SENSOR_DEFINE)
+
+/*
+ * Make sure that this driver is not initialized before the nPM device is available.
+ */
+BUILD_ASSERT(CONFIG_NPMX_SENSOR_INIT_PRIORITY > CONFIG_NPMX_INIT_PRIORITY);
@@ -0,0 +1,221 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef ZEPHYR_DRIVERS_NPMX_NPMX_TELEMETRY_H__
+#define ZEPHYR_DRIVERS_NPMX_NPMX_TELEMETRY_H__
+
+#include <npmx_driver.h>
+
+#if defined(CONFIG_NPMX_ADC_SAMPLER)
+#include <npmx_adc_sampler.h>
+#endif
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+
+/** @brief First byte of each telemetry frame. */
+#define NPMX_TELEMETRY_SYNC 0xA5U
+
+/** @brief Maximum size of the frame payload. */
+#define NPMX_TELEMETRY_PAYLOAD_MAX 255U
+
+/** @brief Telemetry channels. Frames are sent only on channels subscribed by the host. */
+enum npmx_telemetry_channel {
+	NPMX_TELEMETRY_CHANNEL_ADC, /* ADC samples, struct npmx_telemetry_adc. */
+	NPMX_TELEMETRY_CHANNEL_CHARGER, /* Charger status, struct npmx_telemetry_charger. */
+	NPMX_TELEMETRY_CHANNEL_EVENT, /* Event records, struct npmx_telemetry_event. */
+	NPMX_TELEMETRY_CHANNEL_COUNT, /* Number of data channels. */
+	NPMX_TELEMETRY_CHANNEL_CONTROL = 0xFF, /* Host commands. */
+};
+
+/** @brief Host commands, sent as the first payload byte on the control channel. */
+enum npmx_telemetry_command {
+	NPMX_TELEMETRY_COMMAND_SUBSCRIBE, /* Followed by the mask of channels to be sent. */
+};
+
+/**
+ * @brief Header of a telemetry frame, followed by the payload.
+ *
+ * Multi-byte fields of the header and of all payloads are little-endian.
+ */
+struct npmx_telemetry_header {
+	uint8_t sync; /* @ref NPMX_TELEMETRY_SYNC. */
+	uint8_t channel; /* Channel, see @ref npmx_telemetry_channel. */
+	uint8_t len; /* Payload size in bytes. */
+	uint8_t seq; /* Sequence number of the frame, incremented for each sent frame. */
+	uint16_t crc; /* CRC-16/CCITT of the payload. */
+} __packed;
+
+/** @brief Flag of the ADC channel payload set for the first sample after the sampling start. */
+#define NPMX_TELEMETRY_ADC_FLAG_FIRST BIT(0)
+
+/**
+ * @brief Payload of the ADC channel.
+ *
+ * The layout does not depend on the configuration. Without CONFIG_NPMX_POWER_ACCOUNT, the rails
+ * and flags fields are 0.
+ */
+struct npmx_telemetry_adc {
+	uint32_t timestamp; /* Uptime in milliseconds when the measurements were triggered. */
+	int32_t vbat; /* Battery voltage in millivolts. */
+	int32_t ibat; /* Battery current in milliamperes. */
+	int32_t bat_temp; /* Battery temperature in millidegrees Celsius. */
+	int32_t die_temp; /* Die temperature in millidegrees Celsius. */
+	uint8_t rails; /* Outputs enabled at the timestamp, bit n for NPMX_DRIVER_POWER_RAIL n. */
+	uint8_t flags; /* Mask of NPMX_TELEMETRY_ADC_FLAG_* flags. */
+} __packed;
+
+/** @brief Payload of the charger channel. */
+struct npmx_telemetry_charger {
+	uint32_t timestamp; /* Uptime in milliseconds. */
+	uint8_t status; /* Mask of npmx_charger_status_mask_t flags. */
+} __packed;
+
+/** @brief Payload of the event channel. */
+struct npmx_telemetry_event {
+	uint32_t timestamp; /* Uptime in milliseconds. */
+	uint8_t type; /* Callback type, see npmx_callback_type_t. */
+	uint8_t mask; /* Mask of events. */
+} __packed;
+
+/**
+ * @brief Transport function sending a frame.
+ *
+ * Both buffers are sent one after another. The payload points to the source data, so it has to be
+ * sent or copied before the function returns.
+ *
+ * @param[in] p_header    Pointer to the frame header.
+ * @param[in] p_payload   Pointer to the payload.
+ * @param[in] len         Payload size in bytes.
+ * @param[in] p_user_data User data passed to @ref npmx_telemetry_init.
+ *
+ * @retval 0        Frame sent.
+ * @retval negative Frame dropped.
+ */
+typedef int (*npmx_telemetry_send_t)(struct npmx_telemetry_header const *p_header,
+				     void const *p_payload, size_t len, void *p_user_data);
+
+/** @brief Telemetry channel instance. All fields are private. */
+struct npmx_telemetry {
+	npmx_telemetry_send_t send; /* Transport function. */
+	void *p_user_data; /* User data passed to the transport function. */
+	struct k_mutex lock; /* Serializes frames. */
+	uint8_t seq; /* Sequence number of the next frame. */
+	atomic_t subscribed; /* Mask of channels subscribed by the host. */
+	atomic_t dropped; /* Number of frames dropped by the transport function. */
+};
+
+/**
+ * @brief Function for initializing the telemetry channel.
+ *
+ * No channel is subscribed until the host sends the subscribe command.
+ *
+ * @param[in] p_telemetry Pointer to the telemetry instance.
+ * @param[in] send        Transport function.
+ * @param[in] p_user_data User data passed to the transport function.
+ */
+void npmx_telemetry_init(struct npmx_telemetry *p_telemetry, npmx_telemetry_send_t send,
+			 void *p_user_data);
+
+/**
+ * @brief Function for handling a frame received from the host.
+ *
+ * @param[in] p_telemetry Pointer to the telemetry instance.
+ * @param[in] p_frame     Pointer to the complete frame, header included.
+ * @param[in] len         Frame size in bytes.
+ *
+ * @retval 0        Command handled.
+ * @retval -EINVAL  Malformed frame.
+ * @retval -ENOTSUP Unknown channel or command.
+ */
+int npmx_telemetry_rx(struct npmx_telemetry *p_telemetry, uint8_t const *p_frame, size_t len);
+
+/**
+ * @brief Function for checking if the host subscribed the channel.
+ *
+ * Used to skip collecting data which would not be sent.
+ *
+ * @param[in] p_telemetry Pointer to the telemetry instance.
+ * @param[in] channel     Channel.
+ *
+ * @retval true  Channel subscribed.
+ * @retval false Channel not subscribed.
+ */
+bool npmx_telemetry_subscribed(struct npmx_telemetry *p_telemetry,
+			       enum npmx_telemetry_channel channel);
+
+/**
+ * @brief Function for sending a record on the channel, if it is subscribed.
+ *
+ * The record is passed to the transport function as it is, without copying or formatting.
+ *
+ * @param[in] p_telemetry Pointer to the telemetry instance.
+ * @param[in] channel     Channel.
+ * @param[in] p_payload   Pointer to the record.
+ * @param[in] len         Record size in bytes.
+ *
+ * @retval 0       Record sent, or channel not subscribed.
+ * @retval -EINVAL Record too large.
+ * @retval -EIO    Record dropped by the transport function.
+ */
+int npmx_telemetry_publish(struct npmx_telemetry *p_telemetry, enum npmx_telemetry_channel channel,
+			   void const *p_payload, size_t len);
+
+#if defined(CONFIG_NPMX_ADC_SAMPLER)
+/**
+ * @brief Function for sending all samples stored by the ADC sampler on the ADC channel.
+ *
+ * Samples are sent as struct npmx_telemetry_adc records. If the channel is not subscribed,
+ * samples are left in the sampler ring buffer.
+ *
+ * @param[in] p_telemetry Pointer to the telemetry instance.
+ * @param[in] p_sampler   Pointer to the ADC sampler instance.
+ *
+ * @return Number of sent samples.
+ */
+size_t npmx_telemetry_adc_publish(struct npmx_telemetry *p_telemetry,
+				  struct npmx_adc_sampler *p_sampler);
+#endif
+
+/**
+ * @brief Function for reading the charger status and sending it on the charger channel.
+ *
+ * Nothing is read if the channel is not subscribed.
+ *
+ * @param[in] p_telemetry Pointer to the telemetry instance.
+ * @param[in] p_dev       Pointer to the nPM Zephyr device.
+ *
+ * @retval 0    Status sent, or channel not subscribed.
+ * @retval -EIO Error using IO bus line, or status dropped by the transport function.
+ */
+int npmx_telemetry_charger_publish(struct npmx_telemetry *p_telemetry, const struct device *p_dev);
+
+/**
+ * @brief Function for sending the event record on the event channel.
+ *
+ * Can be called from npmx event callbacks.
+ *
+ * @param[in] p_telemetry Pointer to the telemetry instance.
+ * @param[in] type        Callback type.
+ * @param[in] mask        Mask of events.
+ *
+ * @retval 0    Record sent, or channel not subscribed.
+ * @retval -EIO Record dropped by the transport function.
+ */
+int npmx_telemetry_event_publish(struct npmx_telemetry *p_telemetry, npmx_callback_type_t type,
+				 uint8_t mask);
+
+/**
+ * @brief Function for reading and clearing the number of frames dropped by the transport
+ *        function.
+ *
+ * @param[in] p_telemetry Pointer to the telemetry instance.
+ *
+ * @return Number of dropped frames.
+ */
+uint32_t npmx_telemetry_dropped_get(struct npmx_telemetry *p_telemetry);
+
+#endif /* ZEPHYR_DRIVERS_NPMX_NPMX_TELEMETRY_H__ */
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <npmx_driver.h>
+#include "npmx_vbus_limit.h"
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(NPMX, CONFIG_NPMX_LOG_LEVEL);
+
+/* Events of the CC line detection. */
+#define CC_EVENTS_MASK (NPMX_EVENT_GROUP_USB_CC1_MASK | NPMX_EVENT_GROUP_USB_CC2_MASK)
+
+static int limit_convert(uint16_t limit_ma, npmx_vbusin_current_t *p_limit)
+{
+	*p_limit = npmx_vbusin_current_convert(limit_ma);
+
+	if (*p_limit == NPMX_VBUSIN_CURRENT_INVALID) {
+		LOG_ERR("Invalid VBUS current limit: %u mA", limit_ma);
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Function for selecting the limit from the CC line states and applying it.
+ *
+ * The limit register keeps its value over USB disconnections, so it is written only if the
+ * limit changes. The apply task has to be triggered on each connection.
+ */
+static int limit_apply(struct npmx_vbus_limit *p_vl)
+{
+	npmx_vbusin_t *p_vbusin = npmx_vbusin_get(p_vl->p_pm, 0);
+	npmx_vbusin_current_t limit;
+	npmx_vbusin_cc_t cc1;
+	npmx_vbusin_cc_t cc2;
+
+	if (npmx_vbusin_cc_status_get(p_vbusin, &cc1, &cc2) != NPMX_SUCCESS) {
+		return -EIO;
+	}
+
+	/* Only one CC line is connected, depending on the orientation of the plug. */
+	npmx_vbusin_cc_t cc = (cc1 != NPMX_VBUSIN_CC_NOT_CONNECTED) ? cc1 : cc2;
+
+	limit = (cc < NPMX_VBUS_LIMIT_CC_COUNT) ? p_vl->limits[cc] :
+						  p_vl->limits[NPMX_VBUSIN_CC_DEFAULT];
+
+	if (limit != p_vl->written) {
+		if (npmx_vbusin_current_limit_set(p_vbusin, limit) != NPMX_SUCCESS) {
+			/* Written again on the next attempt. */
+			p_vl->written = NPMX_VBUSIN_CURRENT_INVALID;
+			return -EIO;
+		}
+		p_vl->written = limit;
+	}
+
+	if (npmx_vbusin_task_trigger(p_vbusin, NPMX_VBUSIN_TASK_APPLY_CURRENT_LIMIT) !=
+	    NPMX_SUCCESS) {
+		return -EIO;
+	}
+
+	return 0;
+}
+
+int npmx_vbus_limit_start(struct npmx_vbus_limit *p_vl, const struct device *p_dev,
+			  struct npmx_vbus_limit_config const *p_config)
+{
+	npmx_instance_t *npmx_instance = npmx_driver_instance_get(p_dev);
+	uint8_t vbus_status;
+
+	p_vl->p_pm = NULL;
+	p_vl->written = NPMX_VBUSIN_CURRENT_INVALID;
+
+	if (p_config == NULL) {
+		return 0;
+	}
+
+	/* Limits are converted once, so that events only select one of them. */
+	if ((limit_convert(p_config->default_ma, &p_vl->limits[NPMX_VBUSIN_CC_DEFAULT]) != 0) ||
+	    (limit_convert(p_config->cc_1a5_ma, &p_vl->limits[NPMX_VBUSIN_CC_HIGH_POWER_1A5]) !=
+	     0) ||
+	    (limit_convert(p_config->cc_3a0_ma, &p_vl->limits[NPMX_VBUSIN_CC_HIGH_POWER_3A0]) !=
+	     0)) {
+		return -EINVAL;
+	}
+	p_vl->limits[NPMX_VBUSIN_CC_NOT_CONNECTED] = p_vl->limits[NPMX_VBUSIN_CC_DEFAULT];
+
+	if ((npmx_core_event_interrupt_enable(npmx_instance, NPMX_EVENT_GROUP_VBUSIN_VOLTAGE,
+					      NPMX_EVENT_GROUP_VBUSIN_DETECTED_MASK) !=
+	     NPMX_SUCCESS) ||
+	    (npmx_core_event_interrupt_enable(npmx_instance, NPMX_EVENT_GROUP_VBUSIN_THERMAL,
+					      CC_EVENTS_MASK) != NPMX_SUCCESS)) {
+		return -EIO;
+	}
+
+	p_vl->p_pm = npmx_instance;
+
+	/* Events enabled first, so that a connection after the read below is not missed. */
+	if (npmx_vbusin_vbus_status_get(npmx_vbusin_get(npmx_instance, 0), &vbus_status) !=
+	    NPMX_SUCCESS) {
+		return -EIO;
+	}
+
+	return (vbus_status & NPMX_VBUSIN_STATUS_CONNECTED_MASK) ? limit_apply(p_vl) : 0;
+}
+
+void npmx_vbus_limit_event(struct npmx_vbus_limit *p_vl, npmx_callback_type_t type,
+			   uint8_t mask)
+{
+	if (p_vl->p_pm == NULL) {
+		return;
+	}
+
+	if (((type == NPMX_CALLBACK_TYPE_EVENT_VBUSIN_VOLTAGE) &&
+	     ((mask & NPMX_EVENT_GROUP_VBUSIN_DETECTED_MASK) != 0)) ||
+	    ((type == NPMX_CALLBACK_TYPE_EVENT_VBUSIN_THERMAL_USB) &&
+	     ((mask & CC_EVENTS_MASK) != 0))) {
+		if (limit_apply(p_vl) != 0) {
+			LOG_ERR("Failed to apply VBUS current limit");
+		}
+	}
+}
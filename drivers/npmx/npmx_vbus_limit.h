@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef ZEPHYR_DRIVERS_NPMX_NPMX_VBUS_LIMIT_H__
+#define ZEPHYR_DRIVERS_NPMX_NPMX_VBUS_LIMIT_H__
+
+#include <npmx_core.h>
+#include <npmx_vbusin.h>
+
+#include <zephyr/device.h>
+#include <zephyr/devicetree.h>
+
+/** @brief Number of CC line states the limits are selected for. */
+#define NPMX_VBUS_LIMIT_CC_COUNT (NPMX_VBUSIN_CC_HIGH_POWER_3A0 + 1)
+
+/** @brief VBUS current limits in milliamperes, from the charger node of the devicetree. */
+struct npmx_vbus_limit_config {
+	uint16_t default_ma; /* Limit if no USB-C high power current is advertised. */
+	uint16_t cc_1a5_ma; /* Limit if 1.5 A is advertised on a CC line. */
+	uint16_t cc_3a0_ma; /* Limit if 3.0 A is advertised on a CC line. */
+};
+
+/** @brief VBUS current limit handler. All fields are private. */
+struct npmx_vbus_limit {
+	npmx_instance_t *p_pm; /* Pointer to the npmx instance, NULL if the handler is inactive. */
+	npmx_vbusin_current_t limits[NPMX_VBUS_LIMIT_CC_COUNT]; /* Limits for each CC state. */
+	npmx_vbusin_current_t written; /* Limit written to the nPM device. */
+};
+
+/**
+ * @brief Function for converting the limits, enabling the VBUS and CC events and applying the
+ *        limit if VBUS is already connected.
+ *
+ * The handler stays inactive if there is no configuration.
+ *
+ * @param[in] p_vl     Pointer to the VBUS current limit handler.
+ * @param[in] p_dev    Pointer to the nPM Zephyr device.
+ * @param[in] p_config Pointer to the configuration, or NULL.
+ *
+ * @retval 0       Handler started, or inactive.
+ * @retval -EINVAL Limit not supported by the nPM device.
+ * @retval -EIO    Error using IO bus line.
+ */
+int npmx_vbus_limit_start(struct npmx_vbus_limit *p_vl, const struct device *p_dev,
+			  struct npmx_vbus_limit_config const *p_config);
+
+/**
+ * @brief Function for applying the limit on VBUS detection and CC line changes.
+ *
+ * Called from the generic callback of the driver, before the events are delivered to
+ * subscribers.
+ *
+ * @param[in] p_vl Pointer to the VBUS current limit handler.
+ * @param[in] type Callback type.
+ * @param[in] mask Mask of events.
+ */
+void npmx_vbus_limit_event(struct npmx_vbus_limit *p_vl, npmx_callback_type_t type,
+			   uint8_t mask);
+
+/* Helpers for NPMX_VBUS_LIMIT_CONFIG_DEFINE. */
+#define NPMX_VBUS_LIMIT_CHARGER(node_id)                                                           \
+	{                                                                                          \
+		.default_ma = DT_PROP(node_id, vbus_current_limit_milliamp),                       \
+		.cc_1a5_ma = DT_PROP_OR(node_id, vbus_current_limit_1a5_milliamp,                  \
+					DT_PROP(node_id, vbus_current_limit_milliamp)),            \
+		.cc_3a0_ma = DT_PROP_OR(node_id, vbus_current_limit_3a0_milliamp,                  \
+					DT_PROP(node_id, vbus_current_limit_milliamp)),            \
+	},
+
+#define NPMX_VBUS_LIMIT_CHARGER_IF(node_id)                                                        \
+	COND_CODE_1(UTIL_AND(DT_NODE_HAS_COMPAT(node_id, nordic_npmx_npm1300_charger),             \
+			     DT_NODE_HAS_PROP(node_id, vbus_current_limit_milliamp)),              \
+		    (NPMX_VBUS_LIMIT_CHARGER(node_id)), ())
+
+/**
+ * @brief Macro for defining the VBUS current limits of the nPM device instance.
+ *
+ * Limits are taken from the charger child node with the vbus-current-limit-milliamp property.
+ *
+ * @param inst Devicetree instance number.
+ */
+#define NPMX_VBUS_LIMIT_CONFIG_DEFINE(inst)                                                        \
+	static const struct npmx_vbus_limit_config npmx_vbus_limits_##inst[] = {                   \
+		DT_INST_FOREACH_CHILD_STATUS_OKAY(inst, NPMX_VBUS_LIMIT_CHARGER_IF)                \
+	};
+
+/**
+ * @brief Macro for getting the pointer to the VBUS current limits defined with
+ *        @ref NPMX_VBUS_LIMIT_CONFIG_DEFINE, or NULL if there are none.
+ *
+ * @param inst Devicetree instance number.
+ */
+#define NPMX_VBUS_LIMIT_CONFIG_GET(inst)                                                           \
+	((ARRAY_SIZE(npmx_vbus_limits_##inst) > 0) ? &npmx_vbus_limits_##inst[0] : NULL)
+
+#endif /* ZEPHYR_DRIVERS_NPMX_NPMX_VBUS_LIMIT_H__ */
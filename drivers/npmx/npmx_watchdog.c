@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "npmx_watchdog.h"
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(NPMX, CONFIG_NPMX_LOG_LEVEL);
+
+/* TIMER tick frequencies in Hz, divided from the 32.768 kHz clock. The nominal 16 ms and 2 ms
+ * tick periods are slightly longer, so deadlines computed from these stay on the safe side.
+ */
+static const uint32_t prescaler_hz[NPMX_TIMER_PRESCALER_COUNT] = {
+	[NPMX_TIMER_PRESCALER_SLOW] = 64,
+	[NPMX_TIMER_PRESCALER_FAST] = 512,
+};
+
+/**
+ * @brief Function for claiming the kick of the current period.
+ *
+ * @param[in]  p_wdt      Pointer to the service state.
+ * @param[in]  deadline   True at the deadline, false when piggybacking on other accesses.
+ * @param[out] p_consumed Pointer to the check-in bits consumed by the kick.
+ *
+ * @retval true  The kick has to be sent by the caller.
+ * @retval false No kick is due.
+ */
+static bool kick_claim(struct npmx_watchdog *p_wdt, bool deadline, uint32_t *p_consumed)
+{
+	k_spinlock_key_t key = k_spin_lock(&p_wdt->lock);
+	int64_t now = k_uptime_get();
+	uint32_t missing = p_wdt->required & ~(uint32_t)atomic_get(&p_wdt->checked_in);
+	bool kick = false;
+
+	if (!p_wdt->running) {
+		/* Stopped, or kicking given up. */
+	} else if (missing != 0) {
+		if (deadline) {
+			p_wdt->running = false;
+			p_wdt->stats.missed++;
+		}
+	} else if (deadline || ((now - p_wdt->last_kick) >= p_wdt->window_ms)) {
+		p_wdt->last_kick = now;
+		*p_consumed = p_wdt->required;
+		(void)atomic_and(&p_wdt->checked_in, ~(atomic_val_t)p_wdt->required);
+		kick = true;
+	}
+
+	k_spin_unlock(&p_wdt->lock, key);
+
+	if (deadline && (missing != 0)) {
+		LOG_ERR("%s: watchdog not kicked, missing check-ins 0x%08X", p_wdt->p_dev->name,
+			missing);
+	}
+
+	return kick;
+}
+
+static bool kick_trigger(struct npmx_watchdog *p_wdt)
+{
+	npmx_timer_t *timer_instance = npmx_timer_get(npmx_driver_instance_get(p_wdt->p_dev), 0);
+
+	return npmx_timer_task_trigger(timer_instance, NPMX_TIMER_TASK_KICK) == NPMX_SUCCESS;
+}
+
+/**
+ * @brief Function for scheduling the next kick after the claimed kick is sent or has failed.
+ *
+ * @param[in] p_wdt       Pointer to the service state.
+ * @param[in] consumed    Check-in bits consumed by the kick.
+ * @param[in] sent        True if the kick reached the device.
+ * @param[in] piggybacked True if the kick was sent together with other accesses.
+ */
+static void kick_done(struct npmx_watchdog *p_wdt, uint32_t consumed, bool sent, bool piggybacked)
+{
+	uint32_t margin_ms = (p_wdt->interval_ms * CONFIG_NPMX_WATCHDOG_MARGIN_PERCENT) /
+			     (100 - CONFIG_NPMX_WATCHDOG_MARGIN_PERCENT);
+	k_spinlock_key_t key = k_spin_lock(&p_wdt->lock);
+
+	if (sent) {
+		p_wdt->stats.kicks++;
+		p_wdt->stats.piggybacked += piggybacked ? 1 : 0;
+	} else {
+		p_wdt->stats.errors++;
+		/* Give the check-ins back, so the retry is not blocked by them. */
+		(void)atomic_or(&p_wdt->checked_in, (atomic_val_t)consumed);
+	}
+
+	k_spin_unlock(&p_wdt->lock, key);
+
+	if (sent) {
+		(void)k_work_reschedule(&p_wdt->work, K_MSEC(p_wdt->interval_ms));
+	} else {
+		/* Retry within the margin, before the watchdog expires. */
+		LOG_ERR("%s: watchdog kick failed", p_wdt->p_dev->name);
+		(void)k_work_reschedule(&p_wdt->work, K_MSEC(margin_ms / 2));
+	}
+}
+
+static void watchdog_work_cb(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct npmx_watchdog *p_wdt = CONTAINER_OF(dwork, struct npmx_watchdog, work);
+	uint32_t consumed;
+
+	if (kick_claim(p_wdt, true, &consumed)) {
+		kick_done(p_wdt, consumed, kick_trigger(p_wdt), false);
+	}
+}
+
+void npmx_watchdog_init(struct npmx_watchdog *p_wdt, const struct device *p_dev)
+{
+	p_wdt->p_dev = p_dev;
+	p_wdt->running = false;
+
+	atomic_set(&p_wdt->checked_in, 0);
+
+	k_work_init_delayable(&p_wdt->work, watchdog_work_cb);
+}
+
+int npmx_watchdog_start(struct npmx_watchdog *p_wdt, npmx_timer_config_t const *p_config,
+			uint32_t required_mask)
+{
+	npmx_timer_t *timer_instance = npmx_timer_get(npmx_driver_instance_get(p_wdt->p_dev), 0);
+	uint64_t period_ms;
+	uint32_t interval_ms;
+	k_spinlock_key_t key;
+
+	if (((p_config->mode != NPMX_TIMER_MODE_WATCHDOG_WARNING) &&
+	     (p_config->mode != NPMX_TIMER_MODE_WATCHDOG_RESET)) ||
+	    (p_config->prescaler >= NPMX_TIMER_PRESCALER_COUNT) ||
+	    (p_config->compare_value > NPM_TIMER_COUNTER_COMPARE_VALUE_MAX)) {
+		return -EINVAL;
+	}
+
+	period_ms = ((uint64_t)p_config->compare_value * MSEC_PER_SEC) /
+		    prescaler_hz[p_config->prescaler];
+	interval_ms = (uint32_t)((period_ms * (100 - CONFIG_NPMX_WATCHDOG_MARGIN_PERCENT)) / 100);
+
+	if (interval_ms == 0) {
+		return -EINVAL;
+	}
+
+	/* Restart kicking with the new deadline. */
+	(void)npmx_watchdog_stop(p_wdt);
+
+	if ((npmx_timer_config_set(timer_instance, p_config) != NPMX_SUCCESS) ||
+	    (npmx_timer_task_trigger(timer_instance, NPMX_TIMER_TASK_ENABLE) != NPMX_SUCCESS)) {
+		return -EIO;
+	}
+
+	key = k_spin_lock(&p_wdt->lock);
+
+	p_wdt->interval_ms = interval_ms;
+	p_wdt->window_ms = (interval_ms * CONFIG_NPMX_WATCHDOG_PIGGYBACK_PERCENT) / 100;
+	p_wdt->required = required_mask;
+	p_wdt->last_kick = k_uptime_get();
+	p_wdt->running = true;
+	atomic_set(&p_wdt->checked_in, 0);
+
+	k_spin_unlock(&p_wdt->lock, key);
+
+	(void)k_work_reschedule(&p_wdt->work, K_MSEC(interval_ms));
+
+	LOG_DBG("%s: watchdog period %u ms, kick interval %u ms", p_wdt->p_dev->name,
+		(uint32_t)period_ms, interval_ms);
+
+	return 0;
+}
+
+int npmx_watchdog_stop(struct npmx_watchdog *p_wdt)
+{
+	npmx_timer_t *timer_instance = npmx_timer_get(npmx_driver_instance_get(p_wdt->p_dev), 0);
+	struct k_work_sync sync;
+	k_spinlock_key_t key = k_spin_lock(&p_wdt->lock);
+
+	p_wdt->running = false;
+
+	k_spin_unlock(&p_wdt->lock, key);
+
+	(void)k_work_cancel_delayable_sync(&p_wdt->work, &sync);
+
+	if (npmx_timer_task_trigger(timer_instance, NPMX_TIMER_TASK_DISABLE) != NPMX_SUCCESS) {
+		return -EIO;
+	}
+
+	return 0;
+}
+
+void npmx_watchdog_checkin(struct npmx_watchdog *p_wdt, uint32_t mask)
+{
+	(void)atomic_or(&p_wdt->checked_in, (atomic_val_t)mask);
+}
+
+void npmx_watchdog_stats_get(struct npmx_watchdog *p_wdt,
+			     struct npmx_driver_watchdog_stats *p_stats)
+{
+	k_spinlock_key_t key = k_spin_lock(&p_wdt->lock);
+
+	*p_stats = p_wdt->stats;
+
+	k_spin_unlock(&p_wdt->lock, key);
+}
+
+bool npmx_watchdog_piggyback(struct npmx_watchdog *p_wdt, uint32_t *p_consumed)
+{
+	if (!kick_claim(p_wdt, false, p_consumed)) {
+		return false;
+	}
+
+	/* The task trigger only queues the kick in the batch. */
+	if (!kick_trigger(p_wdt)) {
+		kick_done(p_wdt, *p_consumed, false, true);
+		return false;
+	}
+
+	return true;
+}
+
+void npmx_watchdog_piggyback_done(struct npmx_watchdog *p_wdt, uint32_t consumed, int err)
+{
+	kick_done(p_wdt, consumed, err == 0, true);
+}
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef ZEPHYR_DRIVERS_NPMX_NPMX_WATCHDOG_H__
+#define ZEPHYR_DRIVERS_NPMX_NPMX_WATCHDOG_H__
+
+#include <npmx_driver.h>
+#include <npmx_timer.h>
+
+#include <zephyr/device.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+
+/** @brief Watchdog kicking service state. All fields are private. */
+struct npmx_watchdog {
+	const struct device *p_dev; /* Pointer to the nPM Zephyr device. */
+	struct k_work_delayable work; /* Kicks the watchdog at the deadline. */
+	struct k_spinlock lock; /* Serializes claiming of kicks. */
+	bool running; /* Watchdog is kicked by the service. */
+	uint32_t interval_ms; /* Time from a kick to the next scheduled kick. */
+	uint32_t window_ms; /* Time from a kick after which kicks can be piggybacked. */
+	int64_t last_kick; /* Uptime of the last kick in milliseconds. */
+	uint32_t required; /* Check-in bits required before each kick. */
+	atomic_t checked_in; /* Check-in bits set since the last kick. */
+	struct npmx_driver_watchdog_stats stats; /* Protected by the lock. */
+};
+
+/**
+ * @brief Function for initializing the watchdog kicking service.
+ *
+ * @param[in] p_wdt Pointer to the service state.
+ * @param[in] p_dev Pointer to the nPM Zephyr device.
+ */
+void npmx_watchdog_init(struct npmx_watchdog *p_wdt, const struct device *p_dev);
+
+/**
+ * @brief Function for configuring the TIMER as watchdog and starting kicking it.
+ *
+ * @param[in] p_wdt         Pointer to the service state.
+ * @param[in] p_config      Pointer to the TIMER configuration, in one of the watchdog modes.
+ * @param[in] required_mask Check-in bits required before each kick, 0 to kick unconditionally.
+ *
+ * @retval 0       Watchdog started.
+ * @retval -EINVAL Invalid configuration.
+ * @retval -EIO    Error using IO bus line.
+ */
+int npmx_watchdog_start(struct npmx_watchdog *p_wdt, npmx_timer_config_t const *p_config,
+			uint32_t required_mask);
+
+/**
+ * @brief Function for stopping kicking and disabling the TIMER.
+ *
+ * @param[in] p_wdt Pointer to the service state.
+ *
+ * @retval 0    Watchdog stopped.
+ * @retval -EIO Error using IO bus line.
+ */
+int npmx_watchdog_stop(struct npmx_watchdog *p_wdt);
+
+/**
+ * @brief Function for setting check-in bits.
+ *
+ * @param[in] p_wdt Pointer to the service state.
+ * @param[in] mask  Check-in bits to be set.
+ */
+void npmx_watchdog_checkin(struct npmx_watchdog *p_wdt, uint32_t mask);
+
+/**
+ * @brief Function for reading the service statistics.
+ *
+ * @param[in]  p_wdt   Pointer to the service state.
+ * @param[out] p_stats Pointer to the structure for the statistics.
+ */
+void npmx_watchdog_stats_get(struct npmx_watchdog *p_wdt,
+			     struct npmx_driver_watchdog_stats *p_stats);
+
+/**
+ * @brief Function for adding the watchdog kick to register accesses about to be sent.
+ *
+ * Called by the thread owning the batch right before it is sent. The kick is queued in the batch
+ * if the piggyback window of the current period is open and all required check-ins are done.
+ * The result of sending a queued kick is reported with @ref npmx_watchdog_piggyback_done.
+ *
+ * @param[in]  p_wdt      Pointer to the service state.
+ * @param[out] p_consumed Pointer to the check-in bits consumed by the queued kick.
+ *
+ * @retval true  Kick queued in the batch.
+ * @retval false No kick is due, or queuing the kick failed.
+ */
+bool npmx_watchdog_piggyback(struct npmx_watchdog *p_wdt, uint32_t *p_consumed);
+
+/**
+ * @brief Function for reporting the result of sending the batch with the piggybacked kick.
+ *
+ * The next kick is scheduled a full interval away only if the batch was sent. Otherwise, the
+ * check-ins are given back and the kick is retried within the margin.
+ *
+ * @param[in] p_wdt    Pointer to the service state.
+ * @param[in] consumed Check-in bits consumed by the kick, as returned by npmx_watchdog_piggyback.
+ * @param[in] err      Result of sending the batch.
+ */
+void npmx_watchdog_piggyback_done(struct npmx_watchdog *p_wdt, uint32_t consumed, int err);
+
+#endif /* ZEPHYR_DRIVERS_NPMX_NPMX_WATCHDOG_H__ */
@@ -8,6 +8,9 @@
 #include <npmx_driver.h>
 #include <math.h>
 
+/* Maximum time of a single ADC measurement. */
+#define ADC_MEAS_TIMEOUT_MS 100
+
 /** @brief NTC thermistor configuration parameter. */
 typedef enum {
 	ADC_NTC_CONFIG_PARAM_TYPE, /* Battery NTC type. */
@@ -31,40 +34,38 @@ static int adc_meas_get(const struct shell *shell, npmx_adc_meas_t adc_meas,
 		return 0;
 	}
 
-	npmx_error_t err_code = npmx_adc_task_trigger(adc_instance, adc_task);
-	if (!check_error_code(shell, err_code)) {
-		shell_error(shell, "Error: unable to trigger the measurement.");
-		return 0;
-	}
-
-	int32_t value;
-	bool meas_get = false;
-	while (!meas_get) {
-		err_code = npmx_adc_meas_check(adc_instance, adc_meas, &meas_get);
-		if (!check_error_code(shell, err_code)) {
-			print_get_error(shell, "measurement status");
-			return 0;
-		}
-	}
-
-	err_code = npmx_adc_meas_get(adc_instance, adc_meas, &value);
-	if (!check_error_code(shell, err_code)) {
-		print_get_error(shell, "measurement");
-		return 0;
-	}
-
 	unit_type_t unit_type;
+	uint8_t event_mask;
 	switch (adc_meas) {
 	case NPMX_ADC_MEAS_VBAT:
 		unit_type = UNIT_TYPE_MILLIVOLT;
+		event_mask = NPMX_EVENT_GROUP_ADC_BAT_READY_MASK;
 		break;
 	case NPMX_ADC_MEAS_VBAT2_IBAT:
 		unit_type = UNIT_TYPE_MILLIAMPERE;
+		event_mask = NPMX_EVENT_GROUP_ADC_IBAT_READY_MASK;
 		break;
 	default:
 		return 0;
 	}
 
+	int err = npmx_driver_adc_meas_wait(pmic_dev_get(), adc_task, event_mask,
+					    ADC_MEAS_TIMEOUT_MS);
+	if (err == -ETIMEDOUT) {
+		shell_error(shell, "Error: measurement timed out.");
+		return 0;
+	} else if (err != 0) {
+		shell_error(shell, "Error: unable to perform the measurement.");
+		return 0;
+	}
+
+	int32_t value;
+	npmx_error_t err_code = npmx_adc_meas_get(adc_instance, adc_meas, &value);
+	if (!check_error_code(shell, err_code)) {
+		print_get_error(shell, "measurement");
+		return 0;
+	}
+
 	print_value(shell, value, unit_type);
 	return 0;
 }
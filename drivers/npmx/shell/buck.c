@@ -4,77 +4,85 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
-#include "shell_common.h"
+#include "shell_table.h"
 #include <npmx_driver.h>
 
-/** @brief BUCK GPIO configuration parameter. */
-typedef enum {
-	BUCK_GPIO_PARAM_INDEX, /* Pin index. */
-	BUCK_GPIO_PARAM_POLARITY, /* Pin polarity. */
-} buck_gpio_param_t;
-
-static npmx_buck_t *buck_instance_get(const struct shell *shell, uint32_t index)
-{
-	npmx_instance_t *npmx_instance = npmx_instance_get(shell);
-	bool status = check_instance_index(shell, "buck", index, NPM_BUCK_COUNT);
-
-	return (npmx_instance && status) ? npmx_buck_get(npmx_instance, (uint8_t)index) : NULL;
-}
-
-static int cmd_buck_active_discharge_set(const struct shell *shell, size_t argc, char **argv)
-{
-	args_info_t args_info = { .expected_args = 2,
-				  .arg = {
-					  [0] = { SHELL_ARG_TYPE_UINT32_INDEX, "buck" },
-					  [1] = { SHELL_ARG_TYPE_BOOL_VALUE, "active discharge" },
-				  } };
-	if (!arguments_check(shell, argc, argv, &args_info)) {
-		return 0;
-	}
-
-	npmx_buck_t *buck_instance = buck_instance_get(shell, args_info.arg[0].result.uvalue);
-	if (buck_instance == NULL) {
-		return 0;
-	}
-
-	bool active_discharge = args_info.arg[1].result.bvalue;
-	npmx_error_t err_code =
-		npmx_buck_active_discharge_enable_set(buck_instance, active_discharge);
-	if (!check_error_code(shell, err_code)) {
-		print_set_error(shell, "active discharge");
-		return 0;
-	}
-
-	print_success(shell, active_discharge, UNIT_TYPE_NONE);
-	return 0;
-}
-
-static int cmd_buck_active_discharge_get(const struct shell *shell, size_t argc, char **argv)
-{
-	args_info_t args_info = { .expected_args = 1,
-				  .arg = {
-					  [0] = { SHELL_ARG_TYPE_UINT32_INDEX, "buck" },
-				  } };
-	if (!arguments_check(shell, argc, argv, &args_info)) {
-		return 0;
-	}
-
-	npmx_buck_t *buck_instance = buck_instance_get(shell, args_info.arg[0].result.uvalue);
-	if (buck_instance == NULL) {
-		return 0;
-	}
-
-	bool discharge_enable;
-	npmx_error_t err_code =
-		npmx_buck_active_discharge_enable_get(buck_instance, &discharge_enable);
-	if (!check_error_code(shell, err_code)) {
-		print_get_error(shell, "active discharge");
-		return 0;
-	}
-
-	print_value(shell, discharge_enable, UNIT_TYPE_NONE);
-	return 0;
-}
+SHELL_PARAM_INSTANCE_GETTER(buck_param_instance_get, npmx_buck_get)
+SHELL_PARAM_SETTER(buck_active_discharge_set, npmx_buck_t, bool,
+		   npmx_buck_active_discharge_enable_set)
+SHELL_PARAM_GETTER(buck_active_discharge_get, npmx_buck_t, bool,
+		   npmx_buck_active_discharge_enable_get)
+SHELL_PARAM_SETTER(buck_mode_set, npmx_buck_t, npmx_buck_mode_t, npmx_buck_converter_mode_set)
+SHELL_PARAM_SETTER(buck_vout_select_set, npmx_buck_t, npmx_buck_vout_select_t,
+		   npmx_buck_vout_select_set)
+SHELL_PARAM_GETTER(buck_vout_select_get, npmx_buck_t, npmx_buck_vout_select_t,
+		   npmx_buck_vout_select_get)
+SHELL_PARAM_SETTER(buck_normal_voltage_set, npmx_buck_t, npmx_buck_voltage_t,
+		   npmx_buck_normal_voltage_set)
+SHELL_PARAM_SETTER(buck_retention_voltage_set, npmx_buck_t, npmx_buck_voltage_t,
+		   npmx_buck_retention_voltage_set)
+SHELL_PARAM_GETTER(buck_retention_voltage_get, npmx_buck_t, npmx_buck_voltage_t,
+		   npmx_buck_retention_voltage_get)
+SHELL_PARAM_TO_NPMX(buck_voltage_to_npmx, npmx_buck_voltage_t, npmx_buck_voltage_convert,
+		    NPMX_BUCK_VOLTAGE_INVALID)
+SHELL_PARAM_FROM_NPMX(buck_voltage_from_npmx, npmx_buck_voltage_t,
+		      npmx_buck_voltage_convert_to_mv)
+
+/**
+ * @brief Macro for defining the setters and getters of the pin index and polarity of a buck GPIO
+ *        configuration.
+ *
+ * @param _config GPIO configuration name in the npmx accessors, for example enable.
+ */
+#define BUCK_GPIO_ACCESSORS(_config)                                                               \
+	static npmx_error_t buck_##_config##_gpio_index_set(void const *p_instance, int32_t value) \
+	{                                                                                          \
+		npmx_buck_gpio_config_t gpio_config;                                               \
+		npmx_error_t err_code =                                                            \
+			npmx_buck_##_config##_gpio_config_get(p_instance, &gpio_config);           \
+		if (err_code != NPMX_SUCCESS) {                                                    \
+			return err_code;                                                           \
+		}                                                                                  \
+		gpio_config.gpio = (npmx_buck_gpio_t)value;                                        \
+		return npmx_buck_##_config##_gpio_config_set(p_instance, &gpio_config);            \
+	}                                                                                          \
+                                                                                                   \
+	static npmx_error_t buck_##_config##_gpio_index_get(void const *p_instance,                \
+							    int32_t *p_value)                      \
+	{                                                                                          \
+		npmx_buck_gpio_config_t gpio_config;                                               \
+		npmx_error_t err_code =                                                            \
+			npmx_buck_##_config##_gpio_config_get(p_instance, &gpio_config);           \
+		*p_value = (int32_t)gpio_config.gpio;                                              \
+		return err_code;                                                                   \
+	}                                                                                          \
+                                                                                                   \
+	static npmx_error_t buck_##_config##_gpio_polarity_set(void const *p_instance,             \
+							       int32_t value)                      \
+	{                                                                                          \
+		npmx_buck_gpio_config_t gpio_config;                                               \
+		npmx_error_t err_code =                                                            \
+			npmx_buck_##_config##_gpio_config_get(p_instance, &gpio_config);           \
+		if (err_code != NPMX_SUCCESS) {                                                    \
+			return err_code;                                                           \
+		}                                                                                  \
+		gpio_config.inverted = (value != 0);                                               \
+		return npmx_buck_##_config##_gpio_config_set(p_instance, &gpio_config);            \
+	}                                                                                          \
+                                                                                                   \
+	static npmx_error_t buck_##_config##_gpio_polarity_get(void const *p_instance,             \
+							       int32_t *p_value)                   \
+	{                                                                                          \
+		npmx_buck_gpio_config_t gpio_config;                                               \
+		npmx_error_t err_code =                                                            \
+			npmx_buck_##_config##_gpio_config_get(p_instance, &gpio_config);           \
+		*p_value = gpio_config.inverted ? 1 : 0;                                           \
+		return err_code;                                                                   \
+	}
+
+BUCK_GPIO_ACCESSORS(enable)
+BUCK_GPIO_ACCESSORS(forced_pwm)
+BUCK_GPIO_ACCESSORS(retention)
 
 static npmx_buck_gpio_t buck_gpio_index_convert(int32_t gpio_index)
 {
@@ -96,470 +104,192 @@ static npmx_buck_gpio_t buck_gpio_index_convert(int32_t gpio_index)
 	}
 }
 
-static int
-buck_gpio_set(const struct shell *shell, size_t argc, char **argv,
-	      npmx_error_t (*gpio_config_set)(npmx_buck_t const *, npmx_buck_gpio_config_t const *),
-	      npmx_error_t (*gpio_config_get)(npmx_buck_t const *, npmx_buck_gpio_config_t *),
-	      buck_gpio_param_t config_type)
-{
-	char *config_name;
-	shell_arg_type_t arg_type = SHELL_ARG_TYPE_INT32_VALUE;
-
-	switch (config_type) {
-	case BUCK_GPIO_PARAM_INDEX:
-		config_name = "GPIO number";
-		break;
-	case BUCK_GPIO_PARAM_POLARITY:
-		arg_type = SHELL_ARG_TYPE_BOOL_VALUE;
-		config_name = "GPIO polarity";
-		break;
-	default:
-		return 0;
-	}
-
-	args_info_t args_info = { .expected_args = 2,
-				  .arg = {
-					  [0] = { SHELL_ARG_TYPE_UINT32_INDEX, "buck" },
-					  [1] = { arg_type, config_name },
-				  } };
-
-	if (!arguments_check(shell, argc, argv, &args_info)) {
-		return 0;
-	}
-
-	npmx_buck_t *buck_instance = buck_instance_get(shell, args_info.arg[0].result.uvalue);
-	if (buck_instance == NULL) {
-		return 0;
-	}
-
-	npmx_buck_gpio_config_t gpio_config;
-	npmx_error_t err_code = gpio_config_get(buck_instance, &gpio_config);
-	if (!check_error_code(shell, err_code)) {
-		print_get_error(shell, "GPIO config");
-		return 0;
-	}
-
-	switch (config_type) {
-	case BUCK_GPIO_PARAM_INDEX:
-		if (!check_pin_configuration_correctness(shell, args_info.arg[1].result.ivalue)) {
-			return 0;
-		}
-		gpio_config.gpio = buck_gpio_index_convert(args_info.arg[1].result.ivalue);
-
-		if (gpio_config.gpio == NPMX_BUCK_GPIO_INVALID) {
-			shell_error(shell, "Error: wrong GPIO index.");
-			return 0;
-		}
-		break;
-	case BUCK_GPIO_PARAM_POLARITY:
-		gpio_config.inverted = args_info.arg[1].result.bvalue;
-		break;
-	default:
-		return 0;
-	}
-
-	err_code = gpio_config_set(buck_instance, &gpio_config);
-	if (!check_error_code(shell, err_code)) {
-		print_set_error(shell, "GPIO config");
-		return 0;
-	}
-
-	int16_t value = (config_type == BUCK_GPIO_PARAM_INDEX) ? args_info.arg[1].result.ivalue :
-								 gpio_config.inverted;
-
-	print_success(shell, value, UNIT_TYPE_NONE);
-	return 0;
-}
-
-static int buck_gpio_get(const struct shell *shell, size_t argc, char **argv,
-			 npmx_error_t (*gpio_config_get)(npmx_buck_t const *,
-							 npmx_buck_gpio_config_t *),
-			 buck_gpio_param_t config_type)
+static bool buck_gpio_to_npmx(int32_t value, int32_t *p_converted)
 {
-	args_info_t args_info = { .expected_args = 1,
-				  .arg = {
-					  [0] = { SHELL_ARG_TYPE_UINT32_INDEX, "buck" },
-				  } };
-	if (!arguments_check(shell, argc, argv, &args_info)) {
-		return 0;
-	}
+	npmx_buck_gpio_t gpio = buck_gpio_index_convert(value);
 
-	npmx_buck_t *buck_instance = buck_instance_get(shell, args_info.arg[0].result.uvalue);
-	if (buck_instance == NULL) {
-		return 0;
-	}
-
-	npmx_buck_gpio_config_t gpio_config;
-	npmx_error_t err_code = gpio_config_get(buck_instance, &gpio_config);
-	if (!check_error_code(shell, err_code)) {
-		print_get_error(shell, "GPIO config");
-		return 0;
-	}
-
-	switch (config_type) {
-	case BUCK_GPIO_PARAM_INDEX:
-		int8_t gpio_index = (gpio_config.gpio == NPMX_BUCK_GPIO_NC) ?
-					    -1 :
-					    ((int8_t)gpio_config.gpio - 1);
-
-		print_value(shell, gpio_index, UNIT_TYPE_NONE);
-		break;
-	case BUCK_GPIO_PARAM_POLARITY:
-		print_value(shell, gpio_config.inverted, UNIT_TYPE_NONE);
-		break;
-	default:
-		return 0;
-	}
-
-	return 0;
+	*p_converted = (int32_t)gpio;
+	return gpio != NPMX_BUCK_GPIO_INVALID;
 }
 
-static int cmd_buck_gpio_on_off_index_set(const struct shell *shell, size_t argc, char **argv)
+static bool buck_gpio_from_npmx(int32_t value, int32_t *p_converted)
 {
-	return buck_gpio_set(shell, argc, argv, npmx_buck_enable_gpio_config_set,
-			     npmx_buck_enable_gpio_config_get, BUCK_GPIO_PARAM_INDEX);
+	*p_converted = (value == NPMX_BUCK_GPIO_NC) ? -1 : (value - 1);
+	return true;
 }
 
-static int cmd_buck_gpio_on_off_index_get(const struct shell *shell, size_t argc, char **argv)
+static npmx_error_t buck_status_set(void const *p_instance, int32_t value)
 {
-	return buck_gpio_get(shell, argc, argv, npmx_buck_enable_gpio_config_get,
-			     BUCK_GPIO_PARAM_INDEX);
+	return npmx_buck_task_trigger(p_instance,
+				      value ? NPMX_BUCK_TASK_ENABLE : NPMX_BUCK_TASK_DISABLE);
 }
 
-static int cmd_buck_gpio_on_off_polarity_set(const struct shell *shell, size_t argc, char **argv)
+static npmx_error_t buck_status_get(void const *p_instance, int32_t *p_value)
 {
-	return buck_gpio_set(shell, argc, argv, npmx_buck_enable_gpio_config_set,
-			     npmx_buck_enable_gpio_config_get, BUCK_GPIO_PARAM_POLARITY);
-}
-
-static int cmd_buck_gpio_on_off_polarity_get(const struct shell *shell, size_t argc, char **argv)
-{
-	return buck_gpio_get(shell, argc, argv, npmx_buck_enable_gpio_config_get,
-			     BUCK_GPIO_PARAM_POLARITY);
-}
-
-static int cmd_buck_gpio_pwm_force_index_set(const struct shell *shell, size_t argc, char **argv)
-{
-	return buck_gpio_set(shell, argc, argv, npmx_buck_forced_pwm_gpio_config_set,
-			     npmx_buck_forced_pwm_gpio_config_get, BUCK_GPIO_PARAM_INDEX);
-}
-
-static int cmd_buck_gpio_pwm_force_index_get(const struct shell *shell, size_t argc, char **argv)
-{
-	return buck_gpio_get(shell, argc, argv, npmx_buck_forced_pwm_gpio_config_get,
-			     BUCK_GPIO_PARAM_INDEX);
-}
-
-static int cmd_buck_gpio_pwm_force_polarity_set(const struct shell *shell, size_t argc, char **argv)
-{
-	return buck_gpio_set(shell, argc, argv, npmx_buck_forced_pwm_gpio_config_set,
-			     npmx_buck_forced_pwm_gpio_config_get, BUCK_GPIO_PARAM_POLARITY);
-}
-
-static int cmd_buck_gpio_pwm_force_polarity_get(const struct shell *shell, size_t argc, char **argv)
-{
-	return buck_gpio_get(shell, argc, argv, npmx_buck_forced_pwm_gpio_config_get,
-			     BUCK_GPIO_PARAM_POLARITY);
-}
-
-static int cmd_buck_gpio_retention_index_set(const struct shell *shell, size_t argc, char **argv)
-{
-	return buck_gpio_set(shell, argc, argv, npmx_buck_retention_gpio_config_set,
-			     npmx_buck_retention_gpio_config_get, BUCK_GPIO_PARAM_INDEX);
-}
-
-static int cmd_buck_gpio_retention_index_get(const struct shell *shell, size_t argc, char **argv)
-{
-	return buck_gpio_get(shell, argc, argv, npmx_buck_retention_gpio_config_get,
-			     BUCK_GPIO_PARAM_INDEX);
-}
-
-static int cmd_buck_gpio_retention_polarity_set(const struct shell *shell, size_t argc, char **argv)
-{
-	return buck_gpio_set(shell, argc, argv, npmx_buck_retention_gpio_config_set,
-			     npmx_buck_retention_gpio_config_get, BUCK_GPIO_PARAM_POLARITY);
-}
-
-static int cmd_buck_gpio_retention_polarity_get(const struct shell *shell, size_t argc, char **argv)
-{
-	return buck_gpio_get(shell, argc, argv, npmx_buck_retention_gpio_config_get,
-			     BUCK_GPIO_PARAM_POLARITY);
-}
-
-static int cmd_buck_mode_set(const struct shell *shell, size_t argc, char **argv)
-{
-	args_info_t args_info = { .expected_args = 2,
-				  .arg = {
-					  [0] = { SHELL_ARG_TYPE_UINT32_INDEX, "buck" },
-					  [1] = { SHELL_ARG_TYPE_UINT32_VALUE, "mode" },
-				  } };
-	if (!arguments_check(shell, argc, argv, &args_info)) {
-		return 0;
-	}
-
-	npmx_buck_t *buck_instance = buck_instance_get(shell, args_info.arg[0].result.uvalue);
-	if (buck_instance == NULL) {
-		return 0;
-	}
-
-	uint32_t mode = args_info.arg[1].result.uvalue;
-	npmx_buck_mode_t buck_mode;
-	switch (mode) {
-	case 0:
-		buck_mode = NPMX_BUCK_MODE_AUTO;
-		break;
-	case 1:
-		buck_mode = NPMX_BUCK_MODE_PFM;
-		break;
-	case 2:
-		buck_mode = NPMX_BUCK_MODE_PWM;
-		break;
-	default:
-		shell_error(shell, "Error: Wrong mode:");
-		print_hint_error(shell, 0, "AUTO");
-		print_hint_error(shell, 1, "PFM");
-		print_hint_error(shell, 2, "PWM");
-		return 0;
-	}
-
-	npmx_error_t err_code = npmx_buck_converter_mode_set(buck_instance, buck_mode);
-	if (!check_error_code(shell, err_code)) {
-		print_set_error(shell, "buck mode");
-		return 0;
-	}
-
-	print_success(shell, mode, UNIT_TYPE_NONE);
-	return 0;
-}
-
-static int cmd_buck_status_set(const struct shell *shell, size_t argc, char **argv)
-{
-	args_info_t args_info = { .expected_args = 2,
-				  .arg = {
-					  [0] = { SHELL_ARG_TYPE_UINT32_INDEX, "buck" },
-					  [1] = { SHELL_ARG_TYPE_BOOL_VALUE, "status" },
-				  } };
-	if (!arguments_check(shell, argc, argv, &args_info)) {
-		return 0;
-	}
-
-	npmx_buck_t *buck_instance = buck_instance_get(shell, args_info.arg[0].result.uvalue);
-	if (buck_instance == NULL) {
-		return 0;
-	}
-
-	bool status = args_info.arg[1].result.bvalue;
-	npmx_buck_task_t buck_task = status ? NPMX_BUCK_TASK_ENABLE : NPMX_BUCK_TASK_DISABLE;
-	npmx_error_t err_code = npmx_buck_task_trigger(buck_instance, buck_task);
-	if (!check_error_code(shell, err_code)) {
-		print_set_error(shell, "buck status");
-		return 0;
-	}
-
-	print_success(shell, status, UNIT_TYPE_NONE);
-	return 0;
-}
-
-static int cmd_buck_status_get(const struct shell *shell, size_t argc, char **argv)
-{
-	args_info_t args_info = { .expected_args = 1,
-				  .arg = {
-					  [0] = { SHELL_ARG_TYPE_UINT32_INDEX, "buck" },
-				  } };
-	if (!arguments_check(shell, argc, argv, &args_info)) {
-		return 0;
-	}
-
-	npmx_buck_t *buck_instance = buck_instance_get(shell, args_info.arg[0].result.uvalue);
-	if (buck_instance == NULL) {
-		return 0;
-	}
-
 	npmx_buck_status_t buck_status;
-	npmx_error_t err_code = npmx_buck_status_get(buck_instance, &buck_status);
-	if (!check_error_code(shell, err_code)) {
-		print_get_error(shell, "buck status");
-		return 0;
-	}
-
-	print_value(shell, buck_status.powered, UNIT_TYPE_NONE);
-	return 0;
-}
-
-static int buck_voltage_set(const struct shell *shell, size_t argc, char **argv,
-			    npmx_error_t (*voltage_set)(npmx_buck_t const *, npmx_buck_voltage_t))
-{
-	args_info_t args_info = { .expected_args = 2,
-				  .arg = {
-					  [0] = { SHELL_ARG_TYPE_UINT32_INDEX, "buck" },
-					  [1] = { SHELL_ARG_TYPE_UINT32_VALUE, "voltage" },
-				  } };
-	if (!arguments_check(shell, argc, argv, &args_info)) {
-		return 0;
-	}
-
-	npmx_buck_t *buck_instance = buck_instance_get(shell, args_info.arg[0].result.uvalue);
-	if (buck_instance == NULL) {
-		return 0;
-	}
-
-	uint32_t voltage_mv = args_info.arg[1].result.uvalue;
-	npmx_buck_voltage_t buck_voltage = npmx_buck_voltage_convert(voltage_mv);
-	if (buck_voltage == NPMX_BUCK_VOLTAGE_INVALID) {
-		print_convert_error(shell, "millivolts", "buck voltage");
-		return 0;
-	}
-
-	npmx_error_t err_code = voltage_set(buck_instance, buck_voltage);
-	if (!check_error_code(shell, err_code)) {
-		print_set_error(shell, "buck voltage");
-		return 0;
-	}
+	npmx_error_t err_code = npmx_buck_status_get(p_instance, &buck_status);
 
-	print_success(shell, voltage_mv, UNIT_TYPE_MILLIVOLT);
-	return 0;
+	*p_value = buck_status.powered ? 1 : 0;
+	return err_code;
 }
 
-static int buck_voltage_get(const struct shell *shell, size_t argc, char **argv,
-			    npmx_error_t (*voltage_get)(npmx_buck_t const *, npmx_buck_voltage_t *))
+/* With the voltage selected by the VSET pin, the status holds the output voltage. */
+static npmx_error_t buck_normal_voltage_get(void const *p_instance, int32_t *p_value)
 {
-	args_info_t args_info = { .expected_args = 1,
-				  .arg = {
-					  [0] = { SHELL_ARG_TYPE_UINT32_INDEX, "buck" },
-				  } };
-	if (!arguments_check(shell, argc, argv, &args_info)) {
-		return 0;
-	}
-
-	npmx_buck_t *buck_instance = buck_instance_get(shell, args_info.arg[0].result.uvalue);
-	if (buck_instance == NULL) {
-		return 0;
-	}
-
-	npmx_error_t err_code;
-	npmx_buck_voltage_t buck_voltage;
-	if (voltage_get == npmx_buck_normal_voltage_get) {
-		npmx_buck_vout_select_t vout_select;
-		err_code = npmx_buck_vout_select_get(buck_instance, &vout_select);
-		if (!check_error_code(shell, err_code)) {
-			print_get_error(shell, "vout select");
-			return 0;
-		}
-
-		if (vout_select == NPMX_BUCK_VOUT_SELECT_VSET_PIN) {
-			err_code = npmx_buck_status_voltage_get(buck_instance, &buck_voltage);
-		} else if (vout_select == NPMX_BUCK_VOUT_SELECT_SOFTWARE) {
-			err_code = voltage_get(buck_instance, &buck_voltage);
-		} else {
-			shell_error(shell, "Error: invalid vout select.");
-			return 0;
-		}
-	} else {
-		err_code = voltage_get(buck_instance, &buck_voltage);
-	}
-
-	if (!check_error_code(shell, err_code)) {
-		print_get_error(shell, "buck voltage");
-		return 0;
-	}
-
-	uint32_t voltage_mv;
-	if (!npmx_buck_voltage_convert_to_mv(buck_voltage, &voltage_mv)) {
-		print_convert_error(shell, "buck voltage", "millivolts");
-		return 0;
-	}
-
-	print_value(shell, voltage_mv, UNIT_TYPE_MILLIVOLT);
-	return 0;
-}
-
-static int cmd_buck_voltage_normal_set(const struct shell *shell, size_t argc, char **argv)
-{
-	return buck_voltage_set(shell, argc, argv, npmx_buck_normal_voltage_set);
-}
-
-static int cmd_buck_voltage_normal_get(const struct shell *shell, size_t argc, char **argv)
-{
-	return buck_voltage_get(shell, argc, argv, npmx_buck_normal_voltage_get);
-}
-
-static int cmd_buck_voltage_retention_set(const struct shell *shell, size_t argc, char **argv)
-{
-	return buck_voltage_set(shell, argc, argv, npmx_buck_retention_voltage_set);
-}
-
-static int cmd_buck_voltage_retention_get(const struct shell *shell, size_t argc, char **argv)
-{
-	return buck_voltage_get(shell, argc, argv, npmx_buck_retention_voltage_get);
-}
-
-static int cmd_buck_vout_select_set(const struct shell *shell, size_t argc, char **argv)
-{
-	args_info_t args_info = { .expected_args = 2,
-				  .arg = {
-					  [0] = { SHELL_ARG_TYPE_UINT32_INDEX, "buck" },
-					  [1] = { SHELL_ARG_TYPE_UINT32_VALUE, "vout select" },
-				  } };
-	if (!arguments_check(shell, argc, argv, &args_info)) {
-		return 0;
-	}
-
-	npmx_buck_t *buck_instance = buck_instance_get(shell, args_info.arg[0].result.uvalue);
-	if (buck_instance == NULL) {
-		return 0;
-	}
-
-	uint32_t select = args_info.arg[1].result.uvalue;
 	npmx_buck_vout_select_t vout_select;
-	switch (select) {
-	case 0:
-		vout_select = NPMX_BUCK_VOUT_SELECT_VSET_PIN;
-		break;
-	case 1:
-		vout_select = NPMX_BUCK_VOUT_SELECT_SOFTWARE;
-		break;
-	default:
-		shell_error(shell, "Error: Wrong vout select:");
-		print_hint_error(shell, 0, "Vset pin");
-		print_hint_error(shell, 1, "Software");
-		return 0;
+	npmx_buck_voltage_t buck_voltage;
+	npmx_error_t err_code = npmx_buck_vout_select_get(p_instance, &vout_select);
+	if (err_code != NPMX_SUCCESS) {
+		return err_code;
 	}
 
-	npmx_error_t err_code = npmx_buck_vout_select_set(buck_instance, vout_select);
-	if (!check_error_code(shell, err_code)) {
-		print_set_error(shell, "vout select");
-		return 0;
+	if (vout_select == NPMX_BUCK_VOUT_SELECT_VSET_PIN) {
+		err_code = npmx_buck_status_voltage_get(p_instance, &buck_voltage);
+	} else {
+		err_code = npmx_buck_normal_voltage_get(p_instance, &buck_voltage);
 	}
 
-	print_success(shell, select, UNIT_TYPE_NONE);
-	return 0;
+	*p_value = (int32_t)buck_voltage;
+	return err_code;
 }
 
-static int cmd_buck_vout_select_get(const struct shell *shell, size_t argc, char **argv)
-{
-	args_info_t args_info = { .expected_args = 1,
-				  .arg = {
-					  [0] = { SHELL_ARG_TYPE_UINT32_INDEX, "buck" },
-				  } };
-	if (!arguments_check(shell, argc, argv, &args_info)) {
-		return 0;
-	}
-
-	npmx_buck_t *buck_instance = buck_instance_get(shell, args_info.arg[0].result.uvalue);
-	if (buck_instance == NULL) {
-		return 0;
-	}
+static const shell_enum_map_t buck_modes[] = {
+	{ NPMX_BUCK_MODE_AUTO, "AUTO" },
+	{ NPMX_BUCK_MODE_PFM, "PFM" },
+	{ NPMX_BUCK_MODE_PWM, "PWM" },
+};
 
-	npmx_buck_vout_select_t vout_select;
-	npmx_error_t err_code = npmx_buck_vout_select_get(buck_instance, &vout_select);
-	if (!check_error_code(shell, err_code)) {
-		print_get_error(shell, "vout select");
-		return 0;
-	}
+static const shell_enum_map_t buck_vout_selects[] = {
+	{ NPMX_BUCK_VOUT_SELECT_VSET_PIN, "Vset pin" },
+	{ NPMX_BUCK_VOUT_SELECT_SOFTWARE, "Software" },
+};
 
-	print_value(shell, (int)vout_select, UNIT_TYPE_NONE);
-	return 0;
-}
+/**
+ * @brief Macro for initializing the descriptor of a buck GPIO pin index.
+ *
+ * @param _config GPIO configuration name used in @ref BUCK_GPIO_ACCESSORS.
+ */
+#define BUCK_GPIO_INDEX_PARAM(_config)                                                             \
+	{                                                                                          \
+		SHELL_PARAM_INSTANCE("buck", NPM_BUCK_COUNT, buck_param_instance_get),             \
+		.name = "GPIO number", .description = "GPIO config",                               \
+		.type = SHELL_ARG_TYPE_INT32_VALUE, .min = -1, .max = NPM_GPIOS_COUNT - 1,         \
+		.to_npmx = buck_gpio_to_npmx, .from_npmx = buck_gpio_from_npmx,                    \
+		.check = shell_param_pin_value_check, .unit = UNIT_TYPE_NONE,                      \
+		.set = buck_##_config##_gpio_index_set, .get = buck_##_config##_gpio_index_get,    \
+	}
+
+/**
+ * @brief Macro for initializing the descriptor of a buck GPIO polarity inversion.
+ *
+ * @param _config GPIO configuration name used in @ref BUCK_GPIO_ACCESSORS.
+ */
+#define BUCK_GPIO_POLARITY_PARAM(_config)                                                          \
+	{                                                                                          \
+		SHELL_PARAM_INSTANCE("buck", NPM_BUCK_COUNT, buck_param_instance_get),             \
+		.name = "GPIO polarity", .description = "GPIO config",                             \
+		.type = SHELL_ARG_TYPE_BOOL_VALUE, .unit = UNIT_TYPE_NONE,                         \
+		.set = buck_##_config##_gpio_polarity_set,                                         \
+		.get = buck_##_config##_gpio_polarity_get,                                         \
+	}
+
+static const shell_param_t buck_active_discharge_param = {
+	SHELL_PARAM_INSTANCE("buck", NPM_BUCK_COUNT, buck_param_instance_get),
+	.name = "active discharge",
+	.description = "active discharge",
+	.type = SHELL_ARG_TYPE_BOOL_VALUE,
+	.unit = UNIT_TYPE_NONE,
+	.set = buck_active_discharge_set,
+	.get = buck_active_discharge_get,
+};
+
+static const shell_param_t buck_gpio_on_off_index_param = BUCK_GPIO_INDEX_PARAM(enable);
+static const shell_param_t buck_gpio_on_off_polarity_param = BUCK_GPIO_POLARITY_PARAM(enable);
+static const shell_param_t buck_gpio_pwm_force_index_param = BUCK_GPIO_INDEX_PARAM(forced_pwm);
+static const shell_param_t buck_gpio_pwm_force_polarity_param =
+	BUCK_GPIO_POLARITY_PARAM(forced_pwm);
+static const shell_param_t buck_gpio_retention_index_param = BUCK_GPIO_INDEX_PARAM(retention);
+static const shell_param_t buck_gpio_retention_polarity_param =
+	BUCK_GPIO_POLARITY_PARAM(retention);
+
+static const shell_param_t buck_mode_param = {
+	SHELL_PARAM_INSTANCE("buck", NPM_BUCK_COUNT, buck_param_instance_get),
+	.name = "mode",
+	.description = "buck mode",
+	.type = SHELL_ARG_TYPE_UINT32_VALUE,
+	SHELL_PARAM_MAP(buck_modes),
+	.unit = UNIT_TYPE_NONE,
+	.set = buck_mode_set,
+};
+
+static const shell_param_t buck_status_param = {
+	SHELL_PARAM_INSTANCE("buck", NPM_BUCK_COUNT, buck_param_instance_get),
+	.name = "status",
+	.description = "buck status",
+	.type = SHELL_ARG_TYPE_BOOL_VALUE,
+	.unit = UNIT_TYPE_NONE,
+	.set = buck_status_set,
+	.get = buck_status_get,
+};
+
+static const shell_param_t buck_voltage_normal_param = {
+	SHELL_PARAM_INSTANCE("buck", NPM_BUCK_COUNT, buck_param_instance_get),
+	.name = "voltage",
+	.description = "buck voltage",
+	.type = SHELL_ARG_TYPE_UINT32_VALUE,
+	.to_npmx = buck_voltage_to_npmx,
+	.from_npmx = buck_voltage_from_npmx,
+	.unit = UNIT_TYPE_MILLIVOLT,
+	.set = buck_normal_voltage_set,
+	.get = buck_normal_voltage_get,
+};
+
+static const shell_param_t buck_voltage_retention_param = {
+	SHELL_PARAM_INSTANCE("buck", NPM_BUCK_COUNT, buck_param_instance_get),
+	.name = "voltage",
+	.description = "buck voltage",
+	.type = SHELL_ARG_TYPE_UINT32_VALUE,
+	.to_npmx = buck_voltage_to_npmx,
+	.from_npmx = buck_voltage_from_npmx,
+	.unit = UNIT_TYPE_MILLIVOLT,
+	.set = buck_retention_voltage_set,
+	.get = buck_retention_voltage_get,
+};
+
+static const shell_param_t buck_vout_select_param = {
+	SHELL_PARAM_INSTANCE("buck", NPM_BUCK_COUNT, buck_param_instance_get),
+	.name = "vout select",
+	.description = "vout select",
+	.type = SHELL_ARG_TYPE_UINT32_VALUE,
+	SHELL_PARAM_MAP(buck_vout_selects),
+	.unit = UNIT_TYPE_NONE,
+	.set = buck_vout_select_set,
+	.get = buck_vout_select_get,
+};
+
+SHELL_PARAM_CMD_SET(cmd_buck_active_discharge_set, buck_active_discharge_param)
+SHELL_PARAM_CMD_GET(cmd_buck_active_discharge_get, buck_active_discharge_param)
+SHELL_PARAM_CMD_SET(cmd_buck_gpio_on_off_index_set, buck_gpio_on_off_index_param)
+SHELL_PARAM_CMD_GET(cmd_buck_gpio_on_off_index_get, buck_gpio_on_off_index_param)
+SHELL_PARAM_CMD_SET(cmd_buck_gpio_on_off_polarity_set, buck_gpio_on_off_polarity_param)
+SHELL_PARAM_CMD_GET(cmd_buck_gpio_on_off_polarity_get, buck_gpio_on_off_polarity_param)
+SHELL_PARAM_CMD_SET(cmd_buck_gpio_pwm_force_index_set, buck_gpio_pwm_force_index_param)
+SHELL_PARAM_CMD_GET(cmd_buck_gpio_pwm_force_index_get, buck_gpio_pwm_force_index_param)
+SHELL_PARAM_CMD_SET(cmd_buck_gpio_pwm_force_polarity_set, buck_gpio_pwm_force_polarity_param)
+SHELL_PARAM_CMD_GET(cmd_buck_gpio_pwm_force_polarity_get, buck_gpio_pwm_force_polarity_param)
+SHELL_PARAM_CMD_SET(cmd_buck_gpio_retention_index_set, buck_gpio_retention_index_param)
+SHELL_PARAM_CMD_GET(cmd_buck_gpio_retention_index_get, buck_gpio_retention_index_param)
+SHELL_PARAM_CMD_SET(cmd_buck_gpio_retention_polarity_set, buck_gpio_retention_polarity_param)
+SHELL_PARAM_CMD_GET(cmd_buck_gpio_retention_polarity_get, buck_gpio_retention_polarity_param)
+SHELL_PARAM_CMD_SET(cmd_buck_mode_set, buck_mode_param)
+SHELL_PARAM_CMD_SET(cmd_buck_status_set, buck_status_param)
+SHELL_PARAM_CMD_GET(cmd_buck_status_get, buck_status_param)
+SHELL_PARAM_CMD_SET(cmd_buck_voltage_normal_set, buck_voltage_normal_param)
+SHELL_PARAM_CMD_GET(cmd_buck_voltage_normal_get, buck_voltage_normal_param)
+SHELL_PARAM_CMD_SET(cmd_buck_voltage_retention_set, buck_voltage_retention_param)
+SHELL_PARAM_CMD_GET(cmd_buck_voltage_retention_get, buck_voltage_retention_param)
+SHELL_PARAM_CMD_SET(cmd_buck_vout_select_set, buck_vout_select_param)
+SHELL_PARAM_CMD_GET(cmd_buck_vout_select_get, buck_vout_select_param)
 
 /* Creating subcommands (level 3 command) array for command "buck active_discharge". */
 SHELL_STATIC_SUBCMD_SET_CREATE(sub_buck_active_discharge,
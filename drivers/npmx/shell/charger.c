@@ -4,11 +4,9 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
-#include "shell_common.h"
+#include "shell_table.h"
 #include <npmx_driver.h>
 
-npmx_adc_t *adc_instance_get(const struct shell *shell);
-
 npmx_charger_t *charger_instance_get(const struct shell *shell)
 {
 	npmx_instance_t *npmx_instance = npmx_instance_get(shell);
@@ -16,907 +14,363 @@ npmx_charger_t *charger_instance_get(const struct shell *shell)
 	return npmx_instance ? npmx_charger_get(npmx_instance, 0) : NULL;
 }
 
-static bool charger_charging_current_set_helper(const struct shell *shell,
-						npmx_charger_t *charger_instance, uint16_t current,
-						uint16_t *p_charging_current)
-{
-	npmx_error_t err_code = npmx_charger_charging_current_set(charger_instance, current);
-	if (!check_error_code(shell, err_code)) {
-		print_set_error(shell, "charging current");
-		return false;
-	}
-
-	err_code = npmx_charger_charging_current_get(charger_instance, p_charging_current);
-	if (!check_error_code(shell, err_code)) {
-		print_get_error(shell, "charging current");
-		return false;
-	}
-
-	value_difference_info(shell, SHELL_ARG_TYPE_UINT32_VALUE, (uint32_t)current,
-			      (uint32_t)*p_charging_current);
-
-	return true;
-}
-
-static int cmd_charger_charging_current_set(const struct shell *shell, size_t argc, char **argv)
-{
-	args_info_t args_info = { .expected_args = 1,
-				  .arg = {
-					  [0] = { SHELL_ARG_TYPE_UINT32_VALUE, "charging current" },
-				  } };
-	if (!arguments_check(shell, argc, argv, &args_info)) {
-		return 0;
-	}
-
-	npmx_charger_t *charger_instance = charger_instance_get(shell);
-	if (charger_instance == NULL) {
-		return 0;
-	}
-
-	if (!charger_disabled_check(shell, charger_instance, "charging current")) {
-		return 0;
-	}
-
-	if (!range_check(shell, args_info.arg[0].result.uvalue,
-			 NPM_BCHARGER_CHARGING_CURRENT_MIN_MA, NPM_BCHARGER_CHARGING_CURRENT_MAX_MA,
-			 "charging current")) {
-		return 0;
-	}
-
-	uint16_t charging_current_ma = (uint16_t)args_info.arg[0].result.uvalue;
-	uint16_t current_actual;
-	if (charger_charging_current_set_helper(shell, charger_instance, charging_current_ma,
-						&current_actual)) {
-		print_success(shell, current_actual, UNIT_TYPE_MILLIAMPERE);
-	}
-	return 0;
-}
-
-static int cmd_charger_charging_current_get(const struct shell *shell, size_t argc, char **argv)
-{
-	ARG_UNUSED(argc);
-	ARG_UNUSED(argv);
-
-	npmx_charger_t *charger_instance = charger_instance_get(shell);
-	if (charger_instance == NULL) {
-		return 0;
-	}
-
-	uint16_t charging_current_ma;
-	npmx_error_t err_code =
-		npmx_charger_charging_current_get(charger_instance, &charging_current_ma);
-	if (!check_error_code(shell, err_code)) {
-		print_get_error(shell, "charging current");
-		return 0;
-	}
-
-	print_value(shell, charging_current_ma, UNIT_TYPE_MILLIAMPERE);
-	return 0;
-}
-
-static bool charger_die_temp_set_helper(const struct shell *shell, npmx_charger_t *charger_instance,
-					int16_t temperature, int16_t *p_temperature,
-					npmx_error_t (*func_set)(npmx_charger_t const *p_instance,
-								 int16_t temperature),
-					npmx_error_t (*func_get)(npmx_charger_t const *p_instance,
-								 int16_t *p_temperature))
-{
-	npmx_error_t err_code = func_set(charger_instance, temperature);
-	if (!check_error_code(shell, err_code)) {
-		print_set_error(shell, "die temperature threshold");
-		return false;
-	}
-
-	err_code = func_get(charger_instance, p_temperature);
-	if (!check_error_code(shell, err_code)) {
-		print_get_error(shell, "die temperature threshold");
-		return false;
-	}
-
-	value_difference_info(shell, SHELL_ARG_TYPE_INT32_VALUE, (int32_t)temperature,
-			      (int32_t)*p_temperature);
-	return true;
-}
-
-static int charger_die_temp_set(const struct shell *shell, size_t argc, char **argv,
-				npmx_error_t (*func_set)(npmx_charger_t const *p_instance,
-							 int16_t temperature),
-				npmx_error_t (*func_get)(npmx_charger_t const *p_instance,
-							 int16_t *p_temperature))
-{
-	args_info_t args_info = { .expected_args = 1,
-				  .arg = {
-					  [0] = { SHELL_ARG_TYPE_INT32_VALUE,
-						  "die temperature threshold" },
-				  } };
-	if (!arguments_check(shell, argc, argv, &args_info)) {
-		return 0;
-	}
-
-	npmx_charger_t *charger_instance = charger_instance_get(shell);
-	if (charger_instance == NULL) {
-		return 0;
-	}
-
-	if (!charger_disabled_check(shell, charger_instance, "die temperature threshold")) {
-		return 0;
-	}
-
-	if (!range_check(shell, args_info.arg[0].result.ivalue,
-			 NPM_BCHARGER_DIE_TEMPERATURE_MIN_VAL, NPM_BCHARGER_DIE_TEMPERATURE_MAX_VAL,
-			 "die temperature threshold")) {
-		return 0;
-	}
-
-	int16_t temperature = (int16_t)args_info.arg[0].result.ivalue;
-	int16_t temperature_actual;
-	if (charger_die_temp_set_helper(shell, charger_instance, temperature, &temperature_actual,
-					func_set, func_get)) {
-		print_success(shell, temperature_actual, UNIT_TYPE_CELSIUS);
-	}
-	return 0;
-}
-
-static int charger_die_temp_get(const struct shell *shell,
-				npmx_error_t (*func)(npmx_charger_t const *p_instance,
-						     int16_t *temperature))
-{
-	npmx_charger_t *charger_instance = charger_instance_get(shell);
-	if (charger_instance == NULL) {
-		return 0;
-	}
-
-	int16_t temperature;
-	npmx_error_t err_code = func(charger_instance, &temperature);
-	if (!check_error_code(shell, err_code)) {
-		print_get_error(shell, "die temperature threshold");
-		return 0;
-	}
-
-	print_value(shell, temperature, UNIT_TYPE_CELSIUS);
-	return 0;
-}
-
-static int cmd_charger_die_temp_resume_set(const struct shell *shell, size_t argc, char **argv)
-{
-	return charger_die_temp_set(shell, argc, argv, npmx_charger_die_temp_resume_set,
-				    npmx_charger_die_temp_resume_get);
-}
-
-static int cmd_charger_die_temp_resume_get(const struct shell *shell, size_t argc, char **argv)
-{
-	ARG_UNUSED(argc);
-	ARG_UNUSED(argv);
-
-	return charger_die_temp_get(shell, npmx_charger_die_temp_resume_get);
-}
-
-static int cmd_charger_die_temp_status_get(const struct shell *shell, size_t argc, char **argv)
-{
-	ARG_UNUSED(argc);
-	ARG_UNUSED(argv);
-
-	npmx_charger_t *charger_instance = charger_instance_get(shell);
-	if (charger_instance == NULL) {
-		return 0;
-	}
-
-	bool status;
-	npmx_error_t err_code = npmx_charger_die_temp_status_get(charger_instance, &status);
-	if (!check_error_code(shell, err_code)) {
-		print_get_error(shell, "charger die temperature comparator status");
-		return 0;
-	}
-
-	print_value(shell, status, UNIT_TYPE_NONE);
-	return 0;
-}
-
-static int cmd_charger_die_temp_stop_set(const struct shell *shell, size_t argc, char **argv)
-{
-	return charger_die_temp_set(shell, argc, argv, npmx_charger_die_temp_stop_set,
-				    npmx_charger_die_temp_stop_get);
-}
-
-static int cmd_charger_die_temp_stop_get(const struct shell *shell, size_t argc, char **argv)
-{
-	ARG_UNUSED(argc);
-	ARG_UNUSED(argv);
-
-	return charger_die_temp_get(shell, npmx_charger_die_temp_stop_get);
-}
-
-static bool charger_discharging_current_set_helper(const struct shell *shell,
-						   npmx_charger_t *charger_instance,
-						   uint16_t current, uint16_t *p_current)
-{
-	npmx_error_t err_code = npmx_charger_discharging_current_set(charger_instance, current);
-	if (!check_error_code(shell, err_code)) {
-		print_set_error(shell, "discharging current");
-		return false;
-	}
-
-	err_code = npmx_charger_discharging_current_get(charger_instance, p_current);
-	if (!check_error_code(shell, err_code)) {
-		print_get_error(shell, "discharging current");
-		return false;
-	}
-
-	value_difference_info(shell, SHELL_ARG_TYPE_UINT32_VALUE, (uint32_t)current,
-			      (uint32_t)*p_current);
-
-	return true;
-}
-
-static int cmd_charger_discharging_current_set(const struct shell *shell, size_t argc, char **argv)
-{
-	args_info_t args_info = { .expected_args = 1,
-				  .arg = {
-					  [0] = { SHELL_ARG_TYPE_UINT32_VALUE,
-						  "discharging current" },
-				  } };
-	if (!arguments_check(shell, argc, argv, &args_info)) {
-		return 0;
-	}
-
-	npmx_charger_t *charger_instance = charger_instance_get(shell);
-	if (charger_instance == NULL) {
-		return 0;
-	}
-
-	if (!charger_disabled_check(shell, charger_instance, "discharging current")) {
-		return 0;
-	}
-
-	if (!range_check(shell, args_info.arg[0].result.uvalue,
-			 NPM_BCHARGER_DISCHARGING_CURRENT_MIN_MA,
-			 NPM_BCHARGER_DISCHARGING_CURRENT_MAX_MA, "discharging current")) {
-		return 0;
-	}
-
-	uint16_t discharging_current_ma = args_info.arg[0].result.uvalue;
-	uint16_t current_actual;
-	if (charger_discharging_current_set_helper(shell, charger_instance, discharging_current_ma,
-						   &current_actual)) {
-		print_success(shell, current_actual, UNIT_TYPE_MILLIAMPERE);
-	}
-	return 0;
-}
-
-static int cmd_charger_discharging_current_get(const struct shell *shell, size_t argc, char **argv)
-{
-	ARG_UNUSED(argc);
-	ARG_UNUSED(argv);
-
-	npmx_charger_t *charger_instance = charger_instance_get(shell);
-	if (charger_instance == NULL) {
-		return 0;
-	}
-
-	uint16_t charging_current_ma;
-	npmx_error_t err_code =
-		npmx_charger_discharging_current_get(charger_instance, &charging_current_ma);
-	if (!check_error_code(shell, err_code)) {
-		print_get_error(shell, "discharging current");
-		return 0;
-	}
-
-	print_value(shell, charging_current_ma, UNIT_TYPE_MILLIAMPERE);
-	return 0;
-}
-
-static int charger_module_set(const struct shell *shell, size_t argc, char **argv,
-			      npmx_charger_module_mask_t mask)
-{
-	args_info_t args_info = { .expected_args = 1,
-				  .arg = {
-					  [0] = { SHELL_ARG_TYPE_BOOL_VALUE, "status" },
-				  } };
-	if (!arguments_check(shell, argc, argv, &args_info)) {
-		return 0;
-	}
-
-	npmx_charger_t *charger_instance = charger_instance_get(shell);
-	if (charger_instance == NULL) {
-		return 0;
-	}
-
-	bool charger_set = args_info.arg[0].result.bvalue;
-
-	npmx_error_t (*change_status_function)(const npmx_charger_t *p_instance,
-					       uint32_t module_mask) =
-		charger_set ? npmx_charger_module_enable_set : npmx_charger_module_disable_set;
-
-	npmx_error_t err_code = change_status_function(charger_instance, mask);
-	if (!check_error_code(shell, err_code)) {
-		print_set_error(shell, "charging module status");
-		return 0;
-	}
-
-	print_success(shell, charger_set, UNIT_TYPE_NONE);
-	return 0;
-}
-
-static int charger_module_get(const struct shell *shell, npmx_charger_module_mask_t mask)
-{
-	npmx_charger_t *charger_instance = charger_instance_get(shell);
-	if (charger_instance == NULL) {
-		return 0;
-	}
-
-	uint32_t module_mask;
-	npmx_error_t err_code = npmx_charger_module_get(charger_instance, &module_mask);
-	if (!check_error_code(shell, err_code)) {
-		print_get_error(shell, "charging module status");
-		return 0;
-	}
-
-	print_value(shell, !!(module_mask & (uint32_t)mask), UNIT_TYPE_NONE);
-	return 0;
-}
-
-static int cmd_charger_module_charger_set(const struct shell *shell, size_t argc, char **argv)
-{
-	return charger_module_set(shell, argc, argv, NPMX_CHARGER_MODULE_CHARGER_MASK);
-}
-
-static int cmd_charger_module_charger_get(const struct shell *shell, size_t argc, char **argv)
-{
-	ARG_UNUSED(argc);
-	ARG_UNUSED(argv);
-
-	return charger_module_get(shell, NPMX_CHARGER_MODULE_CHARGER_MASK);
-}
-
-static int cmd_charger_module_full_cool_set(const struct shell *shell, size_t argc, char **argv)
-{
-	return charger_module_set(shell, argc, argv, NPMX_CHARGER_MODULE_FULL_COOL_MASK);
-}
-
-static int cmd_charger_module_full_cool_get(const struct shell *shell, size_t argc, char **argv)
-{
-	ARG_UNUSED(argc);
-	ARG_UNUSED(argv);
-
-	return charger_module_get(shell, NPMX_CHARGER_MODULE_FULL_COOL_MASK);
-}
-
-static int cmd_charger_module_ntc_limits_set(const struct shell *shell, size_t argc, char **argv)
-{
-	return charger_module_set(shell, argc, argv, NPMX_CHARGER_MODULE_NTC_LIMITS_MASK);
-}
-
-static int cmd_charger_module_ntc_limits_get(const struct shell *shell, size_t argc, char **argv)
-{
-	ARG_UNUSED(argc);
-	ARG_UNUSED(argv);
-
-	return charger_module_get(shell, NPMX_CHARGER_MODULE_NTC_LIMITS_MASK);
-}
-
-static int cmd_charger_module_recharge_set(const struct shell *shell, size_t argc, char **argv)
-{
-	return charger_module_set(shell, argc, argv, NPMX_CHARGER_MODULE_RECHARGE_MASK);
-}
-
-static int cmd_charger_module_recharge_get(const struct shell *shell, size_t argc, char **argv)
-{
-	ARG_UNUSED(argc);
-	ARG_UNUSED(argv);
-
-	return charger_module_get(shell, NPMX_CHARGER_MODULE_RECHARGE_MASK);
-}
-
-static bool charger_ntc_resistance_set_helper(
-	const struct shell *shell, npmx_charger_t const *p_instance, uint32_t resistance,
-	uint32_t *p_resistance,
-	npmx_error_t (*func_set)(npmx_charger_t const *p_instance, uint32_t resistance),
-	npmx_error_t (*func_get)(npmx_charger_t const *p_instance, uint32_t *p_resistance))
-{
-	npmx_error_t err_code = func_set(p_instance, resistance);
-	if (!check_error_code(shell, err_code)) {
-		print_set_error(shell, "NTC resistance");
-		return false;
-	}
-
-	err_code = func_get(p_instance, p_resistance);
-	if (!check_error_code(shell, err_code)) {
-		print_get_error(shell, "NTC resistance");
-		return false;
-	}
-
-	value_difference_info(shell, SHELL_ARG_TYPE_UINT32_VALUE, resistance, *p_resistance);
-
-	return true;
-}
-
-static int charger_ntc_resistance_set(const struct shell *shell, size_t argc, char **argv,
-				      npmx_error_t (*func_set)(npmx_charger_t const *p_instance,
-							       uint32_t resistance),
-				      npmx_error_t (*func_get)(npmx_charger_t const *p_instance,
-							       uint32_t *p_resistance))
-{
-	args_info_t args_info = { .expected_args = 1,
-				  .arg = {
-					  [0] = { SHELL_ARG_TYPE_UINT32_VALUE, "NTC resistance" },
-				  } };
-	if (!arguments_check(shell, argc, argv, &args_info)) {
-		return 0;
-	}
-
-	npmx_charger_t *charger_instance = charger_instance_get(shell);
-	if (charger_instance == NULL) {
-		return 0;
-	}
-
-	if (!charger_disabled_check(shell, charger_instance, "NTC resistance")) {
-		return 0;
-	}
-
-	uint32_t resistance = args_info.arg[0].result.uvalue;
-	uint32_t resistance_actual;
-	if (charger_ntc_resistance_set_helper(shell, charger_instance, resistance,
-					      &resistance_actual, func_set, func_get)) {
-		print_success(shell, resistance_actual, UNIT_TYPE_OHM);
-	}
-	return 0;
-}
-
-static int charger_ntc_resistance_get(const struct shell *shell,
-				      npmx_error_t (*func)(npmx_charger_t const *p_instance,
-							   uint32_t *p_resistance))
-{
-	npmx_charger_t *charger_instance = charger_instance_get(shell);
-	if (charger_instance == NULL) {
-		return 0;
-	}
-
-	uint32_t resistance;
-	npmx_error_t err_code = func(charger_instance, &resistance);
-	if (!check_error_code(shell, err_code)) {
-		print_get_error(shell, "NTC resistance");
-		return 0;
-	}
-
-	print_value(shell, resistance, UNIT_TYPE_OHM);
-	return 0;
-}
-
-static int cmd_charger_ntc_resistance_cold_set(const struct shell *shell, size_t argc, char **argv)
-{
-	return charger_ntc_resistance_set(shell, argc, argv, npmx_charger_cold_resistance_set,
-					  npmx_charger_cold_resistance_get);
-}
-
-static int cmd_charger_ntc_resistance_cold_get(const struct shell *shell, size_t argc, char **argv)
-{
-	ARG_UNUSED(argc);
-	ARG_UNUSED(argv);
-
-	return charger_ntc_resistance_get(shell, npmx_charger_cold_resistance_get);
-}
-
-static int cmd_charger_ntc_resistance_cool_set(const struct shell *shell, size_t argc, char **argv)
-{
-	return charger_ntc_resistance_set(shell, argc, argv, npmx_charger_cool_resistance_set,
-					  npmx_charger_cool_resistance_get);
-}
-
-static int cmd_charger_ntc_resistance_cool_get(const struct shell *shell, size_t argc, char **argv)
-{
-	ARG_UNUSED(argc);
-	ARG_UNUSED(argv);
-
-	return charger_ntc_resistance_get(shell, npmx_charger_cool_resistance_get);
-}
-
-static int cmd_charger_ntc_resistance_warm_set(const struct shell *shell, size_t argc, char **argv)
-{
-	return charger_ntc_resistance_set(shell, argc, argv, npmx_charger_warm_resistance_set,
-					  npmx_charger_warm_resistance_get);
-}
-
-static int cmd_charger_ntc_resistance_warm_get(const struct shell *shell, size_t argc, char **argv)
-{
-	ARG_UNUSED(argc);
-	ARG_UNUSED(argv);
-
-	return charger_ntc_resistance_get(shell, npmx_charger_warm_resistance_get);
-}
-
-static int cmd_charger_ntc_resistance_hot_set(const struct shell *shell, size_t argc, char **argv)
-{
-	return charger_ntc_resistance_set(shell, argc, argv, npmx_charger_hot_resistance_set,
-					  npmx_charger_hot_resistance_get);
-}
-
-static int cmd_charger_ntc_resistance_hot_get(const struct shell *shell, size_t argc, char **argv)
-{
-	ARG_UNUSED(argc);
-	ARG_UNUSED(argv);
-
-	return charger_ntc_resistance_get(shell, npmx_charger_hot_resistance_get);
-}
-
-static int charger_ntc_temperature_set(const struct shell *shell, size_t argc, char **argv,
-				       npmx_error_t (*func)(npmx_charger_t const *p_instance,
-							    int16_t temperature))
-{
-	args_info_t args_info = { .expected_args = 1,
-				  .arg = {
-					  [0] = { SHELL_ARG_TYPE_INT32_VALUE, "NTC temperature" },
-				  } };
-	if (!arguments_check(shell, argc, argv, &args_info)) {
-		return 0;
-	}
-
-	npmx_charger_t *charger_instance = charger_instance_get(shell);
-	if (charger_instance == NULL) {
-		return 0;
-	}
-
-	if (!charger_disabled_check(shell, charger_instance, "NTC temperature")) {
-		return 0;
-	}
-
-	int32_t temperature = args_info.arg[0].result.ivalue;
-	if (!range_check(shell, temperature, -20, 60, "NTC temperature")) {
-		return 0;
-	}
-
-	npmx_error_t err_code = func(charger_instance, temperature);
-	if (!check_error_code(shell, err_code)) {
-		print_set_error(shell, "NTC temperature");
-		return 0;
-	}
-
-	print_success(shell, temperature, UNIT_TYPE_CELSIUS);
-	return 0;
-}
-
-static int charger_ntc_temperature_get(const struct shell *shell,
-				       npmx_error_t (*func)(npmx_charger_t const *p_instance,
-							    int16_t *p_temperature))
-{
-	npmx_charger_t *charger_instance = charger_instance_get(shell);
-	if (charger_instance == NULL) {
-		return 0;
-	}
-
-	int16_t temperature;
-	npmx_error_t err_code = func(charger_instance, &temperature);
-	if (!check_error_code(shell, err_code)) {
-		print_set_error(shell, "NTC temperature");
-		return 0;
-	}
-
-	print_value(shell, temperature, UNIT_TYPE_CELSIUS);
-	return 0;
-}
-
-static int cmd_charger_ntc_temperature_cold_set(const struct shell *shell, size_t argc, char **argv)
-{
-	return charger_ntc_temperature_set(shell, argc, argv, npmx_charger_cold_temperature_set);
-}
-
-static int cmd_charger_ntc_temperature_cold_get(const struct shell *shell, size_t argc, char **argv)
-{
-	ARG_UNUSED(argc);
-	ARG_UNUSED(argv);
-
-	return charger_ntc_temperature_get(shell, npmx_charger_cold_temperature_get);
-}
-
-static int cmd_charger_ntc_temperature_cool_set(const struct shell *shell, size_t argc, char **argv)
-{
-	return charger_ntc_temperature_set(shell, argc, argv, npmx_charger_cool_temperature_set);
-}
-
-static int cmd_charger_ntc_temperature_cool_get(const struct shell *shell, size_t argc, char **argv)
-{
-	ARG_UNUSED(argc);
-	ARG_UNUSED(argv);
-
-	return charger_ntc_temperature_get(shell, npmx_charger_cool_temperature_get);
-}
-
-static int cmd_charger_ntc_temperature_warm_set(const struct shell *shell, size_t argc, char **argv)
-{
-	return charger_ntc_temperature_set(shell, argc, argv, npmx_charger_warm_temperature_set);
-}
-
-static int cmd_charger_ntc_temperature_warm_get(const struct shell *shell, size_t argc, char **argv)
-{
-	ARG_UNUSED(argc);
-	ARG_UNUSED(argv);
-
-	return charger_ntc_temperature_get(shell, npmx_charger_warm_temperature_get);
-}
-
-static int cmd_charger_ntc_temperature_hot_set(const struct shell *shell, size_t argc, char **argv)
-{
-	return charger_ntc_temperature_set(shell, argc, argv, npmx_charger_hot_temperature_set);
-}
-
-static int cmd_charger_ntc_temperature_hot_get(const struct shell *shell, size_t argc, char **argv)
-{
-	ARG_UNUSED(argc);
-	ARG_UNUSED(argv);
-
-	return charger_ntc_temperature_get(shell, npmx_charger_hot_temperature_get);
-}
-
-static int cmd_charger_status_all_get(const struct shell *shell, size_t argc, char **argv)
+SHELL_PARAM_INSTANCE_GETTER(charger_param_instance_get, npmx_charger_get)
+SHELL_PARAM_SETTER(charger_charging_current_set, npmx_charger_t, uint16_t,
+		   npmx_charger_charging_current_set)
+SHELL_PARAM_GETTER(charger_charging_current_get, npmx_charger_t, uint16_t,
+		   npmx_charger_charging_current_get)
+SHELL_PARAM_SETTER(charger_die_temp_resume_set, npmx_charger_t, int16_t,
+		   npmx_charger_die_temp_resume_set)
+SHELL_PARAM_GETTER(charger_die_temp_resume_get, npmx_charger_t, int16_t,
+		   npmx_charger_die_temp_resume_get)
+SHELL_PARAM_GETTER(charger_die_temp_status_get, npmx_charger_t, bool,
+		   npmx_charger_die_temp_status_get)
+SHELL_PARAM_SETTER(charger_die_temp_stop_set, npmx_charger_t, int16_t,
+		   npmx_charger_die_temp_stop_set)
+SHELL_PARAM_GETTER(charger_die_temp_stop_get, npmx_charger_t, int16_t,
+		   npmx_charger_die_temp_stop_get)
+SHELL_PARAM_SETTER(charger_discharging_current_set, npmx_charger_t, uint16_t,
+		   npmx_charger_discharging_current_set)
+SHELL_PARAM_GETTER(charger_discharging_current_get, npmx_charger_t, uint16_t,
+		   npmx_charger_discharging_current_get)
+SHELL_PARAM_SETTER(charger_cold_resistance_set, npmx_charger_t, uint32_t,
+		   npmx_charger_cold_resistance_set)
+SHELL_PARAM_GETTER(charger_cold_resistance_get, npmx_charger_t, uint32_t,
+		   npmx_charger_cold_resistance_get)
+SHELL_PARAM_SETTER(charger_cool_resistance_set, npmx_charger_t, uint32_t,
+		   npmx_charger_cool_resistance_set)
+SHELL_PARAM_GETTER(charger_cool_resistance_get, npmx_charger_t, uint32_t,
+		   npmx_charger_cool_resistance_get)
+SHELL_PARAM_SETTER(charger_warm_resistance_set, npmx_charger_t, uint32_t,
+		   npmx_charger_warm_resistance_set)
+SHELL_PARAM_GETTER(charger_warm_resistance_get, npmx_charger_t, uint32_t,
+		   npmx_charger_warm_resistance_get)
+SHELL_PARAM_SETTER(charger_hot_resistance_set, npmx_charger_t, uint32_t,
+		   npmx_charger_hot_resistance_set)
+SHELL_PARAM_GETTER(charger_hot_resistance_get, npmx_charger_t, uint32_t,
+		   npmx_charger_hot_resistance_get)
+SHELL_PARAM_SETTER(charger_cold_temperature_set, npmx_charger_t, int16_t,
+		   npmx_charger_cold_temperature_set)
+SHELL_PARAM_GETTER(charger_cold_temperature_get, npmx_charger_t, int16_t,
+		   npmx_charger_cold_temperature_get)
+SHELL_PARAM_SETTER(charger_cool_temperature_set, npmx_charger_t, int16_t,
+		   npmx_charger_cool_temperature_set)
+SHELL_PARAM_GETTER(charger_cool_temperature_get, npmx_charger_t, int16_t,
+		   npmx_charger_cool_temperature_get)
+SHELL_PARAM_SETTER(charger_warm_temperature_set, npmx_charger_t, int16_t,
+		   npmx_charger_warm_temperature_set)
+SHELL_PARAM_GETTER(charger_warm_temperature_get, npmx_charger_t, int16_t,
+		   npmx_charger_warm_temperature_get)
+SHELL_PARAM_SETTER(charger_hot_temperature_set, npmx_charger_t, int16_t,
+		   npmx_charger_hot_temperature_set)
+SHELL_PARAM_GETTER(charger_hot_temperature_get, npmx_charger_t, int16_t,
+		   npmx_charger_hot_temperature_get)
+SHELL_PARAM_GETTER(charger_status_all_get, npmx_charger_t, uint8_t, npmx_charger_status_get)
+SHELL_PARAM_SETTER(charger_termination_current_set, npmx_charger_t, npmx_charger_iterm_t,
+		   npmx_charger_termination_current_set)
+SHELL_PARAM_GETTER(charger_termination_current_get, npmx_charger_t, npmx_charger_iterm_t,
+		   npmx_charger_termination_current_get)
+SHELL_PARAM_SETTER(charger_termination_voltage_normal_set, npmx_charger_t,
+		   npmx_charger_voltage_t, npmx_charger_termination_normal_voltage_set)
+SHELL_PARAM_GETTER(charger_termination_voltage_normal_get, npmx_charger_t,
+		   npmx_charger_voltage_t, npmx_charger_termination_normal_voltage_get)
+SHELL_PARAM_SETTER(charger_termination_voltage_warm_set, npmx_charger_t, npmx_charger_voltage_t,
+		   npmx_charger_termination_warm_voltage_set)
+SHELL_PARAM_GETTER(charger_termination_voltage_warm_get, npmx_charger_t, npmx_charger_voltage_t,
+		   npmx_charger_termination_warm_voltage_get)
+SHELL_PARAM_SETTER(charger_trickle_voltage_set, npmx_charger_t, npmx_charger_trickle_t,
+		   npmx_charger_trickle_voltage_set)
+SHELL_PARAM_GETTER(charger_trickle_voltage_get, npmx_charger_t, npmx_charger_trickle_t,
+		   npmx_charger_trickle_voltage_get)
+SHELL_PARAM_TO_NPMX(charger_iterm_to_npmx, npmx_charger_iterm_t, npmx_charger_iterm_convert,
+		    NPMX_CHARGER_ITERM_INVALID)
+SHELL_PARAM_FROM_NPMX(charger_iterm_from_npmx, npmx_charger_iterm_t,
+		      npmx_charger_iterm_convert_to_pct)
+SHELL_PARAM_TO_NPMX(charger_voltage_to_npmx, npmx_charger_voltage_t, npmx_charger_voltage_convert,
+		    NPMX_CHARGER_VOLTAGE_INVALID)
+SHELL_PARAM_FROM_NPMX(charger_voltage_from_npmx, npmx_charger_voltage_t,
+		      npmx_charger_voltage_convert_to_mv)
+SHELL_PARAM_TO_NPMX(charger_trickle_to_npmx, npmx_charger_trickle_t, npmx_charger_trickle_convert,
+		    NPMX_CHARGER_TRICKLE_INVALID)
+SHELL_PARAM_FROM_NPMX(charger_trickle_from_npmx, npmx_charger_trickle_t,
+		      npmx_charger_trickle_convert_to_mv)
+
+/**
+ * @brief Macro for defining the setter and getter of a charger module status.
+ *
+ * @param _name Module name used in the function names.
+ * @param _mask Module mask.
+ */
+#define CHARGER_MODULE_ACCESSORS(_name, _mask)                                                     \
+	static npmx_error_t charger_module_##_name##_set(void const *p_instance, int32_t value)    \
+	{                                                                                          \
+		return value ? npmx_charger_module_enable_set(p_instance, (_mask)) :               \
+			       npmx_charger_module_disable_set(p_instance, (_mask));               \
+	}                                                                                          \
+                                                                                                   \
+	static npmx_error_t charger_module_##_name##_get(void const *p_instance, int32_t *p_value) \
+	{                                                                                          \
+		uint32_t module_mask;                                                              \
+		npmx_error_t err_code = npmx_charger_module_get(p_instance, &module_mask);         \
+		*p_value = ((module_mask & (uint32_t)(_mask)) != 0) ? 1 : 0;                       \
+		return err_code;                                                                   \
+	}
+
+CHARGER_MODULE_ACCESSORS(charger, NPMX_CHARGER_MODULE_CHARGER_MASK)
+CHARGER_MODULE_ACCESSORS(full_cool, NPMX_CHARGER_MODULE_FULL_COOL_MASK)
+CHARGER_MODULE_ACCESSORS(ntc_limits, NPMX_CHARGER_MODULE_NTC_LIMITS_MASK)
+CHARGER_MODULE_ACCESSORS(recharge, NPMX_CHARGER_MODULE_RECHARGE_MASK)
+
+static npmx_error_t charger_status_charging_get(void const *p_instance, int32_t *p_value)
 {
-	ARG_UNUSED(argc);
-	ARG_UNUSED(argv);
-
-	npmx_charger_t *charger_instance = charger_instance_get(shell);
-	if (charger_instance == NULL) {
-		return 0;
-	}
-
-	uint8_t status_mask;
-	npmx_error_t err_code = npmx_charger_status_get(charger_instance, &status_mask);
-	if (!check_error_code(shell, err_code)) {
-		print_get_error(shell, "charger status");
-		return 0;
-	}
-
-	print_value(shell, status_mask, UNIT_TYPE_NONE);
-	return 0;
-}
-
-static int cmd_charger_status_charging_get(const struct shell *shell, size_t argc, char **argv)
-{
-	ARG_UNUSED(argc);
-	ARG_UNUSED(argv);
-
-	npmx_charger_t *charger_instance = charger_instance_get(shell);
-	if (charger_instance == NULL) {
-		return 0;
-	}
-
 	uint8_t status_mask;
 	uint8_t charging_mask = NPMX_CHARGER_STATUS_TRICKLE_CHARGE_MASK |
 				NPMX_CHARGER_STATUS_CONSTANT_CURRENT_MASK |
 				NPMX_CHARGER_STATUS_CONSTANT_VOLTAGE_MASK;
-	npmx_error_t err_code = npmx_charger_status_get(charger_instance, &status_mask);
-	if (!check_error_code(shell, err_code)) {
-		print_get_error(shell, "charger status");
-		return 0;
-	}
-
-	print_value(shell, !!(status_mask & charging_mask), UNIT_TYPE_NONE);
-	return 0;
-}
-
-static int cmd_charger_termination_current_set(const struct shell *shell, size_t argc, char **argv)
-{
-	args_info_t args_info = { .expected_args = 1,
-				  .arg = {
-					  [0] = { SHELL_ARG_TYPE_UINT32_VALUE,
-						  "termination current" },
-				  } };
-	if (!arguments_check(shell, argc, argv, &args_info)) {
-		return 0;
-	}
-
-	npmx_charger_t *charger_instance = charger_instance_get(shell);
-	if (charger_instance == NULL) {
-		return 0;
-	}
-
-	if (!charger_disabled_check(shell, charger_instance, "termination current")) {
-		return 0;
-	}
-
-	uint32_t current_pct = args_info.arg[0].result.uvalue;
-	npmx_charger_iterm_t charger_iterm = npmx_charger_iterm_convert(current_pct);
-	if (charger_iterm == NPMX_CHARGER_ITERM_INVALID) {
-		print_convert_error(shell, "pct", "termination current");
-		return 0;
-	}
-
-	npmx_error_t err_code =
-		npmx_charger_termination_current_set(charger_instance, charger_iterm);
-	if (!check_error_code(shell, err_code)) {
-		print_set_error(shell, "termination current");
-		return 0;
-	}
-
-	print_success(shell, current_pct, UNIT_TYPE_PCT);
-	return 0;
-}
-
-static int cmd_charger_termination_current_get(const struct shell *shell, size_t argc, char **argv)
-{
-	ARG_UNUSED(argc);
-	ARG_UNUSED(argv);
-
-	npmx_charger_t *charger_instance = charger_instance_get(shell);
-	if (charger_instance == NULL) {
-		return 0;
-	}
-
-	npmx_charger_iterm_t charger_iterm;
-	npmx_error_t err_code =
-		npmx_charger_termination_current_get(charger_instance, &charger_iterm);
-	if (!check_error_code(shell, err_code)) {
-		print_get_error(shell, "termination current");
-		return 0;
-	}
+	npmx_error_t err_code = npmx_charger_status_get(p_instance, &status_mask);
 
-	uint32_t current_pct;
-	if (!npmx_charger_iterm_convert_to_pct(charger_iterm, &current_pct)) {
-		print_convert_error(shell, "termination current", "pct");
-		return 0;
-	}
-
-	print_value(shell, current_pct, UNIT_TYPE_PCT);
-	return 0;
+	*p_value = ((status_mask & charging_mask) != 0) ? 1 : 0;
+	return err_code;
 }
 
-static int charger_termination_voltage_set(const struct shell *shell, size_t argc, char **argv,
-					   npmx_error_t (*func)(npmx_charger_t const *p_instance,
-								npmx_charger_voltage_t voltage))
+/* Charging parameters can only be changed with the charger disabled. */
+static bool charger_param_check(const struct shell *shell, shell_param_t const *p_param,
+				void const *p_instance, uint32_t index, int32_t value)
 {
-	args_info_t args_info = { .expected_args = 1,
-				  .arg = {
-					  [0] = { SHELL_ARG_TYPE_UINT32_VALUE,
-						  "termination voltage" },
-				  } };
-	if (!arguments_check(shell, argc, argv, &args_info)) {
-		return 0;
-	}
-
-	uint32_t voltage_mv = args_info.arg[0].result.uvalue;
-	npmx_charger_voltage_t charger_voltage = npmx_charger_voltage_convert(voltage_mv);
-	if (charger_voltage == NPMX_CHARGER_VOLTAGE_INVALID) {
-		print_convert_error(shell, "millivolts", "termination voltage");
-		return 0;
-	}
-
-	npmx_charger_t *charger_instance = charger_instance_get(shell);
-	if (charger_instance == NULL) {
-		return 0;
-	}
-
-	if (!charger_disabled_check(shell, charger_instance, "termination voltage")) {
-		return 0;
-	}
-
-	npmx_error_t err_code = func(charger_instance, charger_voltage);
-	if (!check_error_code(shell, err_code)) {
-		print_set_error(shell, "termination voltage");
-		return 0;
-	}
+	ARG_UNUSED(index);
+	ARG_UNUSED(value);
 
-	print_success(shell, voltage_mv, UNIT_TYPE_MILLIVOLT);
-	return 0;
+	return charger_disabled_check(shell, p_instance, p_param->description);
 }
 
-static int charger_termination_voltage_get(const struct shell *shell,
-					   npmx_error_t (*func)(npmx_charger_t const *p_instance,
-								npmx_charger_voltage_t *voltage))
-{
-	npmx_charger_t *charger_instance = charger_instance_get(shell);
-	if (charger_instance == NULL) {
-		return 0;
-	}
-
-	npmx_charger_voltage_t charger_voltage;
-	npmx_error_t err_code = func(charger_instance, &charger_voltage);
-	if (!check_error_code(shell, err_code)) {
-		print_get_error(shell, "termination voltage");
-		return 0;
-	}
-
-	uint32_t voltage_mv;
-	if (!npmx_charger_voltage_convert_to_mv(charger_voltage, &voltage_mv)) {
-		print_convert_error(shell, "termination voltage", "millivolts");
-		return 0;
-	}
-
-	print_value(shell, voltage_mv, UNIT_TYPE_MILLIVOLT);
-	return 0;
-}
-
-static int cmd_charger_termination_voltage_normal_set(const struct shell *shell, size_t argc,
-						      char **argv)
-{
-	return charger_termination_voltage_set(shell, argc, argv,
-					       npmx_charger_termination_normal_voltage_set);
-}
-
-static int cmd_charger_termination_voltage_normal_get(const struct shell *shell, size_t argc,
-						      char **argv)
-{
-	ARG_UNUSED(argc);
-	ARG_UNUSED(argv);
-
-	return charger_termination_voltage_get(shell, npmx_charger_termination_normal_voltage_get);
-}
-
-static int cmd_charger_termination_voltage_warm_set(const struct shell *shell, size_t argc,
-						    char **argv)
-{
-	return charger_termination_voltage_set(shell, argc, argv,
-					       npmx_charger_termination_warm_voltage_set);
-}
-
-static int cmd_charger_termination_voltage_warm_get(const struct shell *shell, size_t argc,
-						    char **argv)
-{
-	ARG_UNUSED(argc);
-	ARG_UNUSED(argv);
-
-	return charger_termination_voltage_get(shell, npmx_charger_termination_warm_voltage_get);
-}
-
-static int cmd_charger_trickle_voltage_set(const struct shell *shell, size_t argc, char **argv)
-{
-	args_info_t args_info = { .expected_args = 1,
-				  .arg = {
-					  [0] = { SHELL_ARG_TYPE_UINT32_VALUE, "trickle voltage" },
-				  } };
-	if (!arguments_check(shell, argc, argv, &args_info)) {
-		return 0;
-	}
-
-	npmx_charger_t *charger_instance = charger_instance_get(shell);
-	if (charger_instance == NULL) {
-		return 0;
-	}
-
-	if (!charger_disabled_check(shell, charger_instance, "trickle voltage")) {
-		return 0;
-	}
-
-	uint32_t voltage_mv = args_info.arg[0].result.uvalue;
-	npmx_charger_trickle_t charger_trickle = npmx_charger_trickle_convert(voltage_mv);
-	if (charger_trickle == NPMX_CHARGER_TRICKLE_INVALID) {
-		print_convert_error(shell, "millivolts", "trickle voltage");
-		return 0;
-	}
-
-	npmx_error_t err_code = npmx_charger_trickle_voltage_set(charger_instance, charger_trickle);
-	if (!check_error_code(shell, err_code)) {
-		print_set_error(shell, "trickle voltage");
-		return 0;
-	}
-
-	print_success(shell, voltage_mv, UNIT_TYPE_MILLIVOLT);
-	return 0;
-}
-
-static int cmd_charger_trickle_voltage_get(const struct shell *shell, size_t argc, char **argv)
-{
-	ARG_UNUSED(argc);
-	ARG_UNUSED(argv);
-
-	npmx_charger_t *charger_instance = charger_instance_get(shell);
-	if (charger_instance == NULL) {
-		return 0;
-	}
-
-	npmx_charger_trickle_t charger_trickle;
-	npmx_error_t err_code =
-		npmx_charger_trickle_voltage_get(charger_instance, &charger_trickle);
-	if (!check_error_code(shell, err_code)) {
-		print_get_error(shell, "trickle voltage");
-		return 0;
+/**
+ * @brief Macro for initializing the descriptor of a die temperature threshold.
+ *
+ * @param _name Threshold name used in the setter and getter names.
+ */
+#define CHARGER_DIE_TEMP_PARAM(_name)                                                              \
+	{                                                                                          \
+		SHELL_PARAM_INSTANCE("charger", 0, charger_param_instance_get),                    \
+		.name = "die temperature threshold",                                               \
+		.description = "die temperature threshold", .type = SHELL_ARG_TYPE_INT32_VALUE,    \
+		.min = NPM_BCHARGER_DIE_TEMPERATURE_MIN_VAL,                                       \
+		.max = NPM_BCHARGER_DIE_TEMPERATURE_MAX_VAL, .check = charger_param_check,         \
+		.readback = true, .unit = UNIT_TYPE_CELSIUS,                                       \
+		.set = charger_die_temp_##_name##_set, .get = charger_die_temp_##_name##_get,      \
+	}
+
+/**
+ * @brief Macro for initializing the descriptor of a charger module status.
+ *
+ * @param _name Module name used in @ref CHARGER_MODULE_ACCESSORS.
+ */
+#define CHARGER_MODULE_PARAM(_name)                                                                \
+	{                                                                                          \
+		SHELL_PARAM_INSTANCE("charger", 0, charger_param_instance_get), .name = "status",  \
+		.description = "charging module status", .type = SHELL_ARG_TYPE_BOOL_VALUE,        \
+		.unit = UNIT_TYPE_NONE, .set = charger_module_##_name##_set,                       \
+		.get = charger_module_##_name##_get,                                               \
 	}
 
-	uint32_t voltage_mv;
-	if (!npmx_charger_trickle_convert_to_mv(charger_trickle, &voltage_mv)) {
-		print_convert_error(shell, "trickle voltage", "millivolts");
-		return 0;
+/**
+ * @brief Macro for initializing the descriptor of an NTC resistance threshold.
+ *
+ * @param _temp Temperature range name used in the setter and getter names.
+ */
+#define CHARGER_NTC_RESISTANCE_PARAM(_temp)                                                        \
+	{                                                                                          \
+		SHELL_PARAM_INSTANCE("charger", 0, charger_param_instance_get),                    \
+		.name = "NTC resistance", .description = "NTC resistance",                         \
+		.type = SHELL_ARG_TYPE_UINT32_VALUE, .check = charger_param_check,                 \
+		.readback = true, .unit = UNIT_TYPE_OHM, .set = charger_##_temp##_resistance_set,  \
+		.get = charger_##_temp##_resistance_get,                                           \
 	}
 
-	print_value(shell, voltage_mv, UNIT_TYPE_MILLIVOLT);
-	return 0;
-}
+/**
+ * @brief Macro for initializing the descriptor of an NTC temperature threshold.
+ *
+ * @param _temp Temperature range name used in the setter and getter names.
+ */
+#define CHARGER_NTC_TEMPERATURE_PARAM(_temp)                                                       \
+	{                                                                                          \
+		SHELL_PARAM_INSTANCE("charger", 0, charger_param_instance_get),                    \
+		.name = "NTC temperature", .description = "NTC temperature",                       \
+		.type = SHELL_ARG_TYPE_INT32_VALUE, .min = -20, .max = 60,                         \
+		.check = charger_param_check, .unit = UNIT_TYPE_CELSIUS,                           \
+		.set = charger_##_temp##_temperature_set,                                          \
+		.get = charger_##_temp##_temperature_get,                                          \
+	}
+
+/**
+ * @brief Macro for initializing the descriptor of a termination voltage.
+ *
+ * @param _name Voltage name used in the setter and getter names.
+ */
+#define CHARGER_TERMINATION_VOLTAGE_PARAM(_name)                                                   \
+	{                                                                                          \
+		SHELL_PARAM_INSTANCE("charger", 0, charger_param_instance_get),                    \
+		.name = "termination voltage", .description = "termination voltage",               \
+		.type = SHELL_ARG_TYPE_UINT32_VALUE, .to_npmx = charger_voltage_to_npmx,           \
+		.from_npmx = charger_voltage_from_npmx, .check = charger_param_check,              \
+		.unit = UNIT_TYPE_MILLIVOLT, .set = charger_termination_voltage_##_name##_set,     \
+		.get = charger_termination_voltage_##_name##_get,                                  \
+	}
+
+static const shell_param_t charger_charging_current_param = {
+	SHELL_PARAM_INSTANCE("charger", 0, charger_param_instance_get),
+	.name = "charging current",
+	.description = "charging current",
+	.type = SHELL_ARG_TYPE_UINT32_VALUE,
+	.min = NPM_BCHARGER_CHARGING_CURRENT_MIN_MA,
+	.max = NPM_BCHARGER_CHARGING_CURRENT_MAX_MA,
+	.check = charger_param_check,
+	.readback = true,
+	.unit = UNIT_TYPE_MILLIAMPERE,
+	.set = charger_charging_current_set,
+	.get = charger_charging_current_get,
+};
+
+static const shell_param_t charger_die_temp_resume_param = CHARGER_DIE_TEMP_PARAM(resume);
+
+static const shell_param_t charger_die_temp_status_param = {
+	SHELL_PARAM_INSTANCE("charger", 0, charger_param_instance_get),
+	.name = "status",
+	.description = "charger die temperature comparator status",
+	.type = SHELL_ARG_TYPE_BOOL_VALUE,
+	.unit = UNIT_TYPE_NONE,
+	.get = charger_die_temp_status_get,
+};
+
+static const shell_param_t charger_die_temp_stop_param = CHARGER_DIE_TEMP_PARAM(stop);
+
+static const shell_param_t charger_discharging_current_param = {
+	SHELL_PARAM_INSTANCE("charger", 0, charger_param_instance_get),
+	.name = "discharging current",
+	.description = "discharging current",
+	.type = SHELL_ARG_TYPE_UINT32_VALUE,
+	.min = NPM_BCHARGER_DISCHARGING_CURRENT_MIN_MA,
+	.max = NPM_BCHARGER_DISCHARGING_CURRENT_MAX_MA,
+	.check = charger_param_check,
+	.readback = true,
+	.unit = UNIT_TYPE_MILLIAMPERE,
+	.set = charger_discharging_current_set,
+	.get = charger_discharging_current_get,
+};
+
+static const shell_param_t charger_module_charger_param = CHARGER_MODULE_PARAM(charger);
+static const shell_param_t charger_module_full_cool_param = CHARGER_MODULE_PARAM(full_cool);
+static const shell_param_t charger_module_ntc_limits_param = CHARGER_MODULE_PARAM(ntc_limits);
+static const shell_param_t charger_module_recharge_param = CHARGER_MODULE_PARAM(recharge);
+
+static const shell_param_t charger_ntc_resistance_cold_param = CHARGER_NTC_RESISTANCE_PARAM(cold);
+static const shell_param_t charger_ntc_resistance_cool_param = CHARGER_NTC_RESISTANCE_PARAM(cool);
+static const shell_param_t charger_ntc_resistance_warm_param = CHARGER_NTC_RESISTANCE_PARAM(warm);
+static const shell_param_t charger_ntc_resistance_hot_param = CHARGER_NTC_RESISTANCE_PARAM(hot);
+
+static const shell_param_t charger_ntc_temperature_cold_param =
+	CHARGER_NTC_TEMPERATURE_PARAM(cold);
+static const shell_param_t charger_ntc_temperature_cool_param =
+	CHARGER_NTC_TEMPERATURE_PARAM(cool);
+static const shell_param_t charger_ntc_temperature_warm_param =
+	CHARGER_NTC_TEMPERATURE_PARAM(warm);
+static const shell_param_t charger_ntc_temperature_hot_param = CHARGER_NTC_TEMPERATURE_PARAM(hot);
+
+static const shell_param_t charger_status_all_param = {
+	SHELL_PARAM_INSTANCE("charger", 0, charger_param_instance_get),
+	.name = "status",
+	.description = "charger status",
+	.type = SHELL_ARG_TYPE_UINT32_VALUE,
+	.unit = UNIT_TYPE_NONE,
+	.get = charger_status_all_get,
+};
+
+static const shell_param_t charger_status_charging_param = {
+	SHELL_PARAM_INSTANCE("charger", 0, charger_param_instance_get),
+	.name = "status",
+	.description = "charger status",
+	.type = SHELL_ARG_TYPE_BOOL_VALUE,
+	.unit = UNIT_TYPE_NONE,
+	.get = charger_status_charging_get,
+};
+
+static const shell_param_t charger_termination_current_param = {
+	SHELL_PARAM_INSTANCE("charger", 0, charger_param_instance_get),
+	.name = "termination current",
+	.description = "termination current",
+	.type = SHELL_ARG_TYPE_UINT32_VALUE,
+	.to_npmx = charger_iterm_to_npmx,
+	.from_npmx = charger_iterm_from_npmx,
+	.check = charger_param_check,
+	.unit = UNIT_TYPE_PCT,
+	.set = charger_termination_current_set,
+	.get = charger_termination_current_get,
+};
+
+static const shell_param_t charger_termination_voltage_normal_param =
+	CHARGER_TERMINATION_VOLTAGE_PARAM(normal);
+static const shell_param_t charger_termination_voltage_warm_param =
+	CHARGER_TERMINATION_VOLTAGE_PARAM(warm);
+
+static const shell_param_t charger_trickle_voltage_param = {
+	SHELL_PARAM_INSTANCE("charger", 0, charger_param_instance_get),
+	.name = "trickle voltage",
+	.description = "trickle voltage",
+	.type = SHELL_ARG_TYPE_UINT32_VALUE,
+	.to_npmx = charger_trickle_to_npmx,
+	.from_npmx = charger_trickle_from_npmx,
+	.check = charger_param_check,
+	.unit = UNIT_TYPE_MILLIVOLT,
+	.set = charger_trickle_voltage_set,
+	.get = charger_trickle_voltage_get,
+};
+
+SHELL_PARAM_CMD_SET(cmd_charger_charging_current_set, charger_charging_current_param)
+SHELL_PARAM_CMD_GET(cmd_charger_charging_current_get, charger_charging_current_param)
+SHELL_PARAM_CMD_SET(cmd_charger_die_temp_resume_set, charger_die_temp_resume_param)
+SHELL_PARAM_CMD_GET(cmd_charger_die_temp_resume_get, charger_die_temp_resume_param)
+SHELL_PARAM_CMD_GET(cmd_charger_die_temp_status_get, charger_die_temp_status_param)
+SHELL_PARAM_CMD_SET(cmd_charger_die_temp_stop_set, charger_die_temp_stop_param)
+SHELL_PARAM_CMD_GET(cmd_charger_die_temp_stop_get, charger_die_temp_stop_param)
+SHELL_PARAM_CMD_SET(cmd_charger_discharging_current_set, charger_discharging_current_param)
+SHELL_PARAM_CMD_GET(cmd_charger_discharging_current_get, charger_discharging_current_param)
+SHELL_PARAM_CMD_SET(cmd_charger_module_charger_set, charger_module_charger_param)
+SHELL_PARAM_CMD_GET(cmd_charger_module_charger_get, charger_module_charger_param)
+SHELL_PARAM_CMD_SET(cmd_charger_module_full_cool_set, charger_module_full_cool_param)
+SHELL_PARAM_CMD_GET(cmd_charger_module_full_cool_get, charger_module_full_cool_param)
+SHELL_PARAM_CMD_SET(cmd_charger_module_ntc_limits_set, charger_module_ntc_limits_param)
+SHELL_PARAM_CMD_GET(cmd_charger_module_ntc_limits_get, charger_module_ntc_limits_param)
+SHELL_PARAM_CMD_SET(cmd_charger_module_recharge_set, charger_module_recharge_param)
+SHELL_PARAM_CMD_GET(cmd_charger_module_recharge_get, charger_module_recharge_param)
+SHELL_PARAM_CMD_SET(cmd_charger_ntc_resistance_cold_set, charger_ntc_resistance_cold_param)
+SHELL_PARAM_CMD_GET(cmd_charger_ntc_resistance_cold_get, charger_ntc_resistance_cold_param)
+SHELL_PARAM_CMD_SET(cmd_charger_ntc_resistance_cool_set, charger_ntc_resistance_cool_param)
+SHELL_PARAM_CMD_GET(cmd_charger_ntc_resistance_cool_get, charger_ntc_resistance_cool_param)
+SHELL_PARAM_CMD_SET(cmd_charger_ntc_resistance_warm_set, charger_ntc_resistance_warm_param)
+SHELL_PARAM_CMD_GET(cmd_charger_ntc_resistance_warm_get, charger_ntc_resistance_warm_param)
+SHELL_PARAM_CMD_SET(cmd_charger_ntc_resistance_hot_set, charger_ntc_resistance_hot_param)
+SHELL_PARAM_CMD_GET(cmd_charger_ntc_resistance_hot_get, charger_ntc_resistance_hot_param)
+SHELL_PARAM_CMD_SET(cmd_charger_ntc_temperature_cold_set, charger_ntc_temperature_cold_param)
+SHELL_PARAM_CMD_GET(cmd_charger_ntc_temperature_cold_get, charger_ntc_temperature_cold_param)
+SHELL_PARAM_CMD_SET(cmd_charger_ntc_temperature_cool_set, charger_ntc_temperature_cool_param)
+SHELL_PARAM_CMD_GET(cmd_charger_ntc_temperature_cool_get, charger_ntc_temperature_cool_param)
+SHELL_PARAM_CMD_SET(cmd_charger_ntc_temperature_warm_set, charger_ntc_temperature_warm_param)
+SHELL_PARAM_CMD_GET(cmd_charger_ntc_temperature_warm_get, charger_ntc_temperature_warm_param)
+SHELL_PARAM_CMD_SET(cmd_charger_ntc_temperature_hot_set, charger_ntc_temperature_hot_param)
+SHELL_PARAM_CMD_GET(cmd_charger_ntc_temperature_hot_get, charger_ntc_temperature_hot_param)
+SHELL_PARAM_CMD_GET(cmd_charger_status_all_get, charger_status_all_param)
+SHELL_PARAM_CMD_GET(cmd_charger_status_charging_get, charger_status_charging_param)
+SHELL_PARAM_CMD_SET(cmd_charger_termination_current_set, charger_termination_current_param)
+SHELL_PARAM_CMD_GET(cmd_charger_termination_current_get, charger_termination_current_param)
+SHELL_PARAM_CMD_SET(cmd_charger_termination_voltage_normal_set,
+		    charger_termination_voltage_normal_param)
+SHELL_PARAM_CMD_GET(cmd_charger_termination_voltage_normal_get,
+		    charger_termination_voltage_normal_param)
+SHELL_PARAM_CMD_SET(cmd_charger_termination_voltage_warm_set,
+		    charger_termination_voltage_warm_param)
+SHELL_PARAM_CMD_GET(cmd_charger_termination_voltage_warm_get,
+		    charger_termination_voltage_warm_param)
+SHELL_PARAM_CMD_SET(cmd_charger_trickle_voltage_set, charger_trickle_voltage_param)
+SHELL_PARAM_CMD_GET(cmd_charger_trickle_voltage_get, charger_trickle_voltage_param)
 
 /* Creating subcommands (level 3 command) array for command "charger charging_current". */
 SHELL_STATIC_SUBCMD_SET_CREATE(sub_charger_charging_current,
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "shell_common.h"
+#include <npmx_driver.h>
+
+#include <string.h>
+#include <zephyr/sys/util.h>
+
+/* Size of the text buffer for the configuration snapshot in hexadecimal format. */
+#define SNAPSHOT_HEX_SIZE ((2 * NPMX_DRIVER_CONFIG_SIZE) + 1)
+
+static int cmd_config_dump(const struct shell *shell, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	uint8_t config[NPMX_DRIVER_CONFIG_SIZE];
+	char hex[SNAPSHOT_HEX_SIZE];
+	struct npmx_driver_config_span span;
+	size_t offset = 0;
+
+	if (npmx_driver_config_read(pmic_dev_get(), config) != 0) {
+		print_get_error(shell, "configuration");
+		return 0;
+	}
+
+	for (size_t i = 0; npmx_driver_config_span_get(i, &span) == 0; i++) {
+		(void)bin2hex(&config[offset], span.len, hex, sizeof(hex));
+		shell_print(shell, "0x%04X: %s", span.register_address, hex);
+		offset += span.len;
+	}
+
+	(void)bin2hex(config, sizeof(config), hex, sizeof(hex));
+	shell_print(shell, "Config: %s", hex);
+
+	return 0;
+}
+
+static int cmd_config_apply(const struct shell *shell, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+
+	uint8_t config[NPMX_DRIVER_CONFIG_SIZE];
+	size_t len = strlen(argv[1]);
+
+	if ((len != (2 * NPMX_DRIVER_CONFIG_SIZE)) ||
+	    (hex2bin(argv[1], len, config, sizeof(config)) != sizeof(config))) {
+		shell_error(shell, "Error: configuration has to be %u bytes in hexadecimal format.",
+			    NPMX_DRIVER_CONFIG_SIZE);
+		return 0;
+	}
+
+	if (npmx_driver_config_write(pmic_dev_get(), config) != 0) {
+		print_set_error(shell, "configuration");
+		return 0;
+	}
+
+	shell_print(shell, "Success: configuration applied.");
+	return 0;
+}
+
+/* Creating subcommands (level 2 command) array for command "config". */
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_config,
+			       SHELL_CMD(dump, NULL, "Read all configuration registers",
+					 cmd_config_dump),
+			       SHELL_CMD_ARG(apply, NULL,
+					     "Write all configuration registers, in dump format",
+					     cmd_config_apply, 2, 0),
+			       SHELL_SUBCMD_SET_END);
+
+SHELL_SUBCMD_ADD((npmx), config, &sub_config, "Configuration snapshot", NULL, 1, 0);
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "shell_common.h"
+#include <npmx_driver.h>
+
+/**
+ * @brief Function for parsing BUCK index and voltage pairs.
+ *
+ * @return Number of parsed voltages, or negative value if an argument is invalid.
+ */
+static int voltages_parse(const struct shell *shell, size_t argc, char **argv,
+			  struct npmx_driver_buck_voltage *p_voltages)
+{
+	size_t count = (argc - 1) / 2;
+	int err = 0;
+
+	if (((argc - 1) % 2) != 0) {
+		shell_error(shell, "Error: each BUCK index has to be followed by the voltage.");
+		return -EINVAL;
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		uint32_t index = shell_strtoul(argv[(2 * i) + 1], 0, &err);
+		uint32_t voltage_mv = shell_strtoul(argv[(2 * i) + 2], 0, &err);
+
+		if (err != 0) {
+			shell_error(shell, "Error: index and voltage have to be integers.");
+			return -EINVAL;
+		}
+
+		if (!check_instance_index(shell, "buck", index, NPM_BUCK_COUNT)) {
+			return -EINVAL;
+		}
+
+		p_voltages[i].index = (uint8_t)index;
+		p_voltages[i].voltage_mv = (uint16_t)MIN(voltage_mv, UINT16_MAX);
+	}
+
+	return (int)count;
+}
+
+static int voltages_cmd(const struct shell *shell, size_t argc, char **argv, bool retention)
+{
+	struct npmx_driver_buck_voltage voltages[NPM_BUCK_COUNT];
+	int count = voltages_parse(shell, argc, argv, voltages);
+	int err;
+
+	if (count < 0) {
+		return 0;
+	}
+
+	err = retention ? npmx_driver_buck_retention_voltage_set(pmic_dev_get(), voltages, count) :
+			  npmx_driver_buck_voltage_scale(pmic_dev_get(), voltages, count);
+	if (err == -EINVAL) {
+		shell_error(shell, "Error: repeated BUCK or unsupported voltage.");
+	} else if (err == -EBUSY) {
+		shell_error(shell, "Error: retention voltages selected or batch in progress.");
+	} else if (err != 0) {
+		print_set_error(shell, "voltages");
+	} else {
+		shell_print(shell, "Success: voltages changed.");
+	}
+
+	return 0;
+}
+
+static int cmd_dvfs_scale(const struct shell *shell, size_t argc, char **argv)
+{
+	return voltages_cmd(shell, argc, argv, false);
+}
+
+static int cmd_dvfs_retention_voltage(const struct shell *shell, size_t argc, char **argv)
+{
+	return voltages_cmd(shell, argc, argv, true);
+}
+
+static int cmd_dvfs_retention_select(const struct shell *shell, size_t argc, char **argv)
+{
+	args_info_t args_info = {
+		.expected_args = 1,
+		.arg = {
+			[0] = { SHELL_ARG_TYPE_BOOL_VALUE, "retention" },
+		},
+	};
+	if (!arguments_check(shell, argc, argv, &args_info)) {
+		return 0;
+	}
+
+	bool retention = args_info.arg[0].result.bvalue;
+	int err = npmx_driver_buck_retention_select(pmic_dev_get(), retention);
+
+	if (err == -ENOTSUP) {
+		shell_error(shell, "Error: host retention GPIO not configured.");
+	} else if (err != 0) {
+		print_set_error(shell, "retention selection");
+	} else {
+		print_success(shell, retention, UNIT_TYPE_NONE);
+	}
+
+	return 0;
+}
+
+/* Creating subcommands (level 3 command) array for command "dvfs retention". */
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_dvfs_retention,
+			       SHELL_CMD_ARG(voltage, NULL,
+					     "Set retention voltages <index> <mV> [<index> <mV>]",
+					     cmd_dvfs_retention_voltage, 3, 2),
+			       SHELL_CMD_ARG(select, NULL, "Select retention voltages <on|off>",
+					     cmd_dvfs_retention_select, 2, 0),
+			       SHELL_SUBCMD_SET_END);
+
+/* Creating subcommands (level 2 command) array for command "dvfs". */
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_dvfs,
+			       SHELL_CMD_ARG(scale, NULL,
+					     "Scale normal voltages <index> <mV> [<index> <mV>]",
+					     cmd_dvfs_scale, 3, 2),
+			       SHELL_CMD(retention, &sub_dvfs_retention, "Retention voltages",
+					 NULL),
+			       SHELL_SUBCMD_SET_END);
+
+SHELL_SUBCMD_ADD((npmx), dvfs, &sub_dvfs, "BUCK voltage scaling", NULL, 1, 0);
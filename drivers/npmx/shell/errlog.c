@@ -7,8 +7,6 @@
 #include "shell_common.h"
 #include <npmx_driver.h>
 
-static const struct device *pmic_dev = DEVICE_DT_GET(DT_NODELABEL(npm_0));
-
 static const char *shell_err_to_field(npmx_callback_type_t type, uint8_t bit)
 {
 	static const char * err_fieldnames[][8] =
@@ -39,14 +37,14 @@ static const char *shell_err_to_field(npmx_callback_type_t type, uint8_t bit)
 	return err_fieldnames[type][bit];
 }
 
-static void print_errlog(npmx_instance_t *p_pm, npmx_callback_type_t type, uint8_t mask)
+static void print_errlog(struct npmx_driver_event const *p_event, void *p_user_data)
 {
-	const struct shell *shell = (struct shell *)npmx_core_context_get(p_pm);
+	const struct shell *shell = (const struct shell *)p_user_data;
 
-	shell_print(shell, "%s:", npmx_callback_to_str(type));
+	shell_print(shell, "%s:", npmx_callback_to_str(p_event->type));
 	for (uint8_t i = 0; i < 8; i++) {
-		if ((1U << i) & mask) {
-			shell_print(shell, "\t%s", shell_err_to_field(type, i));
+		if ((1U << i) & p_event->mask) {
+			shell_print(shell, "\t%s", shell_err_to_field(p_event->type, i));
 		}
 	}
 }
@@ -56,22 +54,34 @@ static int cmd_errlog_get(const struct shell *shell, size_t argc, char **argv)
 	ARG_UNUSED(argc);
 	ARG_UNUSED(argv);
 
-	npmx_instance_t *npmx_instance = npmx_driver_instance_get(pmic_dev);
+	npmx_instance_t *npmx_instance = npmx_instance_get(shell);
 	if (npmx_instance == NULL) {
 		return 0;
 	}
 
-	npmx_core_context_set(npmx_instance, (void *)shell);
+	/* Errors are delivered from the check below, callbacks of the application are kept. */
+	struct npmx_driver_event_subscriber subscribers[] = {
+		{ .type = NPMX_CALLBACK_TYPE_RSTCAUSE },
+		{ .type = NPMX_CALLBACK_TYPE_CHARGER_ERROR },
+		{ .type = NPMX_CALLBACK_TYPE_SENSOR_ERROR },
+	};
 
-	npmx_core_register_cb(npmx_instance, print_errlog, NPMX_CALLBACK_TYPE_RSTCAUSE);
-	npmx_core_register_cb(npmx_instance, print_errlog, NPMX_CALLBACK_TYPE_CHARGER_ERROR);
-	npmx_core_register_cb(npmx_instance, print_errlog, NPMX_CALLBACK_TYPE_SENSOR_ERROR);
+	for (size_t i = 0; i < ARRAY_SIZE(subscribers); i++) {
+		subscribers[i].handler = print_errlog;
+		subscribers[i].p_user_data = (void *)shell;
+		subscribers[i].mask = UINT8_MAX;
+		(void)npmx_driver_event_subscribe(pmic_dev_get(), &subscribers[i]);
+	}
 
 	npmx_errlog_t *errlog_instance = npmx_errlog_get(npmx_instance, 0);
 	npmx_error_t err_code = npmx_errlog_reset_errors_check(errlog_instance);
 	if (!check_error_code(shell, err_code)) {
 		print_get_error(shell, "error log");
 	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(subscribers); i++) {
+		(void)npmx_driver_event_unsubscribe(pmic_dev_get(), &subscribers[i]);
+	}
 	return 0;
 }
 
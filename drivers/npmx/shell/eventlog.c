@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "shell_common.h"
+#include <npmx_driver.h>
+
+/* Number of records read from the event log at once. */
+#define RECORDS_CHUNK 8
+
+static void print_record(const struct shell *shell, struct npmx_driver_event_record const *p_record)
+{
+	npmx_callback_type_t type = (npmx_callback_type_t)p_record->type;
+
+	shell_print(shell, "%u: %u ms %s:", p_record->seq, p_record->timestamp,
+		    npmx_callback_to_str(type));
+	for (uint8_t i = 0; i < 8; i++) {
+		if (BIT(i) & p_record->mask) {
+			shell_print(shell, "\t%s", npmx_callback_bit_to_str(type, i));
+		}
+	}
+}
+
+static int cmd_eventlog_show(const struct shell *shell, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	struct npmx_driver_event_record records[RECORDS_CHUNK];
+	uint32_t seq = 0;
+	size_t total = 0;
+	int count;
+
+	do {
+		count = npmx_driver_event_log_read(pmic_dev_get(), &seq, records, RECORDS_CHUNK);
+		for (int i = 0; i < count; i++) {
+			print_record(shell, &records[i]);
+		}
+		total += (count > 0) ? count : 0;
+	} while (count == RECORDS_CHUNK);
+
+	if (count < 0) {
+		print_get_error(shell, "event log");
+	} else if (total == 0) {
+		shell_print(shell, "No events logged.");
+	}
+
+	return 0;
+}
+
+#if defined(CONFIG_NPMX_EVENT_LOG_NVS)
+static int cmd_eventlog_stored(const struct shell *shell, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	struct npmx_driver_event_record records[CONFIG_NPMX_EVENT_LOG_NVS_BLOCK_SIZE];
+
+	/* Oldest block first. */
+	for (size_t index = CONFIG_NPMX_EVENT_LOG_NVS_BLOCKS; index > 0; index--) {
+		int count = npmx_driver_event_log_stored_read(pmic_dev_get(), index - 1, records,
+							      ARRAY_SIZE(records));
+		if (count == -ENOENT) {
+			continue;
+		} else if (count < 0) {
+			shell_error(shell, "Error: event log storage not attached.");
+			return 0;
+		}
+
+		shell_print(shell, "Block %u:", index - 1);
+		for (int i = 0; i < count; i++) {
+			print_record(shell, &records[i]);
+		}
+	}
+
+	return 0;
+}
+
+static int cmd_eventlog_flush(const struct shell *shell, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	if (npmx_driver_event_log_flush(pmic_dev_get()) != 0) {
+		shell_error(shell, "Error: unable to store event log.");
+		return 0;
+	}
+
+	shell_print(shell, "Success: event log stored.");
+	return 0;
+}
+#endif
+
+/* Creating subcommands (level 2 command) array for command "eventlog". */
+#if defined(CONFIG_NPMX_EVENT_LOG_NVS)
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_eventlog,
+			       SHELL_CMD(show, NULL, "Print logged events", cmd_eventlog_show),
+			       SHELL_CMD(stored, NULL, "Print events stored in NVS, newest block 0",
+					 cmd_eventlog_stored),
+			       SHELL_CMD(flush, NULL, "Store pending events in NVS",
+					 cmd_eventlog_flush),
+			       SHELL_SUBCMD_SET_END);
+#else
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_eventlog,
+			       SHELL_CMD(show, NULL, "Print logged events", cmd_eventlog_show),
+			       SHELL_SUBCMD_SET_END);
+#endif
+
+SHELL_SUBCMD_ADD((npmx), eventlog, &sub_eventlog, "Event log", NULL, 1, 0);
@@ -4,19 +4,9 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
-#include "shell_common.h"
+#include "shell_table.h"
 #include <npmx_driver.h>
 
-/** @brief GPIO configuration parameter. */
-typedef enum {
-	GPIO_CONFIG_PARAM_DEBOUNCE, /* GPIO debounce. */
-	GPIO_CONFIG_PARAM_DRIVE, /* GPIO drive. */
-	GPIO_CONFIG_PARAM_MODE, /* GPIO mode. */
-	GPIO_CONFIG_PARAM_OPEN_DRAIN, /* GPIO open drain. */
-	GPIO_CONFIG_PARAM_PULL, /* GPIO pull. */
-	GPIO_CONFIG_PARAM_TYPE, /* Helper config to check if GPIO is output or input. */
-} gpio_config_param_t;
-
 static npmx_gpio_t *gpio_instance_get(const struct shell *shell, uint32_t index)
 {
 	npmx_instance_t *npmx_instance = npmx_instance_get(shell);
@@ -25,169 +15,145 @@ static npmx_gpio_t *gpio_instance_get(const struct shell *shell, uint32_t index)
 	return (npmx_instance && status) ? npmx_gpio_get(npmx_instance, (uint8_t)index) : NULL;
 }
 
-static npmx_gpio_mode_t gpio_mode_convert(const struct shell *shell, uint32_t mode)
-{
-	switch (mode) {
-	case 0:
-		return NPMX_GPIO_MODE_INPUT;
-	case 1:
-		return NPMX_GPIO_MODE_INPUT_OVERRIDE_1;
-	case 2:
-		return NPMX_GPIO_MODE_INPUT_OVERRIDE_0;
-	case 3:
-		return NPMX_GPIO_MODE_INPUT_RISING_EDGE;
-	case 4:
-		return NPMX_GPIO_MODE_INPUT_FALLING_EDGE;
-	case 5:
-		return NPMX_GPIO_MODE_OUTPUT_IRQ;
-	case 6:
-		return NPMX_GPIO_MODE_OUTPUT_RESET;
-	case 7:
-		return NPMX_GPIO_MODE_OUTPUT_PLW;
-	case 8:
-		return NPMX_GPIO_MODE_OUTPUT_OVERRIDE_1;
-	case 9:
-		return NPMX_GPIO_MODE_OUTPUT_OVERRIDE_0;
-	default:
-		shell_error(shell, "Error: Wrong mode:");
-		print_hint_error(shell, 0, "Input");
-		print_hint_error(shell, 1, "Input logic 1");
-		print_hint_error(shell, 2, "Input logic 0");
-		print_hint_error(shell, 3, "Input rising edge event");
-		print_hint_error(shell, 4, "Input falling edge event");
-		print_hint_error(shell, 5, "Output interrupt");
-		print_hint_error(shell, 6, "Output reset");
-		print_hint_error(shell, 7, "Output power loss warning");
-		print_hint_error(shell, 8, "Output logic 1");
-		print_hint_error(shell, 9, "Output logic 0");
-		return NPMX_GPIO_MODE_INVALID;
-	}
-}
-
-static npmx_gpio_pull_t gpio_pull_convert(const struct shell *shell, uint32_t pull)
-{
-	switch (pull) {
-	case 0:
-		return NPMX_GPIO_PULL_DOWN;
-	case 1:
-		return NPMX_GPIO_PULL_UP;
-	case 2:
-		return NPMX_GPIO_PULL_NONE;
-	default:
-		shell_error(shell, "Error: Wrong pull:");
-		print_hint_error(shell, 0, "Pull down");
-		print_hint_error(shell, 1, "Pull up");
-		print_hint_error(shell, 2, "Pull disable");
-		return NPMX_GPIO_PULL_INVALID;
-	}
-}
-
-static int gpio_config_set(const struct shell *shell, size_t argc, char **argv,
-			   gpio_config_param_t config_type)
-{
-	char *config_name;
-	shell_arg_type_t arg_type = SHELL_ARG_TYPE_UINT32_VALUE;
-	switch (config_type) {
-	case GPIO_CONFIG_PARAM_DEBOUNCE:
-		config_name = "debounce";
-		arg_type = SHELL_ARG_TYPE_BOOL_VALUE;
-		break;
-	case GPIO_CONFIG_PARAM_DRIVE:
-		config_name = "drive current";
-		break;
-	case GPIO_CONFIG_PARAM_MODE:
-		config_name = "mode";
-		break;
-	case GPIO_CONFIG_PARAM_OPEN_DRAIN:
-		config_name = "open drain";
-		arg_type = SHELL_ARG_TYPE_BOOL_VALUE;
-		break;
-	case GPIO_CONFIG_PARAM_PULL:
-		config_name = "pull";
-		break;
-	case GPIO_CONFIG_PARAM_TYPE:
-		return 0;
-	}
-
-	args_info_t args_info = { .expected_args = 2,
-				  .arg = {
-					  [0] = { SHELL_ARG_TYPE_UINT32_INDEX, "GPIO" },
-					  [1] = { arg_type, config_name },
-				  } };
-
-	if (!arguments_check(shell, argc, argv, &args_info)) {
-		return 0;
-	}
-
-	npmx_gpio_t *gpio_instance = gpio_instance_get(shell, args_info.arg[0].result.uvalue);
-	if (gpio_instance == NULL) {
-		return 0;
-	}
-
-	if (!check_pin_configuration_correctness(shell, (int8_t)(args_info.arg[0].result.uvalue))) {
-		return 0;
-	}
-
-	npmx_gpio_config_t gpio_config;
-	npmx_error_t err_code = npmx_gpio_config_get(gpio_instance, &gpio_config);
-	if (!check_error_code(shell, err_code)) {
-		print_get_error(shell, "GPIO config");
-		return 0;
-	}
-
-	shell_arg_result_t result = args_info.arg[1].result;
-	switch (config_type) {
-	case GPIO_CONFIG_PARAM_DEBOUNCE:
-		gpio_config.debounce = result.bvalue;
-		break;
-	case GPIO_CONFIG_PARAM_DRIVE:
-		gpio_config.drive = npmx_gpio_drive_convert(result.uvalue);
-		if (gpio_config.drive == NPMX_GPIO_DRIVE_INVALID) {
-			shell_error(shell, "Error: Wrong drive current:");
-			print_hint_error(shell, 1, "1 mA");
-			print_hint_error(shell, 6, "6 mA");
-			return 0;
-		}
-		break;
-	case GPIO_CONFIG_PARAM_MODE:
-		gpio_config.mode = gpio_mode_convert(shell, result.uvalue);
-		if (gpio_config.mode == NPMX_GPIO_MODE_INVALID) {
-			return 0;
-		}
-		break;
-	case GPIO_CONFIG_PARAM_OPEN_DRAIN:
-		gpio_config.open_drain = result.bvalue;
-		break;
-	case GPIO_CONFIG_PARAM_PULL:
-		gpio_config.pull = gpio_pull_convert(shell, result.uvalue);
-		if (gpio_config.pull == NPMX_GPIO_PULL_INVALID) {
-			return 0;
-		}
-		break;
-	default:
-		return 0;
-	}
-
-	err_code = npmx_gpio_config_set(gpio_instance, &gpio_config);
-	if (!check_error_code(shell, err_code)) {
-		print_set_error(shell, "GPIO config");
-		return 0;
-	}
+SHELL_PARAM_INSTANCE_GETTER(gpio_param_instance_get, npmx_gpio_get)
+SHELL_PARAM_GETTER(gpio_status_get, npmx_gpio_t, bool, npmx_gpio_status_check)
+SHELL_PARAM_TO_NPMX(gpio_drive_to_npmx, npmx_gpio_drive_t, npmx_gpio_drive_convert,
+		    NPMX_GPIO_DRIVE_INVALID)
+SHELL_PARAM_FROM_NPMX(gpio_drive_from_npmx, npmx_gpio_drive_t, npmx_gpio_drive_convert_to_ma)
 
-	switch (config_type) {
-	case GPIO_CONFIG_PARAM_DRIVE:
-		print_success(shell, result.uvalue, UNIT_TYPE_MILLIAMPERE);
-		break;
-	default:
-		print_success(shell, result.uvalue, UNIT_TYPE_NONE);
-		break;
-	}
-
-	return 0;
-}
+/**
+ * @brief Macro for defining the setter and getter of a GPIO configuration field.
+ *
+ * @param _field Field of the npmx GPIO configuration.
+ * @param _type  Type of the field.
+ */
+#define GPIO_CONFIG_ACCESSORS(_field, _type)                                                       \
+	static npmx_error_t gpio_##_field##_set(void const *p_instance, int32_t value)             \
+	{                                                                                          \
+		npmx_gpio_config_t gpio_config;                                                    \
+		npmx_error_t err_code = npmx_gpio_config_get(p_instance, &gpio_config);            \
+		if (err_code != NPMX_SUCCESS) {                                                    \
+			return err_code;                                                           \
+		}                                                                                  \
+		gpio_config._field = (_type)value;                                                 \
+		return npmx_gpio_config_set(p_instance, &gpio_config);                             \
+	}                                                                                          \
+                                                                                                   \
+	static npmx_error_t gpio_##_field##_get(void const *p_instance, int32_t *p_value)          \
+	{                                                                                          \
+		npmx_gpio_config_t gpio_config;                                                    \
+		npmx_error_t err_code = npmx_gpio_config_get(p_instance, &gpio_config);            \
+		*p_value = (int32_t)gpio_config._field;                                            \
+		return err_code;                                                                   \
+	}
+
+GPIO_CONFIG_ACCESSORS(debounce, bool)
+GPIO_CONFIG_ACCESSORS(drive, npmx_gpio_drive_t)
+GPIO_CONFIG_ACCESSORS(mode, npmx_gpio_mode_t)
+GPIO_CONFIG_ACCESSORS(open_drain, bool)
+GPIO_CONFIG_ACCESSORS(pull, npmx_gpio_pull_t)
+
+static const shell_enum_map_t gpio_modes[] = {
+	{ NPMX_GPIO_MODE_INPUT, "Input" },
+	{ NPMX_GPIO_MODE_INPUT_OVERRIDE_1, "Input logic 1" },
+	{ NPMX_GPIO_MODE_INPUT_OVERRIDE_0, "Input logic 0" },
+	{ NPMX_GPIO_MODE_INPUT_RISING_EDGE, "Input rising edge event" },
+	{ NPMX_GPIO_MODE_INPUT_FALLING_EDGE, "Input falling edge event" },
+	{ NPMX_GPIO_MODE_OUTPUT_IRQ, "Output interrupt" },
+	{ NPMX_GPIO_MODE_OUTPUT_RESET, "Output reset" },
+	{ NPMX_GPIO_MODE_OUTPUT_PLW, "Output power loss warning" },
+	{ NPMX_GPIO_MODE_OUTPUT_OVERRIDE_1, "Output logic 1" },
+	{ NPMX_GPIO_MODE_OUTPUT_OVERRIDE_0, "Output logic 0" },
+};
+
+static const shell_enum_map_t gpio_pulls[] = {
+	{ NPMX_GPIO_PULL_DOWN, "Pull down" },
+	{ NPMX_GPIO_PULL_UP, "Pull up" },
+	{ NPMX_GPIO_PULL_NONE, "Pull disable" },
+};
+
+/* GPIOs used by the driver as interrupt or POF cannot be configured. */
+static const shell_param_t gpio_debounce_param = {
+	SHELL_PARAM_INSTANCE("GPIO", NPM_GPIOS_COUNT, gpio_param_instance_get),
+	.name = "debounce",
+	.description = "GPIO config",
+	.type = SHELL_ARG_TYPE_BOOL_VALUE,
+	.check = shell_param_pin_instance_check,
+	.unit = UNIT_TYPE_NONE,
+	.set = gpio_debounce_set,
+	.get = gpio_debounce_get,
+};
+
+static const shell_param_t gpio_drive_param = {
+	SHELL_PARAM_INSTANCE("GPIO", NPM_GPIOS_COUNT, gpio_param_instance_get),
+	.name = "drive current",
+	.description = "GPIO config",
+	.type = SHELL_ARG_TYPE_UINT32_VALUE,
+	.to_npmx = gpio_drive_to_npmx,
+	.from_npmx = gpio_drive_from_npmx,
+	.check = shell_param_pin_instance_check,
+	.unit = UNIT_TYPE_MILLIAMPERE,
+	.set = gpio_drive_set,
+	.get = gpio_drive_get,
+};
+
+static const shell_param_t gpio_mode_param = {
+	SHELL_PARAM_INSTANCE("GPIO", NPM_GPIOS_COUNT, gpio_param_instance_get),
+	.name = "mode",
+	.description = "GPIO config",
+	.type = SHELL_ARG_TYPE_UINT32_VALUE,
+	SHELL_PARAM_MAP(gpio_modes),
+	.check = shell_param_pin_instance_check,
+	.unit = UNIT_TYPE_NONE,
+	.set = gpio_mode_set,
+	.get = gpio_mode_get,
+};
+
+static const shell_param_t gpio_open_drain_param = {
+	SHELL_PARAM_INSTANCE("GPIO", NPM_GPIOS_COUNT, gpio_param_instance_get),
+	.name = "open drain",
+	.description = "GPIO config",
+	.type = SHELL_ARG_TYPE_BOOL_VALUE,
+	.check = shell_param_pin_instance_check,
+	.unit = UNIT_TYPE_NONE,
+	.set = gpio_open_drain_set,
+	.get = gpio_open_drain_get,
+};
+
+static const shell_param_t gpio_pull_param = {
+	SHELL_PARAM_INSTANCE("GPIO", NPM_GPIOS_COUNT, gpio_param_instance_get),
+	.name = "pull",
+	.description = "GPIO config",
+	.type = SHELL_ARG_TYPE_UINT32_VALUE,
+	SHELL_PARAM_MAP(gpio_pulls),
+	.check = shell_param_pin_instance_check,
+	.unit = UNIT_TYPE_NONE,
+	.set = gpio_pull_set,
+	.get = gpio_pull_get,
+};
+
+static const shell_param_t gpio_status_param = {
+	SHELL_PARAM_INSTANCE("GPIO", NPM_GPIOS_COUNT, gpio_param_instance_get),
+	.name = "status",
+	.description = "GPIO status",
+	.type = SHELL_ARG_TYPE_BOOL_VALUE,
+	.unit = UNIT_TYPE_NONE,
+	.get = gpio_status_get,
+};
+
+SHELL_PARAM_CMD_SET(cmd_gpio_config_debounce_set, gpio_debounce_param)
+SHELL_PARAM_CMD_GET(cmd_gpio_config_debounce_get, gpio_debounce_param)
+SHELL_PARAM_CMD_SET(cmd_gpio_config_drive_set, gpio_drive_param)
+SHELL_PARAM_CMD_GET(cmd_gpio_config_drive_get, gpio_drive_param)
+SHELL_PARAM_CMD_SET(cmd_gpio_config_mode_set, gpio_mode_param)
+SHELL_PARAM_CMD_GET(cmd_gpio_config_mode_get, gpio_mode_param)
+SHELL_PARAM_CMD_SET(cmd_gpio_config_open_drain_set, gpio_open_drain_param)
+SHELL_PARAM_CMD_GET(cmd_gpio_config_open_drain_get, gpio_open_drain_param)
+SHELL_PARAM_CMD_SET(cmd_gpio_config_pull_set, gpio_pull_param)
+SHELL_PARAM_CMD_GET(cmd_gpio_config_pull_get, gpio_pull_param)
+SHELL_PARAM_CMD_GET(cmd_gpio_status_get, gpio_status_param)
 
-static int gpio_config_get(const struct shell *shell, size_t argc, char **argv,
-			   gpio_config_param_t config_type)
+static int cmd_gpio_type_get(const struct shell *shell, size_t argc, char **argv)
 {
 	args_info_t args_info = { .expected_args = 1,
 				  .arg = {
@@ -209,119 +175,15 @@ static int gpio_config_get(const struct shell *shell, size_t argc, char **argv,
 		return 0;
 	}
 
-	switch (config_type) {
-	case GPIO_CONFIG_PARAM_DEBOUNCE:
-		print_value(shell, gpio_config.debounce, UNIT_TYPE_NONE);
-		break;
-	case GPIO_CONFIG_PARAM_DRIVE:
-		uint32_t current_ma = 0;
-		if (!npmx_gpio_drive_convert_to_ma(gpio_config.drive, &current_ma)) {
-			print_convert_error(shell, "gpio drive", "milliamperes");
-			return 0;
-		}
-		print_value(shell, current_ma, UNIT_TYPE_MILLIAMPERE);
-		break;
-	case GPIO_CONFIG_PARAM_MODE:
-		print_value(shell, (int)gpio_config.mode, UNIT_TYPE_NONE);
-		break;
-	case GPIO_CONFIG_PARAM_OPEN_DRAIN:
-		print_value(shell, gpio_config.open_drain, UNIT_TYPE_NONE);
-		break;
-	case GPIO_CONFIG_PARAM_PULL:
-		print_value(shell, (int)gpio_config.pull, UNIT_TYPE_NONE);
-		break;
-	case GPIO_CONFIG_PARAM_TYPE:
-		if (gpio_config.mode <= NPMX_GPIO_MODE_INPUT_FALLING_EDGE) {
-			shell_print(shell, "Value: input.");
-		} else {
-			shell_print(shell, "Value: output.");
-		}
-		break;
+	if (gpio_config.mode <= NPMX_GPIO_MODE_INPUT_FALLING_EDGE) {
+		shell_print(shell, "Value: input.");
+	} else {
+		shell_print(shell, "Value: output.");
 	}
-	return 0;
-}
 
-static int cmd_gpio_config_debounce_set(const struct shell *shell, size_t argc, char **argv)
-{
-	return gpio_config_set(shell, argc, argv, GPIO_CONFIG_PARAM_DEBOUNCE);
-}
-
-static int cmd_gpio_config_debounce_get(const struct shell *shell, size_t argc, char **argv)
-{
-	return gpio_config_get(shell, argc, argv, GPIO_CONFIG_PARAM_DEBOUNCE);
-}
-
-static int cmd_gpio_config_drive_set(const struct shell *shell, size_t argc, char **argv)
-{
-	return gpio_config_set(shell, argc, argv, GPIO_CONFIG_PARAM_DRIVE);
-}
-
-static int cmd_gpio_config_drive_get(const struct shell *shell, size_t argc, char **argv)
-{
-	return gpio_config_get(shell, argc, argv, GPIO_CONFIG_PARAM_DRIVE);
-}
-
-static int cmd_gpio_config_mode_set(const struct shell *shell, size_t argc, char **argv)
-{
-	return gpio_config_set(shell, argc, argv, GPIO_CONFIG_PARAM_MODE);
-}
-
-static int cmd_gpio_config_mode_get(const struct shell *shell, size_t argc, char **argv)
-{
-	return gpio_config_get(shell, argc, argv, GPIO_CONFIG_PARAM_MODE);
-}
-
-static int cmd_gpio_config_open_drain_set(const struct shell *shell, size_t argc, char **argv)
-{
-	return gpio_config_set(shell, argc, argv, GPIO_CONFIG_PARAM_OPEN_DRAIN);
-}
-
-static int cmd_gpio_config_open_drain_get(const struct shell *shell, size_t argc, char **argv)
-{
-	return gpio_config_get(shell, argc, argv, GPIO_CONFIG_PARAM_OPEN_DRAIN);
-}
-
-static int cmd_gpio_config_pull_set(const struct shell *shell, size_t argc, char **argv)
-{
-	return gpio_config_set(shell, argc, argv, GPIO_CONFIG_PARAM_PULL);
-}
-
-static int cmd_gpio_config_pull_get(const struct shell *shell, size_t argc, char **argv)
-{
-	return gpio_config_get(shell, argc, argv, GPIO_CONFIG_PARAM_PULL);
-}
-
-static int cmd_gpio_status_get(const struct shell *shell, size_t argc, char **argv)
-{
-	args_info_t args_info = { .expected_args = 1,
-				  .arg = {
-					  [0] = { SHELL_ARG_TYPE_UINT32_INDEX, "GPIO" },
-				  } };
-	if (!arguments_check(shell, argc, argv, &args_info)) {
-		return 0;
-	}
-
-	npmx_gpio_t *gpio_instance = gpio_instance_get(shell, args_info.arg[0].result.uvalue);
-	if (gpio_instance == NULL) {
-		return 0;
-	}
-
-	bool gpio_status;
-	npmx_error_t err_code = npmx_gpio_status_check(gpio_instance, &gpio_status);
-	if (!check_error_code(shell, err_code)) {
-		print_get_error(shell, "GPIO status");
-		return 0;
-	}
-
-	print_value(shell, gpio_status, UNIT_TYPE_NONE);
 	return 0;
 }
 
-static int cmd_gpio_type_get(const struct shell *shell, size_t argc, char **argv)
-{
-	return gpio_config_get(shell, argc, argv, GPIO_CONFIG_PARAM_TYPE);
-}
-
 /* Creating subcommands (level 4 command) array for command "gpio config debounce". */
 SHELL_STATIC_SUBCMD_SET_CREATE(sub_gpio_config_debounce,
 			       SHELL_CMD(set, NULL, "Set debounce status",
@@ -4,21 +4,9 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
-#include "shell_common.h"
+#include "shell_table.h"
 #include <npmx_driver.h>
 
-/** @brief Load switch GPIO configuration parameter. */
-typedef enum {
-	LDSW_GPIO_PARAM_INDEX, /* Pin index. */
-	LDSW_GPIO_PARAM_POLARITY, /* Pin polarity. */
-} ldsw_gpio_param_t;
-
-/** @brief Load switch soft-start configuration parameter. */
-typedef enum {
-	LDSW_SOFT_START_PARAM_ENABLE, /* Soft-start enable. */
-	LDSW_SOFT_START_PARAM_CURRENT /* Soft-start current. */
-} ldsw_soft_start_config_param_t;
-
 static npmx_ldsw_t *ldsw_instance_get(const struct shell *shell, uint32_t index)
 {
 	npmx_instance_t *npmx_instance = npmx_instance_get(shell);
@@ -27,60 +15,65 @@ static npmx_ldsw_t *ldsw_instance_get(const struct shell *shell, uint32_t index)
 	return (npmx_instance && status) ? npmx_ldsw_get(npmx_instance, (uint8_t)index) : NULL;
 }
 
-static int cmd_ldsw_active_discharge_set(const struct shell *shell, size_t argc, char **argv)
+SHELL_PARAM_INSTANCE_GETTER(ldsw_param_instance_get, npmx_ldsw_get)
+SHELL_PARAM_SETTER(ldsw_active_discharge_set, npmx_ldsw_t, bool,
+		   npmx_ldsw_active_discharge_enable_set)
+SHELL_PARAM_GETTER(ldsw_active_discharge_get, npmx_ldsw_t, bool,
+		   npmx_ldsw_active_discharge_enable_get)
+SHELL_PARAM_SETTER(ldsw_ldo_voltage_set, npmx_ldsw_t, npmx_ldsw_voltage_t,
+		   npmx_ldsw_ldo_voltage_set)
+SHELL_PARAM_GETTER(ldsw_ldo_voltage_get, npmx_ldsw_t, npmx_ldsw_voltage_t,
+		   npmx_ldsw_ldo_voltage_get)
+SHELL_PARAM_GETTER(ldsw_mode_get, npmx_ldsw_t, npmx_ldsw_mode_t, npmx_ldsw_mode_get)
+SHELL_PARAM_TO_NPMX(ldsw_voltage_to_npmx, npmx_ldsw_voltage_t, npmx_ldsw_voltage_convert,
+		    NPMX_LDSW_VOLTAGE_INVALID)
+SHELL_PARAM_FROM_NPMX(ldsw_voltage_from_npmx, npmx_ldsw_voltage_t,
+		      npmx_ldsw_voltage_convert_to_mv)
+SHELL_PARAM_TO_NPMX(ldsw_soft_start_current_to_npmx, npmx_ldsw_soft_start_current_t,
+		    npmx_ldsw_soft_start_current_convert, NPMX_LDSW_SOFT_START_CURRENT_INVALID)
+SHELL_PARAM_FROM_NPMX(ldsw_soft_start_current_from_npmx, npmx_ldsw_soft_start_current_t,
+		      npmx_ldsw_soft_start_current_convert_to_ma)
+
+static npmx_error_t ldsw_gpio_index_set(void const *p_instance, int32_t value)
 {
-	args_info_t args_info = { .expected_args = 2,
-				  .arg = {
-					  [0] = { SHELL_ARG_TYPE_UINT32_INDEX, "LDSW" },
-					  [1] = { SHELL_ARG_TYPE_BOOL_VALUE, "status" },
-				  } };
-	if (!arguments_check(shell, argc, argv, &args_info)) {
-		return 0;
-	}
-
-	npmx_ldsw_t *ldsw_instance = ldsw_instance_get(shell, args_info.arg[0].result.uvalue);
-	if (ldsw_instance == NULL) {
-		return 0;
+	npmx_ldsw_gpio_config_t gpio_config;
+	npmx_error_t err_code = npmx_ldsw_enable_gpio_get(p_instance, &gpio_config);
+	if (err_code != NPMX_SUCCESS) {
+		return err_code;
 	}
 
-	bool discharge_status = args_info.arg[1].result.bvalue;
-	npmx_error_t err_code =
-		npmx_ldsw_active_discharge_enable_set(ldsw_instance, discharge_status);
+	gpio_config.gpio = (npmx_ldsw_gpio_t)value;
+	return npmx_ldsw_enable_gpio_set(p_instance, &gpio_config);
+}
 
-	if (!check_error_code(shell, err_code)) {
-		print_set_error(shell, "LDSW active discharge status");
-		return 0;
-	}
+static npmx_error_t ldsw_gpio_index_get(void const *p_instance, int32_t *p_value)
+{
+	npmx_ldsw_gpio_config_t gpio_config;
+	npmx_error_t err_code = npmx_ldsw_enable_gpio_get(p_instance, &gpio_config);
 
-	print_success(shell, discharge_status, UNIT_TYPE_NONE);
-	return 0;
+	*p_value = (int32_t)gpio_config.gpio;
+	return err_code;
 }
 
-static int cmd_ldsw_active_discharge_get(const struct shell *shell, size_t argc, char **argv)
+static npmx_error_t ldsw_gpio_polarity_set(void const *p_instance, int32_t value)
 {
-	args_info_t args_info = { .expected_args = 1,
-				  .arg = {
-					  [0] = { SHELL_ARG_TYPE_UINT32_INDEX, "LDSW" },
-				  } };
-	if (!arguments_check(shell, argc, argv, &args_info)) {
-		return 0;
+	npmx_ldsw_gpio_config_t gpio_config;
+	npmx_error_t err_code = npmx_ldsw_enable_gpio_get(p_instance, &gpio_config);
+	if (err_code != NPMX_SUCCESS) {
+		return err_code;
 	}
 
-	npmx_ldsw_t *ldsw_instance = ldsw_instance_get(shell, args_info.arg[0].result.uvalue);
-	if (ldsw_instance == NULL) {
-		return 0;
-	}
+	gpio_config.inverted = (value != 0);
+	return npmx_ldsw_enable_gpio_set(p_instance, &gpio_config);
+}
 
-	bool discharge_status;
-	npmx_error_t err_code =
-		npmx_ldsw_active_discharge_enable_get(ldsw_instance, &discharge_status);
-	if (!check_error_code(shell, err_code)) {
-		print_get_error(shell, "LDSW active discharge status");
-		return 0;
-	}
+static npmx_error_t ldsw_gpio_polarity_get(void const *p_instance, int32_t *p_value)
+{
+	npmx_ldsw_gpio_config_t gpio_config;
+	npmx_error_t err_code = npmx_ldsw_enable_gpio_get(p_instance, &gpio_config);
 
-	print_value(shell, discharge_status, UNIT_TYPE_NONE);
-	return 0;
+	*p_value = gpio_config.inverted ? 1 : 0;
+	return err_code;
 }
 
 static npmx_ldsw_gpio_t ldsw_gpio_index_convert(int32_t gpio_idx)
@@ -103,439 +96,195 @@ static npmx_ldsw_gpio_t ldsw_gpio_index_convert(int32_t gpio_idx)
 	}
 }
 
-static int ldsw_gpio_set(const struct shell *shell, size_t argc, char **argv,
-			 ldsw_gpio_param_t config_type)
-{
-	char *config_name;
-	shell_arg_type_t arg_type = SHELL_ARG_TYPE_INT32_VALUE;
-
-	switch (config_type) {
-	case LDSW_GPIO_PARAM_INDEX:
-		config_name = "GPIO number";
-		break;
-	case LDSW_GPIO_PARAM_POLARITY:
-		config_name = "GPIO polarity";
-		arg_type = SHELL_ARG_TYPE_BOOL_VALUE;
-		break;
-	default:
-		return 0;
-	}
-
-	args_info_t args_info = { .expected_args = 2,
-				  .arg = {
-					  [0] = { SHELL_ARG_TYPE_UINT32_INDEX, "LDSW" },
-					  [1] = { arg_type, config_name },
-				  } };
-
-	if (!arguments_check(shell, argc, argv, &args_info)) {
-		return 0;
-	}
-
-	npmx_ldsw_t *ldsw_instance = ldsw_instance_get(shell, args_info.arg[0].result.uvalue);
-	if (ldsw_instance == NULL) {
-		return 0;
-	}
-
-	npmx_ldsw_gpio_config_t gpio_config;
-	npmx_error_t err_code = npmx_ldsw_enable_gpio_get(ldsw_instance, &gpio_config);
-	if (!check_error_code(shell, err_code)) {
-		print_get_error(shell, "GPIO config");
-		return 0;
-	}
-
-	switch (config_type) {
-	case LDSW_GPIO_PARAM_INDEX:
-		gpio_config.gpio = ldsw_gpio_index_convert(args_info.arg[1].result.ivalue);
-
-		if (gpio_config.gpio == NPMX_LDSW_GPIO_INVALID) {
-			shell_error(shell, "Error: wrong GPIO index.");
-			return 0;
-		}
-
-		if (!check_pin_configuration_correctness(shell, args_info.arg[1].result.ivalue)) {
-			return 0;
-		}
-
-		break;
-	case LDSW_GPIO_PARAM_POLARITY:
-		gpio_config.inverted = args_info.arg[1].result.bvalue;
-		break;
-	default:
-		return 0;
-	}
-
-	err_code = npmx_ldsw_enable_gpio_set(ldsw_instance, &gpio_config);
-	if (!check_error_code(shell, err_code)) {
-		print_set_error(shell, "GPIO config");
-		return 0;
-	}
-
-	int16_t value = (config_type == LDSW_GPIO_PARAM_INDEX) ? args_info.arg[1].result.ivalue :
-								 gpio_config.inverted;
-
-	print_success(shell, value, UNIT_TYPE_NONE);
-	return 0;
-}
-
-static int ldsw_gpio_get(const struct shell *shell, size_t argc, char **argv,
-			 ldsw_gpio_param_t config_type)
-{
-	args_info_t args_info = { .expected_args = 1,
-				  .arg = {
-					  [0] = { SHELL_ARG_TYPE_UINT32_INDEX, "LDSW" },
-				  } };
-	if (!arguments_check(shell, argc, argv, &args_info)) {
-		return 0;
-	}
-
-	npmx_ldsw_t *ldsw_instance = ldsw_instance_get(shell, args_info.arg[0].result.uvalue);
-	if (ldsw_instance == NULL) {
-		return 0;
-	}
-
-	npmx_ldsw_gpio_config_t gpio_config;
-	npmx_error_t err_code = npmx_ldsw_enable_gpio_get(ldsw_instance, &gpio_config);
-	if (!check_error_code(shell, err_code)) {
-		print_get_error(shell, "GPIO config");
-		return 0;
-	}
-
-	switch (config_type) {
-	case LDSW_GPIO_PARAM_INDEX:
-		int8_t gpio_index = (gpio_config.gpio == NPMX_LDSW_GPIO_NC) ?
-					    -1 :
-					    ((int8_t)gpio_config.gpio - 1);
-
-		print_value(shell, gpio_index, UNIT_TYPE_NONE);
-		break;
-	case LDSW_GPIO_PARAM_POLARITY:
-		print_value(shell, gpio_config.inverted, UNIT_TYPE_NONE);
-		break;
-	default:
-		return 0;
-	}
-
-	return 0;
-}
-
-static int cmd_ldsw_gpio_index_set(const struct shell *shell, size_t argc, char **argv)
+static bool ldsw_gpio_to_npmx(int32_t value, int32_t *p_converted)
 {
-	return ldsw_gpio_set(shell, argc, argv, LDSW_GPIO_PARAM_INDEX);
-}
-
-static int cmd_ldsw_gpio_index_get(const struct shell *shell, size_t argc, char **argv)
-{
-	return ldsw_gpio_get(shell, argc, argv, LDSW_GPIO_PARAM_INDEX);
-}
-
-static int cmd_ldsw_gpio_polarity_set(const struct shell *shell, size_t argc, char **argv)
-{
-	return ldsw_gpio_set(shell, argc, argv, LDSW_GPIO_PARAM_POLARITY);
-}
-
-static int cmd_ldsw_gpio_polarity_get(const struct shell *shell, size_t argc, char **argv)
-{
-	return ldsw_gpio_get(shell, argc, argv, LDSW_GPIO_PARAM_POLARITY);
-}
-static int cmd_ldsw_ldo_voltage_set(const struct shell *shell, size_t argc, char **argv)
-{
-	args_info_t args_info = { .expected_args = 2,
-				  .arg = {
-					  [0] = { SHELL_ARG_TYPE_UINT32_INDEX, "LDSW" },
-					  [1] = { SHELL_ARG_TYPE_UINT32_VALUE, "voltage" },
-				  } };
-	if (!arguments_check(shell, argc, argv, &args_info)) {
-		return 0;
-	}
-
-	npmx_ldsw_t *ldsw_instance = ldsw_instance_get(shell, args_info.arg[0].result.uvalue);
-	if (ldsw_instance == NULL) {
-		return 0;
-	}
-
-	uint32_t voltage_mv = args_info.arg[1].result.uvalue;
-	npmx_ldsw_voltage_t ldsw_voltage = npmx_ldsw_voltage_convert(voltage_mv);
-	if (ldsw_voltage == NPMX_LDSW_VOLTAGE_INVALID) {
-		print_convert_error(shell, "millivolts", "LDSW voltage");
-		return 0;
-	}
-
-	npmx_error_t err_code = npmx_ldsw_ldo_voltage_set(ldsw_instance, ldsw_voltage);
-	if (!check_error_code(shell, err_code)) {
-		print_set_error(shell, "LDSW voltage");
-		return 0;
-	}
+	npmx_ldsw_gpio_t gpio = ldsw_gpio_index_convert(value);
 
-	print_success(shell, voltage_mv, UNIT_TYPE_MILLIVOLT);
-	return 0;
+	*p_converted = (int32_t)gpio;
+	return gpio != NPMX_LDSW_GPIO_INVALID;
 }
 
-static int cmd_ldsw_ldo_voltage_get(const struct shell *shell, size_t argc, char **argv)
+static bool ldsw_gpio_from_npmx(int32_t value, int32_t *p_converted)
 {
-	args_info_t args_info = { .expected_args = 1,
-				  .arg = {
-					  [0] = { SHELL_ARG_TYPE_UINT32_INDEX, "LDSW" },
-				  } };
-	if (!arguments_check(shell, argc, argv, &args_info)) {
-		return 0;
-	}
-
-	npmx_ldsw_t *ldsw_instance = ldsw_instance_get(shell, args_info.arg[0].result.uvalue);
-	if (ldsw_instance == NULL) {
-		return 0;
-	}
-
-	npmx_ldsw_voltage_t ldsw_voltage;
-	npmx_error_t err_code = npmx_ldsw_ldo_voltage_get(ldsw_instance, &ldsw_voltage);
-	if (!check_error_code(shell, err_code)) {
-		print_get_error(shell, "LDSW voltage");
-		return 0;
-	}
-
-	uint32_t voltage_mv;
-	if (!npmx_ldsw_voltage_convert_to_mv(ldsw_voltage, &voltage_mv)) {
-		print_convert_error(shell, "LDSW voltage", "millivolts");
-		return 0;
-	}
-
-	print_value(shell, voltage_mv, UNIT_TYPE_MILLIVOLT);
-	return 0;
+	*p_converted = (value == NPMX_LDSW_GPIO_NC) ? -1 : (value - 1);
+	return true;
 }
 
-static int cmd_ldsw_mode_set(const struct shell *shell, size_t argc, char **argv)
+/* LDSW reset is required to apply mode change. */
+static npmx_error_t ldsw_mode_set(void const *p_instance, int32_t value)
 {
-	args_info_t args_info = {
-		.expected_args = 2,
-		.arg = { [0] = { SHELL_ARG_TYPE_UINT32_INDEX, "LDSW" },
-			 [1] = { SHELL_ARG_TYPE_UINT32_VALUE, "mode" }, },
-	};
-	if (!arguments_check(shell, argc, argv, &args_info)) {
-		return 0;
-	}
-
-	npmx_ldsw_t *ldsw_instance = ldsw_instance_get(shell, args_info.arg[0].result.uvalue);
-	if (ldsw_instance == NULL) {
-		return 0;
-	}
-
-	uint32_t mode = args_info.arg[1].result.uvalue;
-	npmx_ldsw_mode_t ldsw_mode;
-	switch (mode) {
-	case 0:
-		ldsw_mode = NPMX_LDSW_MODE_LOAD_SWITCH;
-		break;
-	case 1:
-		ldsw_mode = NPMX_LDSW_MODE_LDO;
-		break;
-	default:
-		shell_error(shell, "Error: Wrong mode:");
-		print_hint_error(shell, 0, "LOADSW");
-		print_hint_error(shell, 1, "LDO");
-		return 0;
-	}
-
-	npmx_error_t err_code = npmx_ldsw_mode_set(ldsw_instance, ldsw_mode);
+	npmx_error_t err_code = npmx_ldsw_mode_set(p_instance, (npmx_ldsw_mode_t)value);
 	if (err_code != NPMX_SUCCESS) {
-		print_set_error(shell, "LDSW mode");
-		return 0;
+		return err_code;
 	}
 
-	/* LDSW reset is required to apply mode change. */
-	err_code = npmx_ldsw_task_trigger(ldsw_instance, NPMX_LDSW_TASK_DISABLE);
-	if (!check_error_code(shell, err_code)) {
-		shell_error(shell, "Error: reset error while disabling LDSW to change mode.");
-		return 0;
-	}
-
-	err_code = npmx_ldsw_task_trigger(ldsw_instance, NPMX_LDSW_TASK_ENABLE);
-	if (!check_error_code(shell, err_code)) {
-		shell_error(shell, "Error: reset error while enabling LDSW to change mode.");
-		return 0;
+	err_code = npmx_ldsw_task_trigger(p_instance, NPMX_LDSW_TASK_DISABLE);
+	if (err_code != NPMX_SUCCESS) {
+		return err_code;
 	}
 
-	print_success(shell, mode, UNIT_TYPE_NONE);
-	return 0;
+	return npmx_ldsw_task_trigger(p_instance, NPMX_LDSW_TASK_ENABLE);
 }
 
-static int cmd_ldsw_mode_get(const struct shell *shell, size_t argc, char **argv)
+static npmx_error_t ldsw_soft_start_current_set(void const *p_instance, int32_t value)
 {
-	args_info_t args_info = { .expected_args = 1,
-				  .arg = {
-					  [0] = { SHELL_ARG_TYPE_UINT32_INDEX, "LDSW" },
-				  } };
-	if (!arguments_check(shell, argc, argv, &args_info)) {
-		return 0;
-	}
-
-	npmx_ldsw_t *ldsw_instance = ldsw_instance_get(shell, args_info.arg[0].result.uvalue);
-	if (ldsw_instance == NULL) {
-		return 0;
-	}
-
-	npmx_ldsw_mode_t mode;
-	npmx_error_t err_code = npmx_ldsw_mode_get(ldsw_instance, &mode);
-	if (!check_error_code(shell, err_code)) {
-		print_get_error(shell, "LDSW mode");
-		return 0;
+	npmx_ldsw_soft_start_config_t soft_start_config;
+	npmx_error_t err_code = npmx_ldsw_soft_start_config_get(p_instance, &soft_start_config);
+	if (err_code != NPMX_SUCCESS) {
+		return err_code;
 	}
 
-	print_value(shell, (int)mode, UNIT_TYPE_NONE);
-	return 0;
+	soft_start_config.current = (npmx_ldsw_soft_start_current_t)value;
+	return npmx_ldsw_soft_start_config_set(p_instance, &soft_start_config);
 }
 
-static int ldsw_soft_start_config_set(const struct shell *shell, size_t argc, char **argv,
-				      ldsw_soft_start_config_param_t config_type)
+static npmx_error_t ldsw_soft_start_current_get(void const *p_instance, int32_t *p_value)
 {
-	shell_arg_type_t arg_type;
-	switch (config_type) {
-	case LDSW_SOFT_START_PARAM_ENABLE:
-		arg_type = SHELL_ARG_TYPE_BOOL_VALUE;
-		break;
-	case LDSW_SOFT_START_PARAM_CURRENT:
-		arg_type = SHELL_ARG_TYPE_UINT32_VALUE;
-		break;
-	}
-
-	args_info_t args_info = { .expected_args = 2,
-				  .arg = {
-					  [0] = { SHELL_ARG_TYPE_UINT32_INDEX, "LDSW" },
-					  [1] = { arg_type, "config" },
-				  } };
-	if (!arguments_check(shell, argc, argv, &args_info)) {
-		return 0;
-	}
-
-	npmx_ldsw_t *ldsw_instance = ldsw_instance_get(shell, args_info.arg[0].result.uvalue);
-	if (ldsw_instance == NULL) {
-		return 0;
-	}
-
 	npmx_ldsw_soft_start_config_t soft_start_config;
-	npmx_error_t err_code = npmx_ldsw_soft_start_config_get(ldsw_instance, &soft_start_config);
-	if (!check_error_code(shell, err_code)) {
-		print_get_error(shell, "soft-start config");
-		return 0;
-	}
-
-	shell_arg_result_t result = args_info.arg[1].result;
-	switch (config_type) {
-	case LDSW_SOFT_START_PARAM_ENABLE:
-		soft_start_config.enable = result.bvalue;
-		break;
-	case LDSW_SOFT_START_PARAM_CURRENT:
-		soft_start_config.current = npmx_ldsw_soft_start_current_convert(result.uvalue);
-		if (soft_start_config.current == NPMX_LDSW_SOFT_START_CURRENT_INVALID) {
-			print_convert_error(shell, "milliamperes", "soft-start current");
-			return 0;
-		}
-		break;
-	}
+	npmx_error_t err_code = npmx_ldsw_soft_start_config_get(p_instance, &soft_start_config);
 
-	err_code = npmx_ldsw_soft_start_config_set(ldsw_instance, &soft_start_config);
-	if (!check_error_code(shell, err_code)) {
-		print_set_error(shell, "soft-start config");
-		return 0;
-	}
-
-	switch (config_type) {
-	case LDSW_SOFT_START_PARAM_ENABLE:
-		print_success(shell, result.bvalue, UNIT_TYPE_NONE);
-		break;
-	case LDSW_SOFT_START_PARAM_CURRENT:
-		print_success(shell, result.uvalue, UNIT_TYPE_MILLIAMPERE);
-		break;
-	}
-	return 0;
+	*p_value = (int32_t)soft_start_config.current;
+	return err_code;
 }
 
-static int ldsw_soft_start_config_get(const struct shell *shell, size_t argc, char **argv,
-				      ldsw_soft_start_config_param_t config_type)
+static npmx_error_t ldsw_soft_start_enable_set(void const *p_instance, int32_t value)
 {
-	args_info_t args_info = { .expected_args = 1,
-				  .arg = {
-					  [0] = { SHELL_ARG_TYPE_UINT32_INDEX, "LDSW" },
-				  } };
-	if (!arguments_check(shell, argc, argv, &args_info)) {
-		return 0;
-	}
-
-	npmx_ldsw_t *ldsw_instance = ldsw_instance_get(shell, args_info.arg[0].result.uvalue);
-	if (ldsw_instance == NULL) {
-		return 0;
-	}
-
 	npmx_ldsw_soft_start_config_t soft_start_config;
-	npmx_error_t err_code = npmx_ldsw_soft_start_config_get(ldsw_instance, &soft_start_config);
-	if (!check_error_code(shell, err_code)) {
-		print_get_error(shell, "soft-start config");
-		return 0;
+	npmx_error_t err_code = npmx_ldsw_soft_start_config_get(p_instance, &soft_start_config);
+	if (err_code != NPMX_SUCCESS) {
+		return err_code;
 	}
 
-	switch (config_type) {
-	case LDSW_SOFT_START_PARAM_ENABLE:
-		print_value(shell, soft_start_config.enable, UNIT_TYPE_NONE);
-		break;
-	case LDSW_SOFT_START_PARAM_CURRENT:
-		uint32_t soft_start_current_ma;
-		if (!npmx_ldsw_soft_start_current_convert_to_ma(soft_start_config.current,
-								&soft_start_current_ma)) {
-			print_convert_error(shell, "soft-start current", "milliamperes");
-			return 0;
-		}
-		print_value(shell, soft_start_current_ma, UNIT_TYPE_MILLIAMPERE);
-		break;
-	}
-	return 0;
+	soft_start_config.enable = (value != 0);
+	return npmx_ldsw_soft_start_config_set(p_instance, &soft_start_config);
 }
 
-static int cmd_ldsw_soft_start_current_set(const struct shell *shell, size_t argc, char **argv)
+static npmx_error_t ldsw_soft_start_enable_get(void const *p_instance, int32_t *p_value)
 {
-	return ldsw_soft_start_config_set(shell, argc, argv, LDSW_SOFT_START_PARAM_CURRENT);
-}
-
-static int cmd_ldsw_soft_start_current_get(const struct shell *shell, size_t argc, char **argv)
-{
-	return ldsw_soft_start_config_get(shell, argc, argv, LDSW_SOFT_START_PARAM_CURRENT);
-}
-
-static int cmd_ldsw_soft_start_enable_set(const struct shell *shell, size_t argc, char **argv)
-{
-	return ldsw_soft_start_config_set(shell, argc, argv, LDSW_SOFT_START_PARAM_ENABLE);
-}
+	npmx_ldsw_soft_start_config_t soft_start_config;
+	npmx_error_t err_code = npmx_ldsw_soft_start_config_get(p_instance, &soft_start_config);
 
-static int cmd_ldsw_soft_start_enable_get(const struct shell *shell, size_t argc, char **argv)
-{
-	return ldsw_soft_start_config_get(shell, argc, argv, LDSW_SOFT_START_PARAM_ENABLE);
+	*p_value = soft_start_config.enable ? 1 : 0;
+	return err_code;
 }
 
-static int cmd_ldsw_status_set(const struct shell *shell, size_t argc, char **argv)
+static npmx_error_t ldsw_status_set(void const *p_instance, int32_t value)
 {
-	args_info_t args_info = { .expected_args = 2,
-				  .arg = {
-					  [0] = { SHELL_ARG_TYPE_UINT32_INDEX, "LDSW" },
-					  [1] = { SHELL_ARG_TYPE_BOOL_VALUE, "status" },
-				  } };
-	if (!arguments_check(shell, argc, argv, &args_info)) {
-		return 0;
-	}
-
-	npmx_ldsw_t *ldsw_instance = ldsw_instance_get(shell, args_info.arg[0].result.uvalue);
-	if (ldsw_instance == NULL) {
-		return 0;
-	}
-
-	bool ldsw_status = args_info.arg[1].result.bvalue;
-	npmx_ldsw_task_t ldsw_task = ldsw_status ? NPMX_LDSW_TASK_ENABLE : NPMX_LDSW_TASK_DISABLE;
-	npmx_error_t err_code = npmx_ldsw_task_trigger(ldsw_instance, ldsw_task);
-	if (!check_error_code(shell, err_code)) {
-		print_set_error(shell, "LDSW status");
-		return 0;
-	}
-
-	print_success(shell, ldsw_status, UNIT_TYPE_NONE);
-	return 0;
+	return npmx_ldsw_task_trigger(p_instance,
+				      value ? NPMX_LDSW_TASK_ENABLE : NPMX_LDSW_TASK_DISABLE);
 }
 
+static const shell_enum_map_t ldsw_modes[] = {
+	{ NPMX_LDSW_MODE_LOAD_SWITCH, "LOADSW" },
+	{ NPMX_LDSW_MODE_LDO, "LDO" },
+};
+
+static const shell_param_t ldsw_active_discharge_param = {
+	SHELL_PARAM_INSTANCE("LDSW", NPM_LDSW_COUNT, ldsw_param_instance_get),
+	.name = "status",
+	.description = "LDSW active discharge status",
+	.type = SHELL_ARG_TYPE_BOOL_VALUE,
+	.unit = UNIT_TYPE_NONE,
+	.set = ldsw_active_discharge_set,
+	.get = ldsw_active_discharge_get,
+};
+
+static const shell_param_t ldsw_gpio_index_param = {
+	SHELL_PARAM_INSTANCE("LDSW", NPM_LDSW_COUNT, ldsw_param_instance_get),
+	.name = "GPIO number",
+	.description = "GPIO config",
+	.type = SHELL_ARG_TYPE_INT32_VALUE,
+	.min = -1,
+	.max = NPM_GPIOS_COUNT - 1,
+	.to_npmx = ldsw_gpio_to_npmx,
+	.from_npmx = ldsw_gpio_from_npmx,
+	.check = shell_param_pin_value_check,
+	.unit = UNIT_TYPE_NONE,
+	.set = ldsw_gpio_index_set,
+	.get = ldsw_gpio_index_get,
+};
+
+static const shell_param_t ldsw_gpio_polarity_param = {
+	SHELL_PARAM_INSTANCE("LDSW", NPM_LDSW_COUNT, ldsw_param_instance_get),
+	.name = "GPIO polarity",
+	.description = "GPIO config",
+	.type = SHELL_ARG_TYPE_BOOL_VALUE,
+	.unit = UNIT_TYPE_NONE,
+	.set = ldsw_gpio_polarity_set,
+	.get = ldsw_gpio_polarity_get,
+};
+
+static const shell_param_t ldsw_ldo_voltage_param = {
+	SHELL_PARAM_INSTANCE("LDSW", NPM_LDSW_COUNT, ldsw_param_instance_get),
+	.name = "voltage",
+	.description = "LDSW voltage",
+	.type = SHELL_ARG_TYPE_UINT32_VALUE,
+	.to_npmx = ldsw_voltage_to_npmx,
+	.from_npmx = ldsw_voltage_from_npmx,
+	.unit = UNIT_TYPE_MILLIVOLT,
+	.set = ldsw_ldo_voltage_set,
+	.get = ldsw_ldo_voltage_get,
+};
+
+static const shell_param_t ldsw_mode_param = {
+	SHELL_PARAM_INSTANCE("LDSW", NPM_LDSW_COUNT, ldsw_param_instance_get),
+	.name = "mode",
+	.description = "LDSW mode",
+	.type = SHELL_ARG_TYPE_UINT32_VALUE,
+	SHELL_PARAM_MAP(ldsw_modes),
+	.unit = UNIT_TYPE_NONE,
+	.set = ldsw_mode_set,
+	.get = ldsw_mode_get,
+};
+
+static const shell_param_t ldsw_soft_start_current_param = {
+	SHELL_PARAM_INSTANCE("LDSW", NPM_LDSW_COUNT, ldsw_param_instance_get),
+	.name = "config",
+	.description = "soft-start current",
+	.type = SHELL_ARG_TYPE_UINT32_VALUE,
+	.to_npmx = ldsw_soft_start_current_to_npmx,
+	.from_npmx = ldsw_soft_start_current_from_npmx,
+	.unit = UNIT_TYPE_MILLIAMPERE,
+	.set = ldsw_soft_start_current_set,
+	.get = ldsw_soft_start_current_get,
+};
+
+static const shell_param_t ldsw_soft_start_enable_param = {
+	SHELL_PARAM_INSTANCE("LDSW", NPM_LDSW_COUNT, ldsw_param_instance_get),
+	.name = "config",
+	.description = "soft-start config",
+	.type = SHELL_ARG_TYPE_BOOL_VALUE,
+	.unit = UNIT_TYPE_NONE,
+	.set = ldsw_soft_start_enable_set,
+	.get = ldsw_soft_start_enable_get,
+};
+
+static const shell_param_t ldsw_status_param = {
+	SHELL_PARAM_INSTANCE("LDSW", NPM_LDSW_COUNT, ldsw_param_instance_get),
+	.name = "status",
+	.description = "LDSW status",
+	.type = SHELL_ARG_TYPE_BOOL_VALUE,
+	.unit = UNIT_TYPE_NONE,
+	.set = ldsw_status_set,
+};
+
+SHELL_PARAM_CMD_SET(cmd_ldsw_active_discharge_set, ldsw_active_discharge_param)
+SHELL_PARAM_CMD_GET(cmd_ldsw_active_discharge_get, ldsw_active_discharge_param)
+SHELL_PARAM_CMD_SET(cmd_ldsw_gpio_index_set, ldsw_gpio_index_param)
+SHELL_PARAM_CMD_GET(cmd_ldsw_gpio_index_get, ldsw_gpio_index_param)
+SHELL_PARAM_CMD_SET(cmd_ldsw_gpio_polarity_set, ldsw_gpio_polarity_param)
+SHELL_PARAM_CMD_GET(cmd_ldsw_gpio_polarity_get, ldsw_gpio_polarity_param)
+SHELL_PARAM_CMD_SET(cmd_ldsw_ldo_voltage_set, ldsw_ldo_voltage_param)
+SHELL_PARAM_CMD_GET(cmd_ldsw_ldo_voltage_get, ldsw_ldo_voltage_param)
+SHELL_PARAM_CMD_SET(cmd_ldsw_mode_set, ldsw_mode_param)
+SHELL_PARAM_CMD_GET(cmd_ldsw_mode_get, ldsw_mode_param)
+SHELL_PARAM_CMD_SET(cmd_ldsw_soft_start_current_set, ldsw_soft_start_current_param)
+SHELL_PARAM_CMD_GET(cmd_ldsw_soft_start_current_get, ldsw_soft_start_current_param)
+SHELL_PARAM_CMD_SET(cmd_ldsw_soft_start_enable_set, ldsw_soft_start_enable_param)
+SHELL_PARAM_CMD_GET(cmd_ldsw_soft_start_enable_get, ldsw_soft_start_enable_param)
+SHELL_PARAM_CMD_SET(cmd_ldsw_status_set, ldsw_status_param)
+
+/* The status mask holds the power-up status of both load switches. */
 static int cmd_ldsw_status_get(const struct shell *shell, size_t argc, char **argv)
 {
 	args_info_t args_info = { .expected_args = 1,
@@ -4,120 +4,121 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
-#include "shell_common.h"
+#include "shell_table.h"
 #include <npmx_driver.h>
 
-static npmx_led_t *led_instance_get(const struct shell *shell, uint32_t index)
+SHELL_PARAM_INSTANCE_GETTER(led_instance_get, npmx_led_get)
+SHELL_PARAM_SETTER(led_mode_set, npmx_led_t, npmx_led_mode_t, npmx_led_mode_set)
+SHELL_PARAM_GETTER(led_mode_get, npmx_led_t, npmx_led_mode_t, npmx_led_mode_get)
+SHELL_PARAM_SETTER(led_state_set, npmx_led_t, bool, npmx_led_state_set)
+
+static const shell_enum_map_t led_modes[] = {
+	{ NPMX_LED_MODE_ERROR, "Charger error" },
+	{ NPMX_LED_MODE_CHARGING, "Charging" },
+	{ NPMX_LED_MODE_HOST, "Host" },
+	{ NPMX_LED_MODE_NOTUSED, "Not used" },
+};
+
+static const shell_param_t led_mode_param = {
+	SHELL_PARAM_INSTANCE("LED", NPM_LEDDRV_COUNT, led_instance_get),
+	.name = "mode",
+	.description = "LED mode",
+	.type = SHELL_ARG_TYPE_UINT32_VALUE,
+	SHELL_PARAM_MAP(led_modes),
+	.unit = UNIT_TYPE_NONE,
+	.set = led_mode_set,
+	.get = led_mode_get,
+};
+
+static const shell_param_t led_state_param = {
+	SHELL_PARAM_INSTANCE("LED", NPM_LEDDRV_COUNT, led_instance_get),
+	.name = "state",
+	.description = "LED state",
+	.type = SHELL_ARG_TYPE_BOOL_VALUE,
+	.unit = UNIT_TYPE_NONE,
+	.set = led_state_set,
+};
+
+SHELL_PARAM_CMD_SET(cmd_led_mode_set, led_mode_param)
+SHELL_PARAM_CMD_GET(cmd_led_mode_get, led_mode_param)
+SHELL_PARAM_CMD_SET(cmd_led_state_set, led_state_param)
+
+#if defined(CONFIG_NPMX_LED_PATTERN)
+static int cmd_led_pattern_blink(const struct shell *shell, size_t argc, char **argv)
 {
-	npmx_instance_t *npmx_instance = npmx_instance_get(shell);
-	bool status = check_instance_index(shell, "LED", index, NPM_LEDDRV_COUNT);
-
-	return (npmx_instance && status) ? npmx_led_get(npmx_instance, (uint8_t)index) : NULL;
-}
-
-static int cmd_led_mode_set(const struct shell *shell, size_t argc, char **argv)
-{
-	args_info_t args_info = { .expected_args = 2,
-				  .arg = {
-					  [0] = { SHELL_ARG_TYPE_UINT32_INDEX, "LED" },
-					  [1] = { SHELL_ARG_TYPE_UINT32_VALUE, "mode" },
-				  } };
-	if (!arguments_check(shell, argc, argv, &args_info)) {
-		return 0;
-	}
-
-	npmx_led_t *led_instance = led_instance_get(shell, args_info.arg[0].result.uvalue);
-	if (led_instance == NULL) {
-		return 0;
-	}
-
-	uint32_t mode = args_info.arg[1].result.uvalue;
-	npmx_led_mode_t led_mode;
-	switch (mode) {
-	case 0:
-		led_mode = NPMX_LED_MODE_ERROR;
-		break;
-	case 1:
-		led_mode = NPMX_LED_MODE_CHARGING;
-		break;
-	case 2:
-		led_mode = NPMX_LED_MODE_HOST;
-		break;
-	case 3:
-		led_mode = NPMX_LED_MODE_NOTUSED;
-		break;
-	default:
-		shell_error(shell, "Error: Wrong mode:");
-		print_hint_error(shell, 0, "Charger error");
-		print_hint_error(shell, 1, "Charging");
-		print_hint_error(shell, 2, "Host");
-		print_hint_error(shell, 3, "Not used");
-		return 0;
-	}
-
-	npmx_error_t err_code = npmx_led_mode_set(led_instance, led_mode);
-	if (!check_error_code(shell, err_code)) {
-		print_set_error(shell, "LED mode");
-		return 0;
-	}
-
-	print_success(shell, mode, UNIT_TYPE_NONE);
-	return 0;
-}
-
-static int cmd_led_mode_get(const struct shell *shell, size_t argc, char **argv)
-{
-	args_info_t args_info = { .expected_args = 1,
-				  .arg = {
-					  [0] = { SHELL_ARG_TYPE_UINT32_INDEX, "LED" },
-				  } };
+	args_info_t args_info = {
+		.expected_args = 3,
+		.arg = {
+			[0] = { SHELL_ARG_TYPE_UINT32_INDEX, "LED" },
+			[1] = { SHELL_ARG_TYPE_UINT32_VALUE, "on time" },
+			[2] = { SHELL_ARG_TYPE_UINT32_VALUE, "off time" },
+		},
+	};
 	if (!arguments_check(shell, argc, argv, &args_info)) {
 		return 0;
 	}
 
-	npmx_led_t *led_instance = led_instance_get(shell, args_info.arg[0].result.uvalue);
-	if (led_instance == NULL) {
+	uint32_t index = args_info.arg[0].result.uvalue;
+	if (!check_instance_index(shell, "LED", index, NPM_LEDDRV_COUNT)) {
 		return 0;
 	}
 
-	npmx_led_mode_t mode;
-	npmx_error_t err_code = npmx_led_mode_get(led_instance, &mode);
-	if (!check_error_code(shell, err_code)) {
-		print_get_error(shell, "LED mode");
+	/* Steps are copied by the driver. */
+	const struct npmx_driver_led_step steps[] = {
+		{ .on = true, .duration_ms = MIN(args_info.arg[1].result.uvalue, UINT16_MAX) },
+		{ .on = false, .duration_ms = MIN(args_info.arg[2].result.uvalue, UINT16_MAX) },
+	};
+	const struct npmx_driver_led_pattern pattern = {
+		.p_steps = steps,
+		.step_count = ARRAY_SIZE(steps),
+	};
+
+	if (npmx_driver_led_pattern_start(pmic_dev_get(), (uint8_t)index, &pattern) != 0) {
+		print_set_error(shell, "LED pattern");
 		return 0;
 	}
 
-	print_value(shell, (int)mode, UNIT_TYPE_NONE);
+	shell_print(shell, "Success: pattern started.");
 	return 0;
 }
 
-static int cmd_led_state_set(const struct shell *shell, size_t argc, char **argv)
+static int cmd_led_pattern_stop(const struct shell *shell, size_t argc, char **argv)
 {
-	args_info_t args_info = { .expected_args = 2,
-				  .arg = {
-					  [0] = { SHELL_ARG_TYPE_UINT32_INDEX, "LED" },
-					  [1] = { SHELL_ARG_TYPE_BOOL_VALUE, "state" },
-				  } };
+	args_info_t args_info = {
+		.expected_args = 2,
+		.arg = {
+			[0] = { SHELL_ARG_TYPE_UINT32_INDEX, "LED" },
+			[1] = { SHELL_ARG_TYPE_BOOL_VALUE, "state" },
+		},
+	};
 	if (!arguments_check(shell, argc, argv, &args_info)) {
 		return 0;
 	}
 
-	npmx_led_t *led_instance = led_instance_get(shell, args_info.arg[0].result.uvalue);
-	if (led_instance == NULL) {
+	uint32_t index = args_info.arg[0].result.uvalue;
+	if (!check_instance_index(shell, "LED", index, NPM_LEDDRV_COUNT)) {
 		return 0;
 	}
 
-	bool led_state = args_info.arg[1].result.bvalue;
-	npmx_error_t err_code = npmx_led_state_set(led_instance, led_state);
-	if (!check_error_code(shell, err_code)) {
+	bool on = args_info.arg[1].result.bvalue;
+	if (npmx_driver_led_pattern_stop(pmic_dev_get(), (uint8_t)index, on) != 0) {
 		print_set_error(shell, "LED state");
 		return 0;
 	}
 
-	print_success(shell, led_state, UNIT_TYPE_NONE);
+	print_success(shell, on, UNIT_TYPE_NONE);
 	return 0;
 }
 
+/* Creating subcommands (level 3 command) array for command "led pattern". */
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_led_pattern,
+			       SHELL_CMD(blink, NULL, "Blink LED <index> <on ms> <off ms>",
+					 cmd_led_pattern_blink),
+			       SHELL_CMD(stop, NULL, "Stop LED pattern <index> <on|off>",
+					 cmd_led_pattern_stop),
+			       SHELL_SUBCMD_SET_END);
+#endif
+
 /* Creating subcommands (level 3 command) array for command "led mode". */
 SHELL_STATIC_SUBCMD_SET_CREATE(sub_led_mode, SHELL_CMD(set, NULL, "Set LED mode", cmd_led_mode_set),
 			       SHELL_CMD(get, NULL, "Get LED mode", cmd_led_mode_get),
@@ -129,8 +130,15 @@ SHELL_STATIC_SUBCMD_SET_CREATE(sub_led_state,
 			       SHELL_SUBCMD_SET_END);
 
 /* Creating subcommands (level 2 command) array for command "led". */
+#if defined(CONFIG_NPMX_LED_PATTERN)
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_led, SHELL_CMD(mode, &sub_led_mode, "LED mode", NULL),
+			       SHELL_CMD(state, &sub_led_state, "LED state", NULL),
+			       SHELL_CMD(pattern, &sub_led_pattern, "LED pattern", NULL),
+			       SHELL_SUBCMD_SET_END);
+#else
 SHELL_STATIC_SUBCMD_SET_CREATE(sub_led, SHELL_CMD(mode, &sub_led_mode, "LED mode", NULL),
 			       SHELL_CMD(state, &sub_led_state, "LED state", NULL),
 			       SHELL_SUBCMD_SET_END);
+#endif
 
 SHELL_SUBCMD_ADD((npmx), led, &sub_led, "LED", NULL, 1, 0);
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "shell_common.h"
+#include <npmx_driver.h>
+
+#include <stdio.h>
+
+static void print_usage(const struct shell *shell, const char *name,
+			struct npmx_driver_power_usage const *usage)
+{
+	/* Charge in microcoulombs per millisecond is the current in milliamperes. */
+	long long avg_ua = (usage->time_ms > 0) ? ((usage->charge_uc * 1000) / usage->time_ms) : 0;
+
+	shell_print(shell, "%-8s %12lld %10lld %10lld", name, (long long)(usage->charge_uc / 3600),
+		    (long long)(usage->time_ms / 1000), avg_ua);
+}
+
+static int cmd_power_get(const struct shell *shell, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	struct npmx_driver_power_account account;
+	char name[10];
+
+	if (npmx_driver_power_account_get(pmic_dev_get(), &account) != 0) {
+		print_get_error(shell, "power account");
+		return 0;
+	}
+
+	shell_print(shell, "Samples: %u, power state: %u", account.samples, account.state);
+	shell_print(shell, "Charged: %lld uAh, not attributed: %lld s",
+		    (long long)(account.charged_uc / 3600),
+		    (long long)(account.unattributed_ms / 1000));
+
+	shell_print(shell, "%-8s %12s %10s %10s", "Usage", "Charge [uAh]", "Time [s]", "Avg [uA]");
+	print_usage(shell, "Battery", &account.battery);
+
+	for (uint8_t i = 0; i < NPM_BUCK_COUNT; i++) {
+		snprintf(name, sizeof(name), "buck %u", i);
+		print_usage(shell, name, &account.rails[NPMX_DRIVER_POWER_RAIL_BUCK(i)]);
+	}
+
+	for (uint8_t i = 0; i < NPM_LDSW_COUNT; i++) {
+		snprintf(name, sizeof(name), "ldsw %u", i);
+		print_usage(shell, name, &account.rails[NPMX_DRIVER_POWER_RAIL_LDSW(i)]);
+	}
+
+	for (uint8_t i = 0; i < NPMX_DRIVER_POWER_STATE_COUNT; i++) {
+		snprintf(name, sizeof(name), "state %u", i);
+		print_usage(shell, name, &account.states[i]);
+	}
+
+	return 0;
+}
+
+static int cmd_power_state(const struct shell *shell, size_t argc, char **argv)
+{
+	args_info_t args_info = {
+		.expected_args = 1,
+		.arg = {
+			[0] = { SHELL_ARG_TYPE_UINT32_VALUE, "power state" },
+		},
+	};
+	if (!arguments_check(shell, argc, argv, &args_info)) {
+		return 0;
+	}
+
+	uint32_t state = args_info.arg[0].result.uvalue;
+
+	if ((state > UINT8_MAX) ||
+	    (npmx_driver_power_state_set(pmic_dev_get(), (uint8_t)state) == -EINVAL)) {
+		shell_error(shell, "Error: power state has to be lower than %u.",
+			    NPMX_DRIVER_POWER_STATE_COUNT);
+		return 0;
+	}
+
+	print_success(shell, (int)state, UNIT_TYPE_NONE);
+	return 0;
+}
+
+static int cmd_power_reset(const struct shell *shell, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	(void)npmx_driver_power_account_reset(pmic_dev_get());
+
+	shell_print(shell, "Success: power account cleared.");
+	return 0;
+}
+
+/* Creating subcommands (level 2 command) array for command "power". */
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_power,
+			       SHELL_CMD(get, NULL, "Get battery charge per output and power state",
+					 cmd_power_get),
+			       SHELL_CMD_ARG(state, NULL, "Set application power state <state>",
+					     cmd_power_state, 2, 0),
+			       SHELL_CMD(reset, NULL, "Clear power account", cmd_power_reset),
+			       SHELL_SUBCMD_SET_END);
+
+SHELL_SUBCMD_ADD((npmx), power, &sub_power, "Power budget accounting", NULL, 1, 0);
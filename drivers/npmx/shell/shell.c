@@ -7,14 +7,12 @@
 #include "shell_common.h"
 #include <npmx_driver.h>
 
-static const struct device *pmic_dev = DEVICE_DT_GET(DT_NODELABEL(npm_0));
-
 static int cmd_reset(const struct shell *shell, size_t argc, char **argv)
 {
 	ARG_UNUSED(argc);
 	ARG_UNUSED(argv);
 
-	npmx_instance_t *npmx_instance = npmx_driver_instance_get(pmic_dev);
+	npmx_instance_t *npmx_instance = npmx_instance_get(shell);
 	if (npmx_instance == NULL) {
 		return 0;
 	}
@@ -25,12 +23,32 @@ static int cmd_reset(const struct shell *shell, size_t argc, char **argv)
 		return 0;
 	}
 
+	/* All registers are restored to their default values. */
+	npmx_driver_cache_invalidate(pmic_dev_get());
+
 	shell_print(shell, "Success: resetting.");
 	return 0;
 }
 
+static int cmd_select(const struct shell *shell, size_t argc, char **argv)
+{
+	if (argc < 2) {
+		pmic_devs_print(shell);
+		return 0;
+	}
+
+	if (pmic_dev_select(shell, argv[1])) {
+		shell_print(shell, "Success: %s selected.", argv[1]);
+	}
+
+	return 0;
+}
+
 SHELL_SUBCMD_ADD((npmx), reset, NULL, "Reset device", cmd_reset, 1, 0);
 
+SHELL_SUBCMD_ADD((npmx), select, NULL, "Select device used by commands or list devices",
+		 cmd_select, 1, 1);
+
 /* Creating subcommands (level 1 command) array for command "npmx". */
 SHELL_SUBCMD_SET_CREATE(sub_npmx, (npmx));
 
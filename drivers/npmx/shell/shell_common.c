@@ -7,8 +7,18 @@
 #include "shell_common.h"
 #include <zephyr/kernel.h>
 #include <npmx_driver.h>
+#include <string.h>
 
-static const struct device *pmic_dev = DEVICE_DT_GET(DT_NODELABEL(npm_0));
+#define PMIC_DEV_GET(node_id) DEVICE_DT_GET(node_id),
+
+/* All nPM devices available to the shell. */
+static const struct device *const pmic_devs[] = { DT_FOREACH_STATUS_OKAY(nordic_npmx_npm1300,
+									  PMIC_DEV_GET) };
+
+BUILD_ASSERT(ARRAY_SIZE(pmic_devs) > 0, "No nPM device enabled");
+
+/* Index of the nPM device used by shell commands. */
+static size_t pmic_dev_idx;
 
 static const char *unit_str_get(unit_type_t unit_type)
 {
@@ -189,9 +199,39 @@ bool check_instance_index(const struct shell *shell, const char *instance_name,
 	return true;
 }
 
+const struct device *pmic_dev_get(void)
+{
+	return pmic_devs[pmic_dev_idx];
+}
+
+bool pmic_dev_select(const struct shell *shell, const char *name)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(pmic_devs); i++) {
+		if (strcmp(pmic_devs[i]->name, name) == 0) {
+			if (!device_is_ready(pmic_devs[i])) {
+				shell_error(shell, "Error: device %s is not ready.", name);
+				return false;
+			}
+
+			pmic_dev_idx = i;
+			return true;
+		}
+	}
+
+	shell_error(shell, "Error: no such device.");
+	return false;
+}
+
+void pmic_devs_print(const struct shell *shell)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(pmic_devs); i++) {
+		shell_print(shell, "%c %s", (i == pmic_dev_idx) ? '*' : ' ', pmic_devs[i]->name);
+	}
+}
+
 npmx_instance_t *npmx_instance_get(const struct shell *shell)
 {
-	npmx_instance_t *npmx_instance = npmx_driver_instance_get(pmic_dev);
+	npmx_instance_t *npmx_instance = npmx_driver_instance_get(pmic_dev_get());
 	if (npmx_instance == NULL) {
 		shell_error(shell, "Error: shell is not initialized.");
 		return NULL;
@@ -213,8 +253,8 @@ bool range_check(const struct shell *shell, int32_t value, int32_t min, int32_t
 
 bool check_pin_configuration_correctness(const struct shell *shell, int32_t gpio_idx)
 {
-	int32_t pmic_int_pin = npmx_driver_int_pin_get(pmic_dev);
-	int32_t pmic_pof_pin = npmx_driver_pof_pin_get(pmic_dev);
+	int32_t pmic_int_pin = npmx_driver_int_pin_get(pmic_dev_get());
+	int32_t pmic_pof_pin = npmx_driver_pof_pin_get(pmic_dev_get());
 
 	if ((pmic_int_pin != -1) && (pmic_int_pin == gpio_idx)) {
 		shell_error(shell, "Error: GPIO used as interrupt.");
@@ -229,7 +269,7 @@ bool check_pin_configuration_correctness(const struct shell *shell, int32_t gpio
 	return true;
 }
 
-bool charger_disabled_check(const struct shell *shell, npmx_charger_t *charger_instance,
+bool charger_disabled_check(const struct shell *shell, npmx_charger_t const *charger_instance,
 			    const char *help)
 {
 	uint32_t modules_mask;
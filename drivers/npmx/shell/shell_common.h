@@ -88,9 +88,34 @@ bool range_check(const struct shell *shell, int32_t value, int32_t min, int32_t
 
 bool check_pin_configuration_correctness(const struct shell *shell, int32_t gpio_index);
 
-bool charger_disabled_check(const struct shell *shell, npmx_charger_t *charger_instance,
+bool charger_disabled_check(const struct shell *shell, npmx_charger_t const *charger_instance,
 			    const char *help);
 
+/**
+ * @brief Function for getting the nPM device used by shell commands.
+ *
+ * @return Pointer to the selected nPM Zephyr device.
+ */
+const struct device *pmic_dev_get(void);
+
+/**
+ * @brief Function for selecting the nPM device used by shell commands.
+ *
+ * @param[in] shell Shell instance.
+ * @param[in] name  Name of the nPM Zephyr device.
+ *
+ * @retval true  Device selected.
+ * @retval false No ready nPM device with such name.
+ */
+bool pmic_dev_select(const struct shell *shell, const char *name);
+
+/**
+ * @brief Function for printing names of all nPM devices, with the selected one marked.
+ *
+ * @param[in] shell Shell instance.
+ */
+void pmic_devs_print(const struct shell *shell);
+
 npmx_instance_t *npmx_instance_get(const struct shell *shell);
 
 bool check_instance_index(const struct shell *shell, const char *instance_name, uint32_t index,
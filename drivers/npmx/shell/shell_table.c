@@ -0,0 +1,236 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "shell_table.h"
+
+static void const *param_instance_get(const struct shell *shell, shell_param_t const *p_param,
+				      uint32_t index)
+{
+	npmx_instance_t *npmx_instance = npmx_instance_get(shell);
+	bool status = (p_param->instance_count == 0) ||
+		      check_instance_index(shell, p_param->peripheral, index,
+					   p_param->instance_count);
+
+	return (npmx_instance && status) ? p_param->instance_get(npmx_instance, (uint8_t)index) :
+					   NULL;
+}
+
+static int32_t arg_value_get(shell_arg_t const *p_arg)
+{
+	switch (p_arg->type) {
+	case SHELL_ARG_TYPE_BOOL_VALUE:
+		return p_arg->result.bvalue ? 1 : 0;
+	case SHELL_ARG_TYPE_INT32_VALUE:
+		return p_arg->result.ivalue;
+	default:
+		return (int32_t)p_arg->result.uvalue;
+	}
+}
+
+/* Name of the values in the unit, used in conversion error messages. */
+static const char *unit_name_get(shell_param_t const *p_param)
+{
+	switch (p_param->unit) {
+	case UNIT_TYPE_MILLIAMPERE:
+		return "milliamperes";
+	case UNIT_TYPE_MILLIVOLT:
+		return "millivolts";
+	case UNIT_TYPE_CELSIUS:
+		return "degrees";
+	case UNIT_TYPE_OHM:
+		return "resistance";
+	case UNIT_TYPE_PCT:
+		return "pct";
+	default:
+		return p_param->name;
+	}
+}
+
+/**
+ * @brief Function for converting the shell value to the value passed to the npmx setter.
+ *
+ * @retval true  Value converted.
+ * @retval false Value out of range, error printed.
+ */
+static bool param_value_convert(const struct shell *shell, shell_param_t const *p_param,
+				int32_t value, int32_t *p_npmx_value)
+{
+	if (p_param->p_map != NULL) {
+		if ((value < 0) || (value >= p_param->map_size)) {
+			shell_error(shell, "Error: Wrong %s:", p_param->name);
+			for (uint8_t i = 0; i < p_param->map_size; i++) {
+				print_hint_error(shell, i, p_param->p_map[i].name);
+			}
+			return false;
+		}
+
+		*p_npmx_value = p_param->p_map[value].npmx_value;
+		return true;
+	}
+
+	if ((p_param->min < p_param->max) &&
+	    !range_check(shell, value, p_param->min, p_param->max, p_param->name)) {
+		return false;
+	}
+
+	if (p_param->to_npmx != NULL) {
+		if (!p_param->to_npmx(value, p_npmx_value)) {
+			print_convert_error(shell, unit_name_get(p_param), p_param->description);
+			return false;
+		}
+		return true;
+	}
+
+	*p_npmx_value = value;
+	return true;
+}
+
+/**
+ * @brief Function for converting the value returned by the npmx getter to the shell value.
+ *
+ * @retval true  Value converted.
+ * @retval false Value cannot be converted, error printed.
+ */
+static bool param_value_from_npmx(const struct shell *shell, shell_param_t const *p_param,
+				  int32_t npmx_value, int32_t *p_value)
+{
+	for (uint8_t i = 0; (p_param->p_map != NULL) && (i < p_param->map_size); i++) {
+		if (p_param->p_map[i].npmx_value == npmx_value) {
+			*p_value = i;
+			return true;
+		}
+	}
+
+	if (p_param->from_npmx != NULL) {
+		if (!p_param->from_npmx(npmx_value, p_value)) {
+			print_convert_error(shell, p_param->description, unit_name_get(p_param));
+			return false;
+		}
+		return true;
+	}
+
+	*p_value = npmx_value;
+	return true;
+}
+
+/**
+ * @brief Function for reading the parameter value and converting it to the shell value.
+ *
+ * @retval true  Value read.
+ * @retval false Reading failed, error printed.
+ */
+static bool param_read(const struct shell *shell, shell_param_t const *p_param,
+		       void const *p_instance, int32_t *p_value)
+{
+	int32_t npmx_value;
+	npmx_error_t err_code = p_param->get(p_instance, &npmx_value);
+	if (!check_error_code(shell, err_code)) {
+		print_get_error(shell, p_param->description);
+		return false;
+	}
+
+	return param_value_from_npmx(shell, p_param, npmx_value, p_value);
+}
+
+int shell_param_set(const struct shell *shell, size_t argc, char **argv,
+		    shell_param_t const *p_param)
+{
+	bool indexed = (p_param->instance_count > 0);
+	args_info_t args_info = {
+		.expected_args = indexed ? 2 : 1,
+		.arg = {
+			[0] = { indexed ? SHELL_ARG_TYPE_UINT32_INDEX : p_param->type,
+				indexed ? p_param->peripheral : p_param->name },
+			[1] = { p_param->type, p_param->name },
+		},
+	};
+	if (!arguments_check(shell, argc, argv, &args_info)) {
+		return 0;
+	}
+
+	uint32_t index = indexed ? args_info.arg[0].result.uvalue : 0;
+	void const *p_instance = param_instance_get(shell, p_param, index);
+	if (p_instance == NULL) {
+		return 0;
+	}
+
+	int32_t value = arg_value_get(&args_info.arg[indexed ? 1 : 0]);
+	int32_t npmx_value;
+	if (!param_value_convert(shell, p_param, value, &npmx_value)) {
+		return 0;
+	}
+
+	if ((p_param->check != NULL) && !p_param->check(shell, p_param, p_instance, index, value)) {
+		return 0;
+	}
+
+	npmx_error_t err_code = p_param->set(p_instance, npmx_value);
+	if (!check_error_code(shell, err_code)) {
+		print_set_error(shell, p_param->description);
+		return 0;
+	}
+
+	if (p_param->readback) {
+		int32_t value_actual;
+		if (!param_read(shell, p_param, p_instance, &value_actual)) {
+			return 0;
+		}
+
+		value_difference_info(shell, p_param->type, (uint32_t)value,
+				      (uint32_t)value_actual);
+		value = value_actual;
+	}
+
+	print_success(shell, value, p_param->unit);
+	return 0;
+}
+
+int shell_param_get(const struct shell *shell, size_t argc, char **argv,
+		    shell_param_t const *p_param)
+{
+	bool indexed = (p_param->instance_count > 0);
+	args_info_t args_info = {
+		.expected_args = indexed ? 1 : 0,
+		.arg = {
+			[0] = { SHELL_ARG_TYPE_UINT32_INDEX, p_param->peripheral },
+		},
+	};
+	if (!arguments_check(shell, argc, argv, &args_info)) {
+		return 0;
+	}
+
+	uint32_t index = indexed ? args_info.arg[0].result.uvalue : 0;
+	void const *p_instance = param_instance_get(shell, p_param, index);
+	if (p_instance == NULL) {
+		return 0;
+	}
+
+	int32_t value;
+	if (param_read(shell, p_param, p_instance, &value)) {
+		print_value(shell, value, p_param->unit);
+	}
+	return 0;
+}
+
+bool shell_param_pin_value_check(const struct shell *shell, shell_param_t const *p_param,
+				 void const *p_instance, uint32_t index, int32_t value)
+{
+	ARG_UNUSED(p_param);
+	ARG_UNUSED(p_instance);
+	ARG_UNUSED(index);
+
+	return check_pin_configuration_correctness(shell, value);
+}
+
+bool shell_param_pin_instance_check(const struct shell *shell, shell_param_t const *p_param,
+				    void const *p_instance, uint32_t index, int32_t value)
+{
+	ARG_UNUSED(p_param);
+	ARG_UNUSED(p_instance);
+	ARG_UNUSED(value);
+
+	return check_pin_configuration_correctness(shell, (int32_t)index);
+}
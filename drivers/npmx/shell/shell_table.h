@@ -0,0 +1,241 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef ZEPHYR_DRIVERS_SHELL_TABLE_H__
+#define ZEPHYR_DRIVERS_SHELL_TABLE_H__
+
+#include "shell_common.h"
+
+/** @brief Mapping of a shell value, equal to the map index, to an npmx enumerator. */
+typedef struct {
+	int npmx_value; /* npmx enumerator. */
+	const char *name; /* Description printed in hints. */
+} shell_enum_map_t;
+
+typedef struct shell_param shell_param_t;
+
+/** @brief Function for getting the peripheral instance with the given index. */
+typedef void const *(*shell_param_instance_get_t)(npmx_instance_t *p_pm, uint8_t index);
+
+/** @brief Function for setting the parameter value of the peripheral instance. */
+typedef npmx_error_t (*shell_param_set_t)(void const *p_instance, int32_t value);
+
+/** @brief Function for getting the parameter value of the peripheral instance. */
+typedef npmx_error_t (*shell_param_get_t)(void const *p_instance, int32_t *p_value);
+
+/** @brief Function for converting the shell value to the npmx value, or the other way round. */
+typedef bool (*shell_param_convert_t)(int32_t value, int32_t *p_converted);
+
+/** @brief Function for checking if the parameter can be set, printing the error if not. */
+typedef bool (*shell_param_check_t)(const struct shell *shell, shell_param_t const *p_param,
+				    void const *p_instance, uint32_t index, int32_t value);
+
+/** @brief Descriptor of a peripheral parameter accessed with "set" and "get" shell commands. */
+struct shell_param {
+	const char *peripheral; /* Peripheral name used in messages about the instance index. */
+	uint8_t instance_count; /* Number of instances, 0 for a single one without an index. */
+	shell_param_instance_get_t instance_get; /* Instance getter. */
+	const char *name; /* Argument name used in messages about the value. */
+	const char *description; /* Parameter description used in set and get error messages. */
+	shell_arg_type_t type; /* Type of the value argument. */
+	int32_t min; /* Minimum value, checked only if lower than the maximum value. */
+	int32_t max; /* Maximum value. */
+	const shell_enum_map_t *p_map; /* Map of shell values to npmx enumerators, or NULL. */
+	uint8_t map_size; /* Number of map entries. */
+	shell_param_convert_t to_npmx; /* Converter of values in the unit, or NULL. */
+	shell_param_convert_t from_npmx; /* Converter of values to the unit, or NULL. */
+	shell_param_check_t check; /* Check done before setting, or NULL. */
+	bool readback; /* Value read back after setting, so approximations are reported. */
+	unit_type_t unit; /* Unit of the value. */
+	shell_param_set_t set; /* Setter, NULL if the parameter is read-only. */
+	shell_param_get_t get; /* Getter, NULL if the parameter is write-only. */
+};
+
+/**
+ * @brief Macro for initializing the peripheral fields of a descriptor.
+ *
+ * @param _peripheral Peripheral name.
+ * @param _count      Number of peripheral instances, 0 for a single one without index argument.
+ * @param _getter     Instance getter defined with @ref SHELL_PARAM_INSTANCE_GETTER.
+ */
+#define SHELL_PARAM_INSTANCE(_peripheral, _count, _getter)                                         \
+	.peripheral = (_peripheral), .instance_count = (_count), .instance_get = (_getter)
+
+/**
+ * @brief Macro for defining the peripheral instance getter used in descriptors.
+ *
+ * @param _name   Name of the defined function.
+ * @param _getter npmx instance getter, for example npmx_led_get.
+ */
+#define SHELL_PARAM_INSTANCE_GETTER(_name, _getter)                                                \
+	static void const *_name(npmx_instance_t *p_pm, uint8_t index)                             \
+	{                                                                                          \
+		return _getter(p_pm, index);                                                       \
+	}
+
+/**
+ * @brief Macro for defining the setter used in descriptors, wrapping an npmx setter.
+ *
+ * @param _name          Name of the defined function.
+ * @param _instance_type npmx peripheral instance type.
+ * @param _value_type    npmx value type.
+ * @param _setter        npmx setter.
+ */
+#define SHELL_PARAM_SETTER(_name, _instance_type, _value_type, _setter)                            \
+	static npmx_error_t _name(void const *p_instance, int32_t value)                           \
+	{                                                                                          \
+		return _setter((_instance_type const *)p_instance, (_value_type)value);            \
+	}
+
+/**
+ * @brief Macro for defining the getter used in descriptors, wrapping an npmx getter.
+ *
+ * @param _name          Name of the defined function.
+ * @param _instance_type npmx peripheral instance type.
+ * @param _value_type    npmx value type.
+ * @param _getter        npmx getter.
+ */
+#define SHELL_PARAM_GETTER(_name, _instance_type, _value_type, _getter)                            \
+	static npmx_error_t _name(void const *p_instance, int32_t *p_value)                        \
+	{                                                                                          \
+		_value_type value;                                                                 \
+		npmx_error_t err_code = _getter((_instance_type const *)p_instance, &value);       \
+		*p_value = (int32_t)value;                                                         \
+		return err_code;                                                                   \
+	}
+
+/**
+ * @brief Macro for defining the converter used in descriptors, wrapping an npmx converter from
+ *        values in the unit to an npmx enumerator.
+ *
+ * @param _name       Name of the defined function.
+ * @param _value_type npmx value type.
+ * @param _convert    npmx converter, for example npmx_buck_voltage_convert.
+ * @param _invalid    npmx enumerator returned for values which cannot be converted.
+ */
+#define SHELL_PARAM_TO_NPMX(_name, _value_type, _convert, _invalid)                                \
+	static bool _name(int32_t value, int32_t *p_converted)                                     \
+	{                                                                                          \
+		_value_type converted = _convert((uint32_t)value);                                 \
+		*p_converted = (int32_t)converted;                                                 \
+		return converted != (_invalid);                                                    \
+	}
+
+/**
+ * @brief Macro for defining the converter used in descriptors, wrapping an npmx converter from
+ *        an npmx enumerator to values in the unit.
+ *
+ * @param _name       Name of the defined function.
+ * @param _value_type npmx value type.
+ * @param _convert    npmx converter, for example npmx_buck_voltage_convert_to_mv.
+ */
+#define SHELL_PARAM_FROM_NPMX(_name, _value_type, _convert)                                        \
+	static bool _name(int32_t value, int32_t *p_converted)                                     \
+	{                                                                                          \
+		uint32_t converted;                                                                \
+		bool status = _convert((_value_type)value, &converted);                            \
+		*p_converted = (int32_t)converted;                                                 \
+		return status;                                                                     \
+	}
+
+/**
+ * @brief Macro for initializing a descriptor map from an array of entries.
+ *
+ * @param _map Array of @ref shell_enum_map_t entries.
+ */
+#define SHELL_PARAM_MAP(_map) .p_map = (_map), .map_size = ARRAY_SIZE(_map)
+
+/**
+ * @brief Macro for defining the "set" command handler of the parameter.
+ *
+ * @param _name  Name of the defined handler.
+ * @param _param Parameter descriptor.
+ */
+#define SHELL_PARAM_CMD_SET(_name, _param)                                                         \
+	static int _name(const struct shell *shell, size_t argc, char **argv)                      \
+	{                                                                                          \
+		return shell_param_set(shell, argc, argv, &(_param));                              \
+	}
+
+/**
+ * @brief Macro for defining the "get" command handler of the parameter.
+ *
+ * @param _name  Name of the defined handler.
+ * @param _param Parameter descriptor.
+ */
+#define SHELL_PARAM_CMD_GET(_name, _param)                                                         \
+	static int _name(const struct shell *shell, size_t argc, char **argv)                      \
+	{                                                                                          \
+		return shell_param_get(shell, argc, argv, &(_param));                              \
+	}
+
+/**
+ * @brief Function for handling the "set" command of the parameter.
+ *
+ * Arguments are the instance index, if the peripheral has more instances, and the value. The
+ * value is checked against the range or the map, converted, and checked with the descriptor check
+ * before the setter is called.
+ *
+ * @param[in] shell   Shell instance.
+ * @param[in] argc    Number of arguments.
+ * @param[in] argv    Arguments.
+ * @param[in] p_param Pointer to the parameter descriptor.
+ *
+ * @return Always 0, errors are printed.
+ */
+int shell_param_set(const struct shell *shell, size_t argc, char **argv,
+		    shell_param_t const *p_param);
+
+/**
+ * @brief Function for handling the "get" command of the parameter.
+ *
+ * The argument is the instance index, if the peripheral has more instances.
+ *
+ * @param[in] shell   Shell instance.
+ * @param[in] argc    Number of arguments.
+ * @param[in] argv    Arguments.
+ * @param[in] p_param Pointer to the parameter descriptor.
+ *
+ * @return Always 0, errors are printed.
+ */
+int shell_param_get(const struct shell *shell, size_t argc, char **argv,
+		    shell_param_t const *p_param);
+
+/**
+ * @brief Function for checking that the GPIO index set as the value is not used by the driver.
+ *
+ * Can be used as the descriptor check of parameters selecting a GPIO.
+ *
+ * @param[in] shell      Shell instance.
+ * @param[in] p_param    Pointer to the parameter descriptor.
+ * @param[in] p_instance Pointer to the peripheral instance.
+ * @param[in] index      Instance index.
+ * @param[in] value      GPIO index, -1 if none.
+ *
+ * @retval true  GPIO can be used.
+ * @retval false GPIO used as interrupt or POF, error printed.
+ */
+bool shell_param_pin_value_check(const struct shell *shell, shell_param_t const *p_param,
+				 void const *p_instance, uint32_t index, int32_t value);
+
+/**
+ * @brief Function for checking that the GPIO instance is not used by the driver.
+ *
+ * Can be used as the descriptor check of GPIO parameters.
+ *
+ * @param[in] shell      Shell instance.
+ * @param[in] p_param    Pointer to the parameter descriptor.
+ * @param[in] p_instance Pointer to the peripheral instance.
+ * @param[in] index      GPIO index.
+ * @param[in] value      Value to be set.
+ *
+ * @retval true  GPIO can be configured.
+ * @retval false GPIO used as interrupt or POF, error printed.
+ */
+bool shell_param_pin_instance_check(const struct shell *shell, shell_param_t const *p_param,
+				    void const *p_instance, uint32_t index, int32_t value);
+
+#endif /* ZEPHYR_DRIVERS_SHELL_TABLE_H__ */
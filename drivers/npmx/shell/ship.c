@@ -161,10 +161,32 @@ static int ship_mode_set(const struct shell *shell, npmx_ship_task_t ship_task)
 
 static int cmd_ship_mode_hibernate_set(const struct shell *shell, size_t argc, char **argv)
 {
-	ARG_UNUSED(argc);
-	ARG_UNUSED(argv);
+	if (argc < 2) {
+		return ship_mode_set(shell, NPMX_SHIP_TASK_HIBERNATE);
+	}
+
+	args_info_t args_info = {
+		.expected_args = 1,
+		.arg = {
+			[0] = { SHELL_ARG_TYPE_UINT32_VALUE, "wake-up time" },
+		},
+	};
+	if (!arguments_check(shell, argc, argv, &args_info)) {
+		return 0;
+	}
+
+	/* The TIMER is configured and the hibernate mode entered in a single batch. */
+	int err = npmx_driver_hibernate(pmic_dev_get(), args_info.arg[0].result.uvalue, 0);
+
+	if (err == -EINVAL) {
+		shell_error(shell, "Error: wake-up time out of the TIMER range.");
+	} else if (err != 0) {
+		print_set_error(shell, "ship mode");
+	} else {
+		print_success(shell, true, UNIT_TYPE_NONE);
+	}
 
-	return ship_mode_set(shell, NPMX_SHIP_TASK_HIBERNATE);
+	return 0;
 }
 
 static int cmd_ship_mode_ship_set(const struct shell *shell, size_t argc, char **argv)
@@ -301,8 +323,9 @@ SHELL_STATIC_SUBCMD_SET_CREATE(sub_ship_config,
 
 /* Creating subcommands (level 3 command) array for command "ship mode". */
 SHELL_STATIC_SUBCMD_SET_CREATE(sub_ship_mode,
-			       SHELL_CMD(hibernate, NULL, "Enter hibernate mode",
-					 cmd_ship_mode_hibernate_set),
+			       SHELL_CMD_ARG(hibernate, NULL,
+					     "Enter hibernate mode [<wake-up ms>]",
+					     cmd_ship_mode_hibernate_set, 1, 1),
 			       SHELL_CMD(ship, NULL, "Enter ship mode", cmd_ship_mode_ship_set),
 			       SHELL_SUBCMD_SET_END);
 
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "shell_common.h"
+#include <npmx_driver.h>
+
+#include <stdio.h>
+
+static void print_counters(const struct shell *shell, const char *name,
+			   struct npmx_driver_bus_counters const *counters)
+{
+	shell_print(shell, "%-8s %8u %8u %10u %8u", name, counters->reads, counters->writes,
+		    counters->bytes, counters->errors);
+}
+
+static int cmd_stats_get(const struct shell *shell, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	const struct device *pmic_dev = pmic_dev_get();
+	struct npmx_driver_bus_stats stats;
+	struct npmx_driver_bus_register_stats register_stats;
+	struct npmx_driver_bus_recovery_stats recovery;
+	char name[8];
+
+	if (npmx_driver_bus_stats_get(pmic_dev, &stats) != 0) {
+		print_get_error(shell, "statistics");
+		return 0;
+	}
+
+	shell_print(shell, "Transfers: %u, errors: %u", stats.transfers, stats.errors);
+	shell_print(shell, "Duration: min %u us, avg %u us, max %u us, total %llu us",
+		    stats.min_us, stats.avg_us, stats.max_us, (unsigned long long)stats.total_us);
+	shell_print(shell, "Reads served without bus transfer: %u", stats.saved_reads);
+
+	shell_print(shell, "%-8s %8s %8s %10s %8s", "Base", "Reads", "Writes", "Bytes", "Errors");
+	for (size_t i = 0; i < NPMX_DRIVER_BUS_STATS_PERIPHERALS; i++) {
+		struct npmx_driver_bus_counters const *counters = &stats.peripherals[i];
+
+		if ((counters->reads + counters->writes) == 0) {
+			continue;
+		}
+
+		snprintf(name, sizeof(name), "0x%02X", (unsigned int)i);
+		print_counters(shell, name, counters);
+	}
+	print_counters(shell, "All", &stats.total);
+
+	shell_print(shell, "%-8s %8s %8s %10s %8s", "Register", "Reads", "Writes", "Bytes",
+		    "Errors");
+	for (size_t i = 0; npmx_driver_bus_register_stats_get(pmic_dev, i, &register_stats) == 0;
+	     i++) {
+		snprintf(name, sizeof(name), "0x%04X", register_stats.register_address);
+		print_counters(shell, name, &register_stats.counters);
+	}
+
+	if (stats.untracked > 0) {
+		shell_print(shell, "Segments not counted per register: %u", stats.untracked);
+	}
+
+	if (npmx_driver_bus_recovery_stats_get(pmic_dev, &recovery) == 0) {
+		shell_print(shell, "Retries: %u, recovered: %u, failed: %u", recovery.retries,
+			    recovery.recovered, recovery.failed);
+		shell_print(shell, "Bus recoveries: %u, event resyncs: %u", recovery.bus_recoveries,
+			    recovery.resyncs);
+	}
+
+	return 0;
+}
+
+static int cmd_stats_reset(const struct shell *shell, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	npmx_driver_bus_stats_reset(pmic_dev_get());
+
+	shell_print(shell, "Success: statistics cleared.");
+	return 0;
+}
+
+/* Creating subcommands (level 2 command) array for command "stats". */
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_stats,
+			       SHELL_CMD(get, NULL, "Get bus usage statistics", cmd_stats_get),
+			       SHELL_CMD(reset, NULL, "Clear bus usage statistics",
+					 cmd_stats_reset),
+			       SHELL_SUBCMD_SET_END);
+
+SHELL_SUBCMD_ADD((npmx), stats, &sub_stats, "Bus usage statistics", NULL, 1, 0);
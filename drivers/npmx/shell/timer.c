@@ -4,16 +4,9 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
-#include "shell_common.h"
+#include "shell_table.h"
 #include <npmx_driver.h>
 
-/** @brief Timer config parameter. */
-typedef enum {
-	TIMER_CONFIG_PARAM_COMPARE, /* Configure timer compare value. */
-	TIMER_CONFIG_PARAM_MODE, /* Configure timer mode. */
-	TIMER_CONFIG_PARAM_PRESCALER, /* Configure timer prescaler mode. */
-} timer_config_param_t;
-
 static npmx_timer_t *timer_instance_get(const struct shell *shell)
 {
 	npmx_instance_t *npmx_instance = npmx_instance_get(shell);
@@ -21,172 +14,91 @@ static npmx_timer_t *timer_instance_get(const struct shell *shell)
 	return npmx_instance ? npmx_timer_get(npmx_instance, 0) : NULL;
 }
 
-static npmx_timer_mode_t timer_mode_int_convert_to_enum(const struct shell *shell,
-							uint32_t timer_mode)
-{
-	switch (timer_mode) {
-	case 0:
-		return NPMX_TIMER_MODE_BOOT_MONITOR;
-	case 1:
-		return NPMX_TIMER_MODE_WATCHDOG_WARNING;
-	case 2:
-		return NPMX_TIMER_MODE_WATCHDOG_RESET;
-	case 3:
-		return NPMX_TIMER_MODE_GENERAL_PURPOSE;
-	case 4:
-		return NPMX_TIMER_MODE_WAKEUP;
-	default:
-		shell_error(shell, "Error: Wrong mode:");
-		print_hint_error(shell, 0, "Boot monitor");
-		print_hint_error(shell, 1, "Watchdog warning");
-		print_hint_error(shell, 2, "Watchdog reset");
-		print_hint_error(shell, 3, "General purpose");
-		print_hint_error(shell, 4, "Wakeup");
-		return NPMX_TIMER_MODE_INVALID;
-	}
-}
-
-static int timer_config_set(const struct shell *shell, size_t argc, char **argv,
-			    timer_config_param_t config_type)
-{
-	char *config_name;
-	switch (config_type) {
-	case TIMER_CONFIG_PARAM_MODE:
-		config_name = "mode";
-		break;
-	case TIMER_CONFIG_PARAM_PRESCALER:
-		config_name = "prescaler";
-		break;
-	case TIMER_CONFIG_PARAM_COMPARE:
-		config_name = "compare";
-		break;
-	}
-
-	args_info_t args_info = { .expected_args = 1,
-				  .arg = {
-					  [0] = { SHELL_ARG_TYPE_UINT32_VALUE, config_name },
-				  } };
-	if (!arguments_check(shell, argc, argv, &args_info)) {
-		return 0;
-	}
-
-	npmx_timer_t *timer_instance = timer_instance_get(shell);
-	if (timer_instance == NULL) {
-		return 0;
-	}
-
-	npmx_timer_config_t timer_config;
-	npmx_error_t err_code = npmx_timer_config_get(timer_instance, &timer_config);
-	if (!check_error_code(shell, err_code)) {
-		print_get_error(shell, "timer config");
-		return 0;
-	}
-
-	uint32_t config_value = args_info.arg[0].result.uvalue;
-	switch (config_type) {
-	case TIMER_CONFIG_PARAM_MODE:
-		timer_config.mode = timer_mode_int_convert_to_enum(shell, config_value);
-		if (timer_config.mode == NPMX_TIMER_MODE_INVALID) {
-			return 0;
-		}
-		break;
-	case TIMER_CONFIG_PARAM_PRESCALER:
-		if (config_value >= NPMX_TIMER_PRESCALER_COUNT) {
-			shell_error(shell, "Error: Wrong prescaler:");
-			print_hint_error(shell, 0, "Slow");
-			print_hint_error(shell, 1, "Fast");
-			return 0;
-		}
-
-		timer_config.prescaler =
-			(config_value ? NPMX_TIMER_PRESCALER_FAST : NPMX_TIMER_PRESCALER_SLOW);
-		break;
-	case TIMER_CONFIG_PARAM_COMPARE:
-		if (!range_check(shell, config_value, 0, NPM_TIMER_COUNTER_COMPARE_VALUE_MAX,
-				 "compare")) {
-			return 0;
-		}
-
-		timer_config.compare_value = config_value;
-		break;
-	}
-
-	err_code = npmx_timer_config_set(timer_instance, &timer_config);
-	if (!check_error_code(shell, err_code)) {
-		print_set_error(shell, "timer config");
-		return 0;
-	}
-
-	print_success(shell, config_value, UNIT_TYPE_NONE);
-	return 0;
-}
-
-static int timer_config_get(const struct shell *shell, timer_config_param_t config_type)
-{
-	npmx_timer_t *timer_instance = timer_instance_get(shell);
-	if (timer_instance == NULL) {
-		return 0;
-	}
-
-	npmx_timer_config_t timer_config;
-	npmx_error_t err_code = npmx_timer_config_get(timer_instance, &timer_config);
-	if (!check_error_code(shell, err_code)) {
-		print_get_error(shell, "timer config");
-		return 0;
-	}
+SHELL_PARAM_INSTANCE_GETTER(timer_param_instance_get, npmx_timer_get)
 
-	switch (config_type) {
-	case TIMER_CONFIG_PARAM_MODE:
-		print_value(shell, (int)timer_config.mode, UNIT_TYPE_NONE);
-		break;
-	case TIMER_CONFIG_PARAM_PRESCALER:
-		print_value(shell, (int)timer_config.prescaler, UNIT_TYPE_NONE);
-		break;
-	case TIMER_CONFIG_PARAM_COMPARE:
-		print_value(shell, timer_config.compare_value, UNIT_TYPE_NONE);
-		break;
+/**
+ * @brief Macro for defining the setter and getter of a timer configuration field.
+ *
+ * @param _field Field of the npmx timer configuration.
+ * @param _type  Type of the field.
+ */
+#define TIMER_CONFIG_ACCESSORS(_field, _type)                                                      \
+	static npmx_error_t timer_##_field##_set(void const *p_instance, int32_t value)            \
+	{                                                                                          \
+		npmx_timer_config_t timer_config;                                                  \
+		npmx_error_t err_code = npmx_timer_config_get(p_instance, &timer_config);          \
+		if (err_code != NPMX_SUCCESS) {                                                    \
+			return err_code;                                                           \
+		}                                                                                  \
+		timer_config._field = (_type)value;                                                \
+		return npmx_timer_config_set(p_instance, &timer_config);                           \
+	}                                                                                          \
+                                                                                                   \
+	static npmx_error_t timer_##_field##_get(void const *p_instance, int32_t *p_value)         \
+	{                                                                                          \
+		npmx_timer_config_t timer_config;                                                  \
+		npmx_error_t err_code = npmx_timer_config_get(p_instance, &timer_config);          \
+		*p_value = (int32_t)timer_config._field;                                           \
+		return err_code;                                                                   \
 	}
-	return 0;
-}
-
-static int cmd_timer_config_compare_set(const struct shell *shell, size_t argc, char **argv)
-{
-	return timer_config_set(shell, argc, argv, TIMER_CONFIG_PARAM_COMPARE);
-}
-
-static int cmd_timer_config_compare_get(const struct shell *shell, size_t argc, char **argv)
-{
-	ARG_UNUSED(argc);
-	ARG_UNUSED(argv);
-
-	return timer_config_get(shell, TIMER_CONFIG_PARAM_COMPARE);
-}
 
-static int cmd_timer_config_mode_set(const struct shell *shell, size_t argc, char **argv)
-{
-	return timer_config_set(shell, argc, argv, TIMER_CONFIG_PARAM_MODE);
-}
-
-static int cmd_timer_config_mode_get(const struct shell *shell, size_t argc, char **argv)
-{
-	ARG_UNUSED(argc);
-	ARG_UNUSED(argv);
-
-	return timer_config_get(shell, TIMER_CONFIG_PARAM_MODE);
-}
-
-static int cmd_timer_config_prescaler_set(const struct shell *shell, size_t argc, char **argv)
-{
-	return timer_config_set(shell, argc, argv, TIMER_CONFIG_PARAM_PRESCALER);
-}
-
-static int cmd_timer_config_prescaler_get(const struct shell *shell, size_t argc, char **argv)
-{
-	ARG_UNUSED(argc);
-	ARG_UNUSED(argv);
-
-	return timer_config_get(shell, TIMER_CONFIG_PARAM_PRESCALER);
-}
+TIMER_CONFIG_ACCESSORS(compare_value, uint32_t)
+TIMER_CONFIG_ACCESSORS(mode, npmx_timer_mode_t)
+TIMER_CONFIG_ACCESSORS(prescaler, npmx_timer_prescaler_t)
+
+static const shell_enum_map_t timer_modes[] = {
+	{ NPMX_TIMER_MODE_BOOT_MONITOR, "Boot monitor" },
+	{ NPMX_TIMER_MODE_WATCHDOG_WARNING, "Watchdog warning" },
+	{ NPMX_TIMER_MODE_WATCHDOG_RESET, "Watchdog reset" },
+	{ NPMX_TIMER_MODE_GENERAL_PURPOSE, "General purpose" },
+	{ NPMX_TIMER_MODE_WAKEUP, "Wakeup" },
+};
+
+static const shell_enum_map_t timer_prescalers[] = {
+	{ NPMX_TIMER_PRESCALER_SLOW, "Slow" },
+	{ NPMX_TIMER_PRESCALER_FAST, "Fast" },
+};
+
+static const shell_param_t timer_compare_param = {
+	SHELL_PARAM_INSTANCE("timer", 0, timer_param_instance_get),
+	.name = "compare",
+	.description = "timer config",
+	.type = SHELL_ARG_TYPE_UINT32_VALUE,
+	.min = 0,
+	.max = NPM_TIMER_COUNTER_COMPARE_VALUE_MAX,
+	.unit = UNIT_TYPE_NONE,
+	.set = timer_compare_value_set,
+	.get = timer_compare_value_get,
+};
+
+static const shell_param_t timer_mode_param = {
+	SHELL_PARAM_INSTANCE("timer", 0, timer_param_instance_get),
+	.name = "mode",
+	.description = "timer config",
+	.type = SHELL_ARG_TYPE_UINT32_VALUE,
+	SHELL_PARAM_MAP(timer_modes),
+	.unit = UNIT_TYPE_NONE,
+	.set = timer_mode_set,
+	.get = timer_mode_get,
+};
+
+static const shell_param_t timer_prescaler_param = {
+	SHELL_PARAM_INSTANCE("timer", 0, timer_param_instance_get),
+	.name = "prescaler",
+	.description = "timer config",
+	.type = SHELL_ARG_TYPE_UINT32_VALUE,
+	SHELL_PARAM_MAP(timer_prescalers),
+	.unit = UNIT_TYPE_NONE,
+	.set = timer_prescaler_set,
+	.get = timer_prescaler_get,
+};
+
+SHELL_PARAM_CMD_SET(cmd_timer_config_compare_set, timer_compare_param)
+SHELL_PARAM_CMD_GET(cmd_timer_config_compare_get, timer_compare_param)
+SHELL_PARAM_CMD_SET(cmd_timer_config_mode_set, timer_mode_param)
+SHELL_PARAM_CMD_GET(cmd_timer_config_mode_get, timer_mode_param)
+SHELL_PARAM_CMD_SET(cmd_timer_config_prescaler_set, timer_prescaler_param)
+SHELL_PARAM_CMD_GET(cmd_timer_config_prescaler_get, timer_prescaler_param)
 
 static int timer_trigger_task(const struct shell *shell, npmx_timer_task_t task)
 {
@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <npmx_charger.h>
+#include <npmx_telemetry.h>
+
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/crc.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(NPMX, CONFIG_NPMX_LOG_LEVEL);
+
+/* CRC-16/CCITT initial value. */
+#define CRC_SEED 0xFFFFU
+
+void npmx_telemetry_init(struct npmx_telemetry *p_telemetry, npmx_telemetry_send_t send,
+			 void *p_user_data)
+{
+	p_telemetry->send = send;
+	p_telemetry->p_user_data = p_user_data;
+	p_telemetry->seq = 0;
+
+	atomic_set(&p_telemetry->subscribed, 0);
+	atomic_set(&p_telemetry->dropped, 0);
+
+	k_mutex_init(&p_telemetry->lock);
+}
+
+int npmx_telemetry_rx(struct npmx_telemetry *p_telemetry, uint8_t const *p_frame, size_t len)
+{
+	struct npmx_telemetry_header header;
+	uint8_t const *p_payload = &p_frame[sizeof(header)];
+
+	if (len < sizeof(header)) {
+		return -EINVAL;
+	}
+
+	memcpy(&header, p_frame, sizeof(header));
+
+	if ((header.sync != NPMX_TELEMETRY_SYNC) || (len != (sizeof(header) + header.len)) ||
+	    (sys_le16_to_cpu(header.crc) != crc16_ccitt(CRC_SEED, p_payload, header.len))) {
+		return -EINVAL;
+	}
+
+	if ((header.channel != NPMX_TELEMETRY_CHANNEL_CONTROL) || (header.len == 0)) {
+		return -ENOTSUP;
+	}
+
+	switch (p_payload[0]) {
+	case NPMX_TELEMETRY_COMMAND_SUBSCRIBE:
+		if (header.len != 2) {
+			return -EINVAL;
+		}
+
+		atomic_set(&p_telemetry->subscribed,
+			   p_payload[1] & BIT_MASK(NPMX_TELEMETRY_CHANNEL_COUNT));
+		LOG_DBG("Telemetry channels subscribed: 0x%02X", p_payload[1]);
+		return 0;
+	default:
+		return -ENOTSUP;
+	}
+}
+
+bool npmx_telemetry_subscribed(struct npmx_telemetry *p_telemetry,
+			       enum npmx_telemetry_channel channel)
+{
+	return (channel < NPMX_TELEMETRY_CHANNEL_COUNT) &&
+	       atomic_test_bit(&p_telemetry->subscribed, channel);
+}
+
+int npmx_telemetry_publish(struct npmx_telemetry *p_telemetry, enum npmx_telemetry_channel channel,
+			   void const *p_payload, size_t len)
+{
+	struct npmx_telemetry_header header;
+	int err;
+
+	if (len > NPMX_TELEMETRY_PAYLOAD_MAX) {
+		return -EINVAL;
+	}
+
+	if (!npmx_telemetry_subscribed(p_telemetry, channel)) {
+		return 0;
+	}
+
+	header.sync = NPMX_TELEMETRY_SYNC;
+	header.channel = (uint8_t)channel;
+	header.len = (uint8_t)len;
+	header.crc = sys_cpu_to_le16(crc16_ccitt(CRC_SEED, p_payload, len));
+
+	/* Frames are sent in the order of their sequence numbers. */
+	k_mutex_lock(&p_telemetry->lock, K_FOREVER);
+
+	header.seq = p_telemetry->seq++;
+	err = p_telemetry->send(&header, p_payload, len, p_telemetry->p_user_data);
+
+	k_mutex_unlock(&p_telemetry->lock);
+
+	if (err != 0) {
+		atomic_inc(&p_telemetry->dropped);
+		return -EIO;
+	}
+
+	return 0;
+}
+
+#if defined(CONFIG_NPMX_ADC_SAMPLER)
+size_t npmx_telemetry_adc_publish(struct npmx_telemetry *p_telemetry,
+				  struct npmx_adc_sampler *p_sampler)
+{
+	struct npmx_adc_sample sample;
+	struct npmx_telemetry_adc record;
+	size_t count = 0;
+
+	if (!npmx_telemetry_subscribed(p_telemetry, NPMX_TELEMETRY_CHANNEL_ADC)) {
+		return 0;
+	}
+
+	while (npmx_adc_sampler_get(p_sampler, &sample, 1, K_NO_WAIT) == 1) {
+		record.timestamp = sys_cpu_to_le32((uint32_t)sample.timestamp);
+		record.vbat = (int32_t)sys_cpu_to_le32((uint32_t)sample.vbat);
+		record.ibat = (int32_t)sys_cpu_to_le32((uint32_t)sample.ibat);
+		record.bat_temp = (int32_t)sys_cpu_to_le32((uint32_t)sample.bat_temp);
+		record.die_temp = (int32_t)sys_cpu_to_le32((uint32_t)sample.die_temp);
+#if defined(CONFIG_NPMX_POWER_ACCOUNT)
+		record.rails = sample.rails;
+		record.flags = sample.first ? NPMX_TELEMETRY_ADC_FLAG_FIRST : 0;
+#else
+		record.rails = 0;
+		record.flags = 0;
+#endif
+
+		if (npmx_telemetry_publish(p_telemetry, NPMX_TELEMETRY_CHANNEL_ADC, &record,
+					   sizeof(record)) == 0) {
+			count++;
+		}
+	}
+
+	return count;
+}
+#endif
+
+int npmx_telemetry_charger_publish(struct npmx_telemetry *p_telemetry, const struct device *p_dev)
+{
+	npmx_charger_t *charger_instance = npmx_charger_get(npmx_driver_instance_get(p_dev), 0);
+	npmx_charger_status_mask_t status;
+	struct npmx_telemetry_charger record;
+
+	if (!npmx_telemetry_subscribed(p_telemetry, NPMX_TELEMETRY_CHANNEL_CHARGER)) {
+		return 0;
+	}
+
+	if (npmx_charger_status_get(charger_instance, &status) != NPMX_SUCCESS) {
+		return -EIO;
+	}
+
+	record.timestamp = sys_cpu_to_le32(k_uptime_get_32());
+	record.status = (uint8_t)status;
+
+	return npmx_telemetry_publish(p_telemetry, NPMX_TELEMETRY_CHANNEL_CHARGER, &record,
+				      sizeof(record));
+}
+
+int npmx_telemetry_event_publish(struct npmx_telemetry *p_telemetry, npmx_callback_type_t type,
+				 uint8_t mask)
+{
+	struct npmx_telemetry_event record = {
+		.timestamp = sys_cpu_to_le32(k_uptime_get_32()),
+		.type = (uint8_t)type,
+		.mask = mask,
+	};
+
+	return npmx_telemetry_publish(p_telemetry, NPMX_TELEMETRY_CHANNEL_EVENT, &record,
+				      sizeof(record));
+}
+
+uint32_t npmx_telemetry_dropped_get(struct npmx_telemetry *p_telemetry)
+{
+	return (uint32_t)atomic_clear(&p_telemetry->dropped);
+}
@@ -0,0 +1,306 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <zephyr/drivers/i2c.h>
+#include <zephyr/init.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/shell/shell_dummy.h>
+#include <npmx_adc.h>
+#include <npmx_core.h>
+#include <npmx_driver.h>
+#include <npmx_led.h>
+#include <npmx_vbusin.h>
+
+#define LOG_MODULE_NAME benchmark
+LOG_MODULE_REGISTER(LOG_MODULE_NAME);
+
+#define PMIC_NODE DT_NODELABEL(npm_0)
+#define I2C_NODE  DT_BUS(PMIC_NODE)
+
+/* Bus frequency set in devicetree. */
+#define I2C_DT_BITRATE DT_PROP_OR(I2C_NODE, clock_frequency, I2C_BITRATE_STANDARD)
+
+/* Timeout of waiting for the ADC event interrupt. */
+#define INT_TIMEOUT K_MSEC(100)
+
+/* Shell command executed by the shell benchmark. */
+#define SHELL_BENCHMARK_CMD "npmx vbusin status connected get"
+
+/** @brief Cycle counter statistics of a benchmark. */
+struct bench_result {
+	uint32_t count; /* Number of measured iterations. */
+	uint32_t min_cycles; /* Shortest iteration. */
+	uint32_t max_cycles; /* Longest iteration. */
+	uint64_t total_cycles; /* Sum of all iterations. */
+};
+
+/** @brief I2C bus speed used in benchmarks. */
+struct bench_speed {
+	uint32_t speed; /* Zephyr I2C speed identifier. */
+	uint32_t khz; /* Bus frequency in kHz, printed in results. */
+};
+
+static const struct bench_speed bench_speeds[] = {
+	{ I2C_SPEED_STANDARD, 100 },
+	{ I2C_SPEED_FAST, 400 },
+};
+
+static const struct device *const pmic_dev = DEVICE_DT_GET(PMIC_NODE);
+static const struct device *const i2c_dev = DEVICE_DT_GET(I2C_NODE);
+
+static uint32_t init_start_cycles;
+static uint32_t init_end_cycles;
+
+static K_SEM_DEFINE(adc_sem, 0, 1);
+static uint32_t adc_cb_cycles;
+
+static int init_start_stamp(const struct device *dev)
+{
+	ARG_UNUSED(dev);
+
+	init_start_cycles = k_cycle_get_32();
+	return 0;
+}
+
+static int init_end_stamp(const struct device *dev)
+{
+	ARG_UNUSED(dev);
+
+	init_end_cycles = k_cycle_get_32();
+	return 0;
+}
+
+/* Timestamps taken right before and after the nPM device initialization. */
+SYS_INIT(init_start_stamp, POST_KERNEL, CONFIG_BENCHMARK_INIT_PRIORITY_BEFORE);
+SYS_INIT(init_end_stamp, POST_KERNEL, CONFIG_BENCHMARK_INIT_PRIORITY_AFTER);
+
+static void result_reset(struct bench_result *p_result)
+{
+	*p_result = (struct bench_result){ .min_cycles = UINT32_MAX };
+}
+
+static void result_add(struct bench_result *p_result, uint32_t cycles)
+{
+	p_result->count++;
+	p_result->total_cycles += cycles;
+	p_result->min_cycles = MIN(p_result->min_cycles, cycles);
+	p_result->max_cycles = MAX(p_result->max_cycles, cycles);
+}
+
+/**
+ * @brief Function for printing the benchmark result as a line of comma-separated values.
+ *
+ * @param[in] name      Benchmark name.
+ * @param[in] speed_khz I2C bus frequency in kHz.
+ * @param[in] p_result  Pointer to the benchmark result.
+ */
+static void result_print(const char *name, uint32_t speed_khz, struct bench_result const *p_result)
+{
+	uint32_t avg_cycles =
+		(p_result->count > 0) ? (uint32_t)(p_result->total_cycles / p_result->count) : 0;
+
+	printk("bench,%s,%u,%u,%u,%u,%u,%u\n", name, speed_khz, p_result->count,
+	       (p_result->count > 0) ? p_result->min_cycles : 0, avg_cycles, p_result->max_cycles,
+	       k_cyc_to_us_floor32(avg_cycles));
+}
+
+static void bench_reg_read(npmx_instance_t *p_pm, uint32_t speed_khz)
+{
+	npmx_vbusin_t *vbusin_instance = npmx_vbusin_get(p_pm, 0);
+	struct bench_result result;
+	uint8_t status;
+
+	result_reset(&result);
+
+	for (int i = 0; i < CONFIG_BENCHMARK_ITERATIONS; i++) {
+		uint32_t start = k_cycle_get_32();
+
+		if (npmx_vbusin_vbus_status_get(vbusin_instance, &status) != NPMX_SUCCESS) {
+			LOG_ERR("Reading VBUS status failed.");
+			return;
+		}
+
+		result_add(&result, k_cycle_get_32() - start);
+	}
+
+	result_print("reg_read", speed_khz, &result);
+}
+
+static void bench_reg_write(npmx_instance_t *p_pm, uint32_t speed_khz)
+{
+	npmx_led_t *led_instance = npmx_led_get(p_pm, 0);
+	struct bench_result result;
+
+	result_reset(&result);
+
+	if (npmx_led_mode_set(led_instance, NPMX_LED_MODE_HOST) != NPMX_SUCCESS) {
+		LOG_ERR("Setting LED mode failed.");
+		return;
+	}
+
+	for (int i = 0; i < CONFIG_BENCHMARK_ITERATIONS; i++) {
+		uint32_t start = k_cycle_get_32();
+
+		if (npmx_led_state_set(led_instance, (i & 1) != 0) != NPMX_SUCCESS) {
+			LOG_ERR("Setting LED state failed.");
+			return;
+		}
+
+		result_add(&result, k_cycle_get_32() - start);
+	}
+
+	(void)npmx_led_state_set(led_instance, false);
+
+	result_print("reg_write", speed_khz, &result);
+}
+
+static void bench_adc_meas_all(npmx_instance_t *p_pm, uint32_t speed_khz)
+{
+	npmx_adc_t *adc_instance = npmx_adc_get(p_pm, 0);
+	npmx_adc_meas_all_t meas;
+	struct bench_result result;
+
+	result_reset(&result);
+
+	for (int i = 0; i < CONFIG_BENCHMARK_ITERATIONS; i++) {
+		uint32_t start = k_cycle_get_32();
+
+		if (npmx_adc_meas_all_get(adc_instance, &meas) != NPMX_SUCCESS) {
+			LOG_ERR("Reading ADC measurements failed.");
+			return;
+		}
+
+		result_add(&result, k_cycle_get_32() - start);
+	}
+
+	result_print("adc_meas_all", speed_khz, &result);
+}
+
+static void adc_callback(npmx_instance_t *p_pm, npmx_callback_type_t type, uint8_t mask)
+{
+	ARG_UNUSED(p_pm);
+	ARG_UNUSED(type);
+
+	if (mask & (uint8_t)NPMX_EVENT_GROUP_ADC_BAT_READY_MASK) {
+		adc_cb_cycles = k_cycle_get_32();
+		k_sem_give(&adc_sem);
+	}
+}
+
+/**
+ * @brief Function for measuring the time from triggering the VBAT measurement to the ADC event
+ *        callback.
+ *
+ * The time includes the conversion, the host interrupt, event processing and the callback
+ * dispatch.
+ */
+static void bench_int_service(npmx_instance_t *p_pm, uint32_t speed_khz)
+{
+	npmx_adc_t *adc_instance = npmx_adc_get(p_pm, 0);
+	struct bench_result result;
+
+	if (npmx_driver_int_pin_get(pmic_dev) == -1) {
+		LOG_INF("Host interrupt not configured, skipping interrupt benchmark.");
+		return;
+	}
+
+	result_reset(&result);
+
+	npmx_core_register_cb(p_pm, adc_callback, NPMX_CALLBACK_TYPE_EVENT_ADC);
+	npmx_core_event_interrupt_enable(p_pm, NPMX_EVENT_GROUP_ADC,
+					 NPMX_EVENT_GROUP_ADC_BAT_READY_MASK);
+
+	for (int i = 0; i < CONFIG_BENCHMARK_ITERATIONS; i++) {
+		k_sem_reset(&adc_sem);
+
+		uint32_t start = k_cycle_get_32();
+
+		if (npmx_adc_task_trigger(adc_instance, NPMX_ADC_TASK_SINGLE_SHOT_VBAT) !=
+		    NPMX_SUCCESS) {
+			LOG_ERR("Triggering VBAT measurement failed.");
+			break;
+		}
+
+		if (k_sem_take(&adc_sem, INT_TIMEOUT) != 0) {
+			LOG_ERR("ADC event interrupt timed out.");
+			break;
+		}
+
+		result_add(&result, adc_cb_cycles - start);
+	}
+
+	npmx_core_event_interrupt_disable(p_pm, NPMX_EVENT_GROUP_ADC,
+					  NPMX_EVENT_GROUP_ADC_BAT_READY_MASK);
+
+	result_print("int_service", speed_khz, &result);
+}
+
+static void bench_shell(uint32_t speed_khz)
+{
+	const struct shell *shell = shell_backend_dummy_get_ptr();
+	struct bench_result result;
+	size_t output_size;
+
+	result_reset(&result);
+
+	for (int i = 0; i < CONFIG_BENCHMARK_ITERATIONS; i++) {
+		shell_backend_dummy_clear_output(shell);
+
+		uint32_t start = k_cycle_get_32();
+
+		if (shell_execute_cmd(shell, SHELL_BENCHMARK_CMD) != 0) {
+			LOG_ERR("Shell command failed: %s",
+				shell_backend_dummy_get_output(shell, &output_size));
+			return;
+		}
+
+		result_add(&result, k_cycle_get_32() - start);
+	}
+
+	result_print("shell", speed_khz, &result);
+}
+
+void main(void)
+{
+	if (!device_is_ready(pmic_dev)) {
+		LOG_INF("PMIC device is not ready.");
+		return;
+	}
+
+	LOG_INF("PMIC device OK.");
+
+	npmx_instance_t *npmx_instance = npmx_driver_instance_get(pmic_dev);
+	struct bench_result result;
+
+	printk("bench,name,speed_khz,count,min_cycles,avg_cycles,max_cycles,avg_us\n");
+
+	/* The nPM device is initialized at the bus speed from devicetree. */
+	result_reset(&result);
+	result_add(&result, init_end_cycles - init_start_cycles);
+	result_print("driver_init", I2C_DT_BITRATE / 1000, &result);
+
+	for (size_t i = 0; i < ARRAY_SIZE(bench_speeds); i++) {
+		uint32_t khz = bench_speeds[i].khz;
+		uint32_t i2c_config = I2C_MODE_CONTROLLER | I2C_SPEED_SET(bench_speeds[i].speed);
+
+		if (i2c_configure(i2c_dev, i2c_config) != 0) {
+			LOG_INF("I2C speed %u kHz not supported, skipping.", khz);
+			continue;
+		}
+
+		bench_reg_read(npmx_instance, khz);
+		bench_reg_write(npmx_instance, khz);
+		bench_adc_meas_all(npmx_instance, khz);
+		bench_int_service(npmx_instance, khz);
+		bench_shell(khz);
+	}
+
+	/* Restore the bus speed from devicetree. */
+	(void)i2c_configure(i2c_dev, I2C_MODE_CONTROLLER | i2c_map_dt_bitrate(I2C_DT_BITRATE));
+
+	LOG_INF("Benchmark done.");
+}
@@ -15,276 +15,151 @@
 #define LOG_MODULE_NAME charger
 LOG_MODULE_REGISTER(LOG_MODULE_NAME);
 
-/** @brief Possible events from requested PMIC device. */
-enum npm1300_charger_event_t {
-	/* Event registered when battery connection detected. */
-	APP_CHARGER_EVENT_BATTERY_DETECTED,
-	/* Event registered when battery connection removed. */
-	APP_CHARGER_EVENT_BATTERY_REMOVED,
-	/* Event registered when VBUS connection detected. */
-	APP_CHARGER_EVENT_VBUS_DETECTED,
-	/* Event registered when VBUS connection removed. */
-	APP_CHARGER_EVENT_VBUS_REMOVED,
-	/* Event registered when trickle charging started. */
-	APP_CHARGER_EVENT_CHARGING_TRICKE_STARTED,
-	/* Event registered when constant current charging started. */
-	APP_CHARGER_EVENT_CHARGING_CC_STARTED,
-	/* Event registered when constant voltage charging started. */
-	APP_CHARGER_EVENT_CHARGING_CV_STARTED,
-	/* Event registered when charging completed. */
-	APP_CHARGER_EVENT_CHARGING_COMPLETED,
-	/* Event registered when first low battery voltage alert detected. */
-	APP_CHARGER_EVENT_BATTERY_LOW_ALERT1,
-	/* Event registered when second low battery voltage alert detected. */
-	APP_CHARGER_EVENT_BATTERY_LOW_ALERT2,
+/** @brief Battery voltage alert levels, checked while discharging. */
+enum battery_alert {
+	BATTERY_ALERT_NONE, /* Battery voltage above the first alert threshold. */
+	BATTERY_ALERT_1, /* Battery voltage below the first alert threshold. */
+	BATTERY_ALERT_2, /* Battery voltage below the second alert threshold. */
 };
 
-/** @brief Possible nPM device working states. */
-enum npm1300_state_t {
-	/* State when VBUSIN disconnected and battery disconnected. */
-	APP_STATE_BATTERY_DISCONNECTED,
-	/* State when VBUSIN disconnected and battery connected. */
-	APP_STATE_BATTERY_CONNECTED,
-	/* State when VBUSIN connected and battery disconnected. */
-	APP_STATE_VBUS_CONNECTED_BATTERY_DISCONNECTED,
-	/* State when VBUSIN connected and battery connected. */
-	APP_STATE_VBUS_CONNECTED_BATTERY_CONNECTED,
-	/* State when VBUSIN connected, battery connected and charger in trickle mode. */
-	APP_STATE_VBUS_CONNECTED_CHARGING_TRICKE,
-	/* State when VBUSIN connected, battery connected and charger in constant current mode. */
-	APP_STATE_VBUS_CONNECTED_CHARGING_CC,
-	/* State when VBUSIN connected, battery connected and charger in constant voltage mode. */
-	APP_STATE_VBUS_CONNECTED_CHARGING_CV,
-	/* State when VBUSIN connected, battery connected and charger completed charging. */
-	APP_STATE_VBUS_CONNECTED_CHARGING_COMPLETED,
-	/* State when VBUSIN disconnected, battery connected. */
-	APP_STATE_VBUS_NOT_CONNECTED_DISCHARGING,
-	/* State when VBUSIN disconnected. */
-	/* Battery connected and battery voltage is below first alert threshold. */
-	APP_STATE_VBUS_NOT_CONNECTED_DISCHARGING_ALERT1,
-	/* State when VBUSIN disconnected. */
-	/* Battery connected and battery voltage is below second alert threshold. */
-	APP_STATE_VBUS_NOT_CONNECTED_DISCHARGING_ALERT2,
+/* Charging phase names. */
+static const char *const phase_names[] = {
+	[NPMX_DRIVER_CHARGE_PHASE_IDLE] = "IDLE",
+	[NPMX_DRIVER_CHARGE_PHASE_TRICKLE] = "TRICKLE",
+	[NPMX_DRIVER_CHARGE_PHASE_CC] = "CC",
+	[NPMX_DRIVER_CHARGE_PHASE_CV] = "CV",
+	[NPMX_DRIVER_CHARGE_PHASE_COMPLETED] = "COMPLETED",
+	[NPMX_DRIVER_CHARGE_PHASE_ERROR] = "ERROR",
 };
 
 /**
- * @brief Function for registering the new event received from PMIC device.
+ * @brief Function for printing the charger state tracked by the driver, if it changed.
  *
- * @param[in] event New event type.
+ * @param[in] pmic_dev Pointer to the nPM Zephyr device.
  */
-static void register_state_change(enum npm1300_charger_event_t event)
+static void state_print(const struct device *pmic_dev)
 {
-	static enum npm1300_state_t state = APP_STATE_BATTERY_DISCONNECTED;
-
-	switch (event) {
-	case APP_CHARGER_EVENT_BATTERY_DETECTED:
-		if (state == APP_STATE_BATTERY_DISCONNECTED) {
-			state = APP_STATE_BATTERY_CONNECTED;
-			LOG_INF("State: BATTERY_CONNECTED.");
-		}
-
-		if (state == APP_STATE_VBUS_CONNECTED_BATTERY_DISCONNECTED) {
-			state = APP_STATE_VBUS_CONNECTED_BATTERY_CONNECTED;
-			LOG_INF("State: VBUS_CONNECTED_BATTERY_CONNECTED.");
-		}
-
-		if (state == APP_STATE_VBUS_CONNECTED_CHARGING_TRICKE ||
-		    state == APP_STATE_VBUS_CONNECTED_CHARGING_CC ||
-		    state == APP_STATE_VBUS_CONNECTED_CHARGING_CV ||
-		    state == APP_STATE_VBUS_CONNECTED_CHARGING_COMPLETED) {
-			LOG_INF("State: BATTERY_CONNECTED.");
-		}
-		break;
-	case APP_CHARGER_EVENT_BATTERY_REMOVED:
-		if (state == APP_STATE_BATTERY_CONNECTED) {
-			state = APP_STATE_BATTERY_DISCONNECTED;
-			LOG_INF("State: BATTERY_DISCONNECTED.");
-		}
-
-		if (state == APP_STATE_VBUS_CONNECTED_BATTERY_CONNECTED ||
-		    state == APP_STATE_VBUS_CONNECTED_CHARGING_TRICKE ||
-		    state == APP_STATE_VBUS_CONNECTED_CHARGING_CC ||
-		    state == APP_STATE_VBUS_CONNECTED_CHARGING_CV ||
-		    state == APP_STATE_VBUS_CONNECTED_CHARGING_COMPLETED) {
-			state = APP_STATE_VBUS_CONNECTED_BATTERY_DISCONNECTED;
-			LOG_INF("State: VBUS_CONNECTED_BATTERY_DISCONNECTED.");
-		}
-		break;
-	case APP_CHARGER_EVENT_VBUS_DETECTED:
-		if (state == APP_STATE_VBUS_NOT_CONNECTED_DISCHARGING ||
-		    state == APP_STATE_VBUS_NOT_CONNECTED_DISCHARGING_ALERT1 ||
-		    state == APP_STATE_VBUS_NOT_CONNECTED_DISCHARGING_ALERT2) {
-			state = APP_STATE_VBUS_CONNECTED_BATTERY_CONNECTED;
-			LOG_INF("State: VBUS_CONNECTED_BATTERY_CONNECTED.");
-		}
-		if (state == APP_STATE_BATTERY_DISCONNECTED) {
-			state = APP_STATE_VBUS_CONNECTED_BATTERY_DISCONNECTED;
-			LOG_INF("State: VBUS_CONNECTED_BATTERY_DISCONNECTED.");
-		}
-		break;
-	case APP_CHARGER_EVENT_VBUS_REMOVED:
-		if (state == APP_STATE_VBUS_CONNECTED_CHARGING_TRICKE ||
-		    state == APP_STATE_VBUS_CONNECTED_CHARGING_CC ||
-		    state == APP_STATE_VBUS_CONNECTED_CHARGING_CV ||
-		    state == APP_STATE_VBUS_CONNECTED_CHARGING_COMPLETED ||
-		    state == APP_STATE_VBUS_CONNECTED_BATTERY_CONNECTED) {
-			state = APP_STATE_VBUS_NOT_CONNECTED_DISCHARGING;
-			LOG_INF("State: VBUS_NOT_CONNECTED_DISCHARGING.");
-		}
-		break;
-	case APP_CHARGER_EVENT_CHARGING_TRICKE_STARTED:
-		if (state != APP_STATE_VBUS_CONNECTED_CHARGING_TRICKE &&
-		    state != APP_STATE_VBUS_CONNECTED_CHARGING_CC &&
-		    state != APP_STATE_VBUS_CONNECTED_CHARGING_CV &&
-		    state != APP_STATE_VBUS_CONNECTED_CHARGING_COMPLETED) {
-			state = APP_STATE_VBUS_CONNECTED_CHARGING_TRICKE;
-			LOG_INF("State: VBUS_CONNECTED_CHARGING_TRICKE.");
-		}
-		break;
-	case APP_CHARGER_EVENT_CHARGING_CC_STARTED:
-		if (state != APP_STATE_VBUS_CONNECTED_CHARGING_CC &&
-		    state != APP_STATE_VBUS_CONNECTED_CHARGING_CV) {
-			state = APP_STATE_VBUS_CONNECTED_CHARGING_CC;
-			LOG_INF("State: VBUS_CONNECTED_CHARGING_CC.");
-		}
-		break;
-	case APP_CHARGER_EVENT_CHARGING_CV_STARTED:
-		if (state != APP_STATE_VBUS_CONNECTED_CHARGING_CV) {
-			state = APP_STATE_VBUS_CONNECTED_CHARGING_CV;
-			LOG_INF("State: VBUS_CONNECTED_CHARGING_CV.");
-		}
-		break;
-	case APP_CHARGER_EVENT_CHARGING_COMPLETED:
-		if (state != APP_STATE_VBUS_CONNECTED_CHARGING_COMPLETED) {
-			state = APP_STATE_VBUS_CONNECTED_CHARGING_COMPLETED;
-			LOG_INF("State: VBUS_CONNECTED_CHARGING_COMPLETED.");
-		}
-		break;
-	case APP_CHARGER_EVENT_BATTERY_LOW_ALERT1:
-		if (state == APP_STATE_VBUS_NOT_CONNECTED_DISCHARGING) {
-			state = APP_STATE_VBUS_NOT_CONNECTED_DISCHARGING_ALERT1;
-			LOG_INF("State: VBUS_NOT_CONNECTED_DISCHARGING_ALERT1.");
-		}
-		break;
-	case APP_CHARGER_EVENT_BATTERY_LOW_ALERT2:
-		if (state == APP_STATE_VBUS_NOT_CONNECTED_DISCHARGING ||
-		    state == APP_STATE_VBUS_NOT_CONNECTED_DISCHARGING_ALERT1) {
-			state = APP_STATE_VBUS_NOT_CONNECTED_DISCHARGING_ALERT2;
-			LOG_INF("State: VBUS_NOT_CONNECTED_DISCHARGING_ALERT2.");
-		}
-		break;
-
-	default:
-		LOG_INF("Unsupported event: %d.", event);
-		break;
+	static struct npmx_driver_charger_state last;
+	static bool printed;
+	struct npmx_driver_charger_state state;
+
+	/* No bus access, the state is kept by the driver. */
+	if (npmx_driver_charger_state_get(pmic_dev, &state) != 0) {
+		return;
+	}
+
+	if (!printed || (state.vbus_connected != last.vbus_connected) ||
+	    (state.battery_connected != last.battery_connected) || (state.phase != last.phase)) {
+		LOG_INF("State: VBUS %s, battery %s, charging %s.",
+			state.vbus_connected ? "CONNECTED" : "NOT_CONNECTED",
+			state.battery_connected ? "CONNECTED" : "DISCONNECTED",
+			phase_names[state.phase]);
+		last = state;
+		printed = true;
 	}
 }
 
 /**
- * @brief Function callback for VBUSIN events.
+ * @brief Function for handling VBUSIN and battery events.
  *
- * @param[in] p_pm Pointer to the instance of PMIC device.
- * @param[in] type Type of callback, should be always NPMX_CALLBACK_TYPE_EVENT_VBUSIN_VOLTAGE.
- * @param[in] mask Received event mask @ref npmx_event_group_vbusin_mask_t .
+ * @param[in] p_event     Pointer to the events.
+ * @param[in] p_user_data Unused.
  */
-static void vbusin_callback(npmx_instance_t *p_pm, npmx_callback_type_t type, uint8_t mask)
+static void state_handler(struct npmx_driver_event const *p_event, void *p_user_data)
 {
-	if (mask & (uint8_t)NPMX_EVENT_GROUP_VBUSIN_DETECTED_MASK) {
-		register_state_change(APP_CHARGER_EVENT_VBUS_DETECTED);
-	}
+	ARG_UNUSED(p_user_data);
 
-	if (mask & (uint8_t)NPMX_EVENT_GROUP_VBUSIN_REMOVED_MASK) {
-		register_state_change(APP_CHARGER_EVENT_VBUS_REMOVED);
-	}
+	state_print(p_event->p_dev);
 }
 
 /**
- * @brief Function callback for ADC events.
+ * @brief Function for handling charger status events.
  *
- * @param[in] p_pm Pointer to the instance of PMIC device.
- * @param[in] type Type of callback, should be always NPMX_CALLBACK_TYPE_EVENT_VBUSIN_VOLTAGE.
- * @param[in] mask Received event mask @ref npmx_event_group_vbusin_mask_t .
+ * @param[in] p_event     Pointer to the events.
+ * @param[in] p_user_data Unused.
  */
-static void adc_callback(npmx_instance_t *p_pm, npmx_callback_type_t type, uint8_t mask)
+static void charger_status_handler(struct npmx_driver_event const *p_event, void *p_user_data)
 {
-	if ((mask & (uint8_t)NPMX_EVENT_GROUP_ADC_BAT_READY_MASK)) {
-		static int32_t battery_voltage_millivolts_last;
-		int32_t battery_voltage_millivolts;
-
-		if (npmx_adc_meas_get(npmx_adc_get(p_pm, 0), NPMX_ADC_MEAS_VBAT,
-				      &battery_voltage_millivolts) == NPMX_SUCCESS) {
-			if (battery_voltage_millivolts != battery_voltage_millivolts_last) {
-				battery_voltage_millivolts_last = battery_voltage_millivolts;
-				LOG_INF("Battery:\t %d mV.", battery_voltage_millivolts);
-			}
-			if (battery_voltage_millivolts < CONFIG_BATTERY_VOLTAGE_THRESHOLD_2) {
-				register_state_change(APP_CHARGER_EVENT_BATTERY_LOW_ALERT2);
-			} else if (battery_voltage_millivolts <
-				   CONFIG_BATTERY_VOLTAGE_THRESHOLD_1) {
-				register_state_change(APP_CHARGER_EVENT_BATTERY_LOW_ALERT1);
-			}
-		}
+	npmx_instance_t *npmx_instance = npmx_driver_instance_get(p_event->p_dev);
+
+	ARG_UNUSED(p_user_data);
+
+	if (p_event->mask & (uint8_t)NPMX_EVENT_GROUP_CHARGER_ERROR_MASK) {
+		/* Check charger errors and run default debug callbacks to log error bits. */
+		npmx_charger_errors_check(npmx_charger_get(npmx_instance, 0));
 	}
+
+	state_print(p_event->p_dev);
 }
 
 /**
- * @brief Function callback for charger status events.
+ * @brief Function for handling ADC events.
  *
- * @param[in] p_pm Pointer to the instance of PMIC device.
- * @param[in] type Type of callback, should always be NPMX_CALLBACK_TYPE_EVENT_BAT_CHAR_STATUS.
- * @param[in] mask Received event mask @ref npmx_event_group_charger_mask_t .
+ * @param[in] p_event     Pointer to the events.
+ * @param[in] p_user_data Unused.
  */
-static void charger_status_callback(npmx_instance_t *p_pm, npmx_callback_type_t type, uint8_t mask)
+static void adc_handler(struct npmx_driver_event const *p_event, void *p_user_data)
 {
-	npmx_charger_t *charger_instance = npmx_charger_get(p_pm, 0);
-
-	if (mask & (uint8_t)NPMX_EVENT_GROUP_CHARGER_ERROR_MASK) {
-		/* Check charger errors and run default debug callbacks to log error bits. */
-		npmx_charger_errors_check(charger_instance);
-	}
-
-	npmx_charger_status_mask_t status;
+	static int32_t battery_voltage_millivolts_last;
+	static enum battery_alert alert_last = BATTERY_ALERT_NONE;
+	npmx_instance_t *npmx_instance = npmx_driver_instance_get(p_event->p_dev);
+	struct npmx_driver_charger_state state;
+	enum battery_alert alert = BATTERY_ALERT_NONE;
+	int32_t battery_voltage_millivolts;
 
-	/* Delay required for status stabilization. */
-	k_msleep(5);
+	ARG_UNUSED(p_user_data);
 
-	if (npmx_charger_status_get(charger_instance, &status) == NPMX_SUCCESS) {
-		if (status & NPMX_CHARGER_STATUS_TRICKLE_CHARGE_MASK) {
-			register_state_change(APP_CHARGER_EVENT_CHARGING_TRICKE_STARTED);
-		}
+	if (npmx_adc_meas_get(npmx_adc_get(npmx_instance, 0), NPMX_ADC_MEAS_VBAT,
+			      &battery_voltage_millivolts) != NPMX_SUCCESS) {
+		return;
+	}
 
-		if (status & NPMX_CHARGER_STATUS_CONSTANT_CURRENT_MASK) {
-			register_state_change(APP_CHARGER_EVENT_CHARGING_CC_STARTED);
-		}
+	if (battery_voltage_millivolts != battery_voltage_millivolts_last) {
+		battery_voltage_millivolts_last = battery_voltage_millivolts;
+		LOG_INF("Battery:\t %d mV.", battery_voltage_millivolts);
+	}
 
-		if (status & NPMX_CHARGER_STATUS_CONSTANT_VOLTAGE_MASK) {
-			register_state_change(APP_CHARGER_EVENT_CHARGING_CV_STARTED);
-		}
+	if (npmx_driver_charger_state_get(p_event->p_dev, &state) != 0) {
+		return;
+	}
 
-		if (status & NPMX_CHARGER_STATUS_COMPLETED_MASK) {
-			register_state_change(APP_CHARGER_EVENT_CHARGING_COMPLETED);
-		}
+	/* Alerts are reported while discharging, the alert level only rises until VBUS is
+	 * connected.
+	 */
+	if (state.vbus_connected) {
+		alert_last = BATTERY_ALERT_NONE;
+		return;
 	}
-}
 
-/**
- * @brief Function callback for battery events.
- *
- * @param[in] p_pm Pointer to the instance of PMIC device.
- * @param[in] type Type of callback, should always be NPMX_CALLBACK_TYPE_EVENT_BAT_CHAR_BAT.
- * @param[in] mask Received event mask @ref npmx_event_group_battery_mask_t .
- */
-static void charger_battery_callback(npmx_instance_t *p_pm, npmx_callback_type_t type, uint8_t mask)
-{
-	if (mask & (uint8_t)NPMX_EVENT_GROUP_BATTERY_DETECTED_MASK) {
-		register_state_change(APP_CHARGER_EVENT_BATTERY_DETECTED);
+	if (battery_voltage_millivolts < CONFIG_BATTERY_VOLTAGE_THRESHOLD_2) {
+		alert = BATTERY_ALERT_2;
+	} else if (battery_voltage_millivolts < CONFIG_BATTERY_VOLTAGE_THRESHOLD_1) {
+		alert = BATTERY_ALERT_1;
 	}
 
-	if (mask & (uint8_t)NPMX_EVENT_GROUP_BATTERY_REMOVED_MASK) {
-		register_state_change(APP_CHARGER_EVENT_BATTERY_REMOVED);
+	if (state.battery_connected && (alert > alert_last)) {
+		LOG_INF("State: VBUS_NOT_CONNECTED_DISCHARGING_ALERT%d.", (int)alert);
+		alert_last = alert;
 	}
 }
 
+/* Subscribers of events changing the charger state. */
+NPMX_DRIVER_EVENT_SUBSCRIBER_DEFINE(vbusin_subscriber, NPMX_CALLBACK_TYPE_EVENT_VBUSIN_VOLTAGE,
+				    NPMX_EVENT_GROUP_VBUSIN_DETECTED_MASK |
+					    NPMX_EVENT_GROUP_VBUSIN_REMOVED_MASK,
+				    state_handler, NULL);
+NPMX_DRIVER_EVENT_SUBSCRIBER_DEFINE(battery_subscriber, NPMX_CALLBACK_TYPE_EVENT_BAT_CHAR_BAT,
+				    NPMX_EVENT_GROUP_BATTERY_DETECTED_MASK |
+					    NPMX_EVENT_GROUP_BATTERY_REMOVED_MASK,
+				    state_handler, NULL);
+NPMX_DRIVER_EVENT_SUBSCRIBER_DEFINE(charger_status_subscriber,
+				    NPMX_CALLBACK_TYPE_EVENT_BAT_CHAR_STATUS, UINT8_MAX,
+				    charger_status_handler, NULL);
+
+/* Subscriber of battery voltage measurements. */
+NPMX_DRIVER_EVENT_SUBSCRIBER_DEFINE(adc_subscriber, NPMX_CALLBACK_TYPE_EVENT_ADC,
+				    NPMX_EVENT_GROUP_ADC_BAT_READY_MASK, adc_handler, NULL);
+
 void main(void)
 {
 	const struct device *pmic_dev = DEVICE_DT_GET(DT_NODELABEL(npm_0));
@@ -302,28 +177,14 @@ void main(void)
 	/* Get pointer to CHARGER instance. */
 	npmx_charger_t *charger_instance = npmx_charger_get(npmx_instance, 0);
 
-	uint8_t mask;
-
-	/* Check if VBUS is connected. */
-	npmx_vbusin_vbus_status_get(npmx_vbusin_get(npmx_instance, 0), &mask);
-	if (mask & NPMX_VBUSIN_STATUS_CONNECTED_MASK) {
-		register_state_change(APP_CHARGER_EVENT_VBUS_DETECTED);
-	}
-
-	/* Register callback for VBUS events. */
-	npmx_core_register_cb(npmx_instance, vbusin_callback,
-			      NPMX_CALLBACK_TYPE_EVENT_VBUSIN_VOLTAGE);
-
-	/* Register callback for ADC events. */
-	npmx_core_register_cb(npmx_instance, adc_callback, NPMX_CALLBACK_TYPE_EVENT_ADC);
-
-	/* Register callback for battery events. */
-	npmx_core_register_cb(npmx_instance, charger_battery_callback,
-			      NPMX_CALLBACK_TYPE_EVENT_BAT_CHAR_BAT);
+	/* Subscribe to events. The charger state itself is tracked by the driver. */
+	npmx_driver_event_subscribe(pmic_dev, &vbusin_subscriber);
+	npmx_driver_event_subscribe(pmic_dev, &battery_subscriber);
+	npmx_driver_event_subscribe(pmic_dev, &charger_status_subscriber);
+	npmx_driver_event_subscribe(pmic_dev, &adc_subscriber);
 
-	/* Register callback for charger status events. */
-	npmx_core_register_cb(npmx_instance, charger_status_callback,
-			      NPMX_CALLBACK_TYPE_EVENT_BAT_CHAR_STATUS);
+	/* Print the state read at the driver initialization. */
+	state_print(pmic_dev);
 
 	/* Check reset errors and run default debug callbacks to log error bits. */
 	npmx_errlog_reset_errors_check(npmx_errlog_get(npmx_instance, 0));
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <zephyr/logging/log.h>
+#include <zephyr/kernel.h>
+#include <zephyr/linker/section_tags.h>
+#include <zephyr/sys/crc.h>
+#include "checkpoint.h"
+#include <stdlib.h>
+
+#if defined(CONFIG_FUEL_GAUGE_CHECKPOINT_NVS)
+#include <zephyr/drivers/flash.h>
+#include <zephyr/fs/nvs.h>
+#include <zephyr/storage/flash_map.h>
+#endif
+
+LOG_MODULE_DECLARE(fuel_gauge);
+
+/* Value of the record magic field, "FGCP". */
+#define RECORD_MAGIC 0x50434746UL
+
+#if defined(CONFIG_FUEL_GAUGE_CHECKPOINT_NVS)
+/* Flash partition and NVS entry of the checkpoint. */
+#define NVS_PARTITION	  storage_partition
+#define NVS_SECTOR_COUNT  2
+#define NVS_CHECKPOINT_ID 1
+#endif
+
+/* Checkpoint protected with a checksum. */
+struct record {
+	uint32_t magic; /* Marks the record as valid. */
+	struct checkpoint checkpoint;
+	uint32_t crc; /* CRC-32 of the checkpoint. */
+};
+
+/* Copy kept in RAM retained over SoC resets. */
+static __noinit struct record retained;
+
+#if defined(CONFIG_FUEL_GAUGE_CHECKPOINT_NVS)
+static struct nvs_fs fs;
+
+static bool fs_mounted;
+
+/* State of Charge of the checkpoint last written to flash. */
+static int32_t nvs_soc;
+#endif
+
+static uint32_t record_crc(struct record const *p_record)
+{
+	return crc32_ieee((const uint8_t *)&p_record->checkpoint, sizeof(p_record->checkpoint));
+}
+
+static bool record_valid(struct record const *p_record)
+{
+	return (p_record->magic == RECORD_MAGIC) && (p_record->crc == record_crc(p_record));
+}
+
+static void record_set(struct record *p_record, struct checkpoint const *p_checkpoint)
+{
+	p_record->magic = RECORD_MAGIC;
+	p_record->checkpoint = *p_checkpoint;
+	p_record->crc = record_crc(p_record);
+}
+
+#if defined(CONFIG_FUEL_GAUGE_CHECKPOINT_NVS)
+static bool nvs_record_read(struct record *p_record)
+{
+	ssize_t len;
+
+	if (!fs_mounted) {
+		return false;
+	}
+
+	len = nvs_read(&fs, NVS_CHECKPOINT_ID, p_record, sizeof(*p_record));
+
+	return (len == sizeof(*p_record)) && record_valid(p_record);
+}
+#endif
+
+int checkpoint_init(void)
+{
+#if defined(CONFIG_FUEL_GAUGE_CHECKPOINT_NVS)
+	struct flash_pages_info info;
+	struct record record;
+	int ret;
+
+	fs.flash_device = FIXED_PARTITION_DEVICE(NVS_PARTITION);
+	fs.offset = FIXED_PARTITION_OFFSET(NVS_PARTITION);
+
+	if (!device_is_ready(fs.flash_device)) {
+		return -ENODEV;
+	}
+
+	ret = flash_get_page_info_by_offs(fs.flash_device, fs.offset, &info);
+	if (ret < 0) {
+		return ret;
+	}
+
+	fs.sector_size = info.size;
+	fs.sector_count = NVS_SECTOR_COUNT;
+
+	ret = nvs_mount(&fs);
+	if (ret < 0) {
+		return ret;
+	}
+
+	fs_mounted = true;
+
+	/* The first write after boot is not needed if the stored State of Charge is current. */
+	nvs_soc = nvs_record_read(&record) ? record.checkpoint.soc : INT32_MIN / 2;
+#endif
+
+	return 0;
+}
+
+bool checkpoint_restore(struct checkpoint *p_checkpoint)
+{
+	if (record_valid(&retained)) {
+		*p_checkpoint = retained.checkpoint;
+		return true;
+	}
+
+#if defined(CONFIG_FUEL_GAUGE_CHECKPOINT_NVS)
+	struct record record;
+
+	if (nvs_record_read(&record)) {
+		*p_checkpoint = record.checkpoint;
+		return true;
+	}
+#endif
+
+	return false;
+}
+
+void checkpoint_save(struct checkpoint const *p_checkpoint)
+{
+	record_set(&retained, p_checkpoint);
+
+#if defined(CONFIG_FUEL_GAUGE_CHECKPOINT_NVS)
+	if (!fs_mounted ||
+	    (abs(p_checkpoint->soc - nvs_soc) < CONFIG_FUEL_GAUGE_CHECKPOINT_NVS_SOC_STEP)) {
+		return;
+	}
+
+	if (nvs_write(&fs, NVS_CHECKPOINT_ID, &retained, sizeof(retained)) < 0) {
+		LOG_WRN("Writing checkpoint to flash failed.");
+		return;
+	}
+
+	nvs_soc = p_checkpoint->soc;
+#endif
+}
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef __CHECKPOINT_H__
+#define __CHECKPOINT_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/** @brief Battery conditions saved while the battery load is stable. */
+struct checkpoint {
+	int32_t voltage; /* Average battery voltage in millivolts. */
+	int32_t current; /* Average battery current in milliamperes, negative for charge. */
+	int32_t soc; /* State of Charge in hundredths of a percent. */
+};
+
+/**
+ * @brief Function for initializing the checkpoint storage.
+ *
+ * @retval 0     On success.
+ * @retval other Errno codes.
+ */
+int checkpoint_init(void);
+
+/**
+ * @brief Function for reading the last saved checkpoint.
+ *
+ * The copy in RAM retained over SoC resets is used if it is valid. Otherwise, with
+ * @kconfig{CONFIG_FUEL_GAUGE_CHECKPOINT_NVS} enabled, the copy in flash is used.
+ *
+ * @param[out] p_checkpoint Pointer to the checkpoint.
+ *
+ * @retval true  Checkpoint read.
+ * @retval false No valid checkpoint.
+ */
+bool checkpoint_restore(struct checkpoint *p_checkpoint);
+
+/**
+ * @brief Function for saving the checkpoint.
+ *
+ * The checkpoint is always saved in retained RAM. The copy in flash is written only when the
+ * State of Charge changed by @kconfig{CONFIG_FUEL_GAUGE_CHECKPOINT_NVS_SOC_STEP} since the last
+ * write, to limit flash wear.
+ *
+ * @param[in] p_checkpoint Pointer to the checkpoint.
+ */
+void checkpoint_save(struct checkpoint const *p_checkpoint);
+
+#endif /* __CHECKPOINT_H__ */
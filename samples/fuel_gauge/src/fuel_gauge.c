@@ -7,9 +7,12 @@
 #include <zephyr/logging/log.h>
 #include <zephyr/kernel.h>
 #include <npmx_driver.h>
+#include <npmx_adc_sampler.h>
 #include "nrf_fuel_gauge.h"
 #include "fuel_gauge.h"
+#include "checkpoint.h"
 #include <math.h>
+#include <stdlib.h>
 
 #define LOG_MODULE_NAME fuel_gauge
 LOG_MODULE_REGISTER(LOG_MODULE_NAME);
@@ -18,38 +21,211 @@ static const struct battery_model battery_model = {
 #include "battery_model.inc"
 };
 
-static float max_charge_current;
-static float term_charge_current;
 static int64_t ref_time;
 
-static int read_sensors(npmx_instance_t *const p_pm, float *voltage, float *current, float *temp)
+static const struct device *pmic_dev = DEVICE_DT_GET(DT_NODELABEL(npm_0));
+
+static struct npmx_adc_sampler adc_sampler;
+
+/* Battery current deviation from its average, in milliamperes, above which the load is
+ * considered changing.
+ */
+#define IBAT_DEVIATION_MA 5
+
+/* Additional battery current deviation allowed, as a fraction (1/n) of the average current. */
+#define IBAT_DEVIATION_RATIO 8
+
+/* Weight (1/n) of the newest sample in the battery voltage and current averages. */
+#define AVERAGE_WEIGHT 4
+
+/* Time over which the State of Charge slope is measured. */
+#define SOC_SLOPE_WINDOW_MS 60000
+
+/* State of Charge slope, in hundredths of a percent per window, above which the update period
+ * is not extended.
+ */
+#define SOC_SLOPE_MAX 5
+
+/* Maximum difference between the voltage measured at boot and the voltage of the checkpoint.
+ * Above it, the battery is assumed to have changed and the checkpoint is not used.
+ */
+#define CHECKPOINT_VOLTAGE_TOLERANCE_MV 100
+
+/* State of the update period scheduler. */
+static struct {
+	uint32_t period_ms; /* Current sampling period. */
+	int32_t vbat_avg; /* Average battery voltage in millivolts. */
+	int32_t ibat_avg; /* Average battery current in milliamperes. */
+	bool stable; /* Battery load stable at the last update. */
+	int32_t soc_ref; /* State of Charge at the start of the slope window. */
+	int64_t soc_ref_time; /* Uptime at the start of the slope window, negative if none. */
+	bool soc_steep; /* State of Charge slope in the last window above the limit. */
+	atomic_t wakeup; /* Set by charger and VBUS events. */
+} scheduler;
+
+/* Nominal and termination charge current in milliamperes, needed for TTF calculation. */
+#define MAX_CHARGE_CURRENT  CONFIG_CHARGING_CURRENT
+#define TERM_CHARGE_CURRENT (CONFIG_CHARGING_CURRENT / 10)
+
+/*
+ * The nRF Fuel Gauge library takes values in SI units as float. The conversions are limited
+ * to the functions below, so the rest of the sample uses integers only.
+ */
+
+/* Convert the value in milli-units to the value in base units. */
+static float milli_to_float(int32_t value)
+{
+	return (float)value / 1000.0f;
+}
+
+/* Convert the time estimate in seconds to an integer. */
+static int32_t time_to_int(float time)
+{
+	return (isnan(time) || isinf(time)) ? FUEL_GAUGE_TIME_UNKNOWN : (int32_t)time;
+}
+
+static void fuel_gauge_process(int32_t voltage, int32_t current, int32_t temp, int64_t delta_ms,
+			       struct fuel_gauge_state *p_state)
+{
+	float soc = nrf_fuel_gauge_process(milli_to_float(voltage), milli_to_float(current),
+					   milli_to_float(temp), (float)delta_ms / 1000.0f, NULL);
+
+	p_state->voltage = voltage;
+	p_state->current = current;
+	p_state->temp = temp;
+	p_state->soc = (int32_t)(soc * 100.0f);
+	p_state->tte = time_to_int(nrf_fuel_gauge_tte_get());
+	p_state->ttf = time_to_int(nrf_fuel_gauge_ttf_get(-milli_to_float(MAX_CHARGE_CURRENT),
+							  -milli_to_float(TERM_CHARGE_CURRENT)));
+}
+
+static void fuel_gauge_log(struct fuel_gauge_state const *p_state)
+{
+#if defined(CONFIG_FUEL_GAUGE_FLOAT_LOG)
+	LOG_INF("V: %.3f, I: %.3f, T: %.2f, SoC: %.2f, TTE: %d, TTF: %d",
+		(double)milli_to_float(p_state->voltage), (double)milli_to_float(p_state->current),
+		(double)milli_to_float(p_state->temp), (double)p_state->soc / 100.0, p_state->tte,
+		p_state->ttf);
+#else
+	LOG_INF("V: %s%d.%03d, I: %s%d.%03d, T: %s%d.%02d, SoC: %d.%02d, TTE: %d, TTF: %d",
+		(p_state->voltage < 0) ? "-" : "", abs(p_state->voltage) / 1000,
+		abs(p_state->voltage) % 1000, (p_state->current < 0) ? "-" : "",
+		abs(p_state->current) / 1000, abs(p_state->current) % 1000,
+		(p_state->temp < 0) ? "-" : "", abs(p_state->temp) / 1000,
+		(abs(p_state->temp) % 1000) / 10, p_state->soc / 100, p_state->soc % 100,
+		p_state->tte, p_state->ttf);
+#endif
+}
+
+static bool charging_check(int32_t current)
+{
+	struct npmx_driver_charger_state charger_state;
+
+	if (npmx_driver_charger_state_get(pmic_dev, &charger_state) != 0) {
+		/* Charger state tracking disabled, the battery current is used instead. */
+		return current < 0;
+	}
+
+	return (charger_state.phase == NPMX_DRIVER_CHARGE_PHASE_TRICKLE) ||
+	       (charger_state.phase == NPMX_DRIVER_CHARGE_PHASE_CC) ||
+	       (charger_state.phase == NPMX_DRIVER_CHARGE_PHASE_CV);
+}
+
+/**
+ * @brief Function for computing the sampling period after the sample.
+ *
+ * The period is shortened to the minimum when the battery current deviates from its average or
+ * after charger and VBUS events. It is kept while the State of Charge changes quickly, and doubled
+ * otherwise, up to the limit for the current charging state.
+ */
+static uint32_t period_next(struct fuel_gauge_state const *p_state, int64_t timestamp)
+{
+	int32_t deviation = abs(p_state->current - scheduler.ibat_avg);
+	uint32_t period_max = charging_check(p_state->current) ?
+				      CONFIG_FUEL_GAUGE_PERIOD_CHARGING_MS :
+				      CONFIG_FUEL_GAUGE_PERIOD_MAX_MS;
+	bool transient = atomic_clear(&scheduler.wakeup) ||
+			 (deviation > (IBAT_DEVIATION_MA +
+				       (abs(scheduler.ibat_avg) / IBAT_DEVIATION_RATIO)));
+
+	scheduler.vbat_avg += (p_state->voltage - scheduler.vbat_avg) / AVERAGE_WEIGHT;
+	scheduler.ibat_avg += (p_state->current - scheduler.ibat_avg) / AVERAGE_WEIGHT;
+	scheduler.stable = !transient;
+
+	if (scheduler.soc_ref_time < 0) {
+		/* First sample, the slope window starts. */
+		scheduler.soc_ref = p_state->soc;
+		scheduler.soc_ref_time = timestamp;
+	} else if ((timestamp - scheduler.soc_ref_time) >= SOC_SLOPE_WINDOW_MS) {
+		scheduler.soc_steep = (abs(p_state->soc - scheduler.soc_ref) * SOC_SLOPE_WINDOW_MS) >
+				      (SOC_SLOPE_MAX * (timestamp - scheduler.soc_ref_time));
+		scheduler.soc_ref = p_state->soc;
+		scheduler.soc_ref_time = timestamp;
+	}
+
+	if (transient) {
+		return CONFIG_FUEL_GAUGE_PERIOD_MIN_MS;
+	}
+
+	if (scheduler.soc_steep) {
+		return MIN(scheduler.period_ms, period_max);
+	}
+
+	return MIN(scheduler.period_ms * 2, period_max);
+}
+
+static void charger_event_handler(struct npmx_driver_event const *p_event, void *p_user_data)
+{
+	ARG_UNUSED(p_event);
+	ARG_UNUSED(p_user_data);
+
+	/* Sample the battery right away and continue at the highest rate. */
+	atomic_set(&scheduler.wakeup, 1);
+	(void)npmx_adc_sampler_trigger(&adc_sampler);
+}
+
+/* Subscribers of events changing the battery load. */
+NPMX_DRIVER_EVENT_SUBSCRIBER_DEFINE(vbusin_subscriber, NPMX_CALLBACK_TYPE_EVENT_VBUSIN_VOLTAGE,
+				    NPMX_EVENT_GROUP_VBUSIN_DETECTED_MASK |
+					    NPMX_EVENT_GROUP_VBUSIN_REMOVED_MASK,
+				    charger_event_handler, NULL);
+NPMX_DRIVER_EVENT_SUBSCRIBER_DEFINE(charger_status_subscriber,
+				    NPMX_CALLBACK_TYPE_EVENT_BAT_CHAR_STATUS, UINT8_MAX,
+				    charger_event_handler, NULL);
+
+static int read_sensors(npmx_instance_t *const p_pm, npmx_adc_meas_all_t *meas)
 {
 	npmx_adc_t *adc_instance = npmx_adc_get(p_pm, 0);
-	npmx_adc_meas_all_t meas;
+	int ret;
+
+	/* Send triggering of both measurements in a single transfer. */
+	ret = npmx_driver_batch_begin(pmic_dev);
+	if (ret < 0) {
+		return ret;
+	}
 
-	if (npmx_adc_meas_all_get(adc_instance, &meas) != NPMX_SUCCESS) {
+	if (npmx_adc_meas_all_get(adc_instance, meas) != NPMX_SUCCESS) {
 		LOG_ERR("Reading ADC measurements failed.");
+		npmx_driver_batch_end(pmic_dev);
 		return -EIO;
 	}
 
 	if (npmx_adc_task_trigger(adc_instance, NPMX_ADC_TASK_SINGLE_SHOT_VBAT) != NPMX_SUCCESS) {
 		LOG_ERR("Triggering VBAT measurement failed.");
+		npmx_driver_batch_end(pmic_dev);
 		return -EIO;
 	}
 
 	if (npmx_adc_task_trigger(adc_instance, NPMX_ADC_TASK_SINGLE_SHOT_NTC) != NPMX_SUCCESS) {
 		LOG_ERR("Triggering NTC measurement failed.");
+		npmx_driver_batch_end(pmic_dev);
 		return -EIO;
 	}
 
-	/* Convert current in milliamperes to current in amperes. */
-	*current = (float)meas.values[NPMX_ADC_MEAS_VBAT2_IBAT] / 1000.0f;
-
-	/* Convert temperature in millidegrees Celsius to temperature in Celsius */
-	*temp = (float)meas.values[NPMX_ADC_MEAS_BAT_TEMP] / 1000.0f;
-
-	/* Convert voltage in millivolts to voltage in volts. */
-	*voltage = (float)meas.values[NPMX_ADC_MEAS_VBAT] / 1000.0f;
+	if (npmx_driver_batch_end(pmic_dev) != 0) {
+		LOG_ERR("Triggering measurements failed.");
+		return -EIO;
+	}
 
 	return 0;
 }
@@ -57,49 +233,101 @@ static int read_sensors(npmx_instance_t *const p_pm, float *voltage, float *curr
 int fuel_gauge_init(npmx_instance_t *const p_pm)
 {
 	struct nrf_fuel_gauge_init_parameters parameters = { .model = &battery_model };
+	struct checkpoint checkpoint;
+	npmx_adc_meas_all_t meas;
 	int ret;
 
-	ret = read_sensors(p_pm, &parameters.v0, &parameters.i0, &parameters.t0);
+	ret = read_sensors(p_pm, &meas);
 	if (ret < 0) {
 		return ret;
 	}
 
-	/* Store charge nominal and termination current, needed for ttf calculation */
-	max_charge_current = CONFIG_CHARGING_CURRENT / 1000.0f;
-	term_charge_current = max_charge_current / 10.f;
+	parameters.v0 = milli_to_float(meas.values[NPMX_ADC_MEAS_VBAT]);
+	parameters.i0 = milli_to_float(meas.values[NPMX_ADC_MEAS_VBAT2_IBAT]);
+	parameters.t0 = milli_to_float(meas.values[NPMX_ADC_MEAS_BAT_TEMP]);
+
+	if (checkpoint_init() < 0) {
+		LOG_WRN("Checkpoint storage not available.");
+	}
+
+	/* Start from the averaged conditions of the last stable load, instead of a single sample
+	 * taken during the boot load.
+	 */
+	if (checkpoint_restore(&checkpoint) &&
+	    (abs(checkpoint.voltage - meas.values[NPMX_ADC_MEAS_VBAT]) <=
+	     CHECKPOINT_VOLTAGE_TOLERANCE_MV)) {
+		LOG_INF("Checkpoint restored, SoC: %d.%02d", checkpoint.soc / 100,
+			checkpoint.soc % 100);
+		parameters.v0 = milli_to_float(checkpoint.voltage);
+		parameters.i0 = milli_to_float(checkpoint.current);
+	}
 
 	nrf_fuel_gauge_init(&parameters, NULL);
 
 	ref_time = k_uptime_get();
 
+	scheduler.period_ms = CONFIG_FUEL_GAUGE_PERIOD_MIN_MS;
+	scheduler.vbat_avg = meas.values[NPMX_ADC_MEAS_VBAT];
+	scheduler.ibat_avg = meas.values[NPMX_ADC_MEAS_VBAT2_IBAT];
+	scheduler.soc_ref_time = -1;
+
+	/* Further measurements are taken in the background, at the rate adapted to the load. */
+	npmx_adc_sampler_init(&adc_sampler, pmic_dev);
+
+	ret = npmx_adc_sampler_start(&adc_sampler, scheduler.period_ms);
+	if (ret < 0) {
+		LOG_ERR("Starting ADC sampling failed.");
+		return ret;
+	}
+
+	(void)npmx_driver_event_subscribe(pmic_dev, &vbusin_subscriber);
+	(void)npmx_driver_event_subscribe(pmic_dev, &charger_status_subscriber);
+
 	return 0;
 }
 
 int fuel_gauge_update(npmx_instance_t *const p_pm)
 {
-	float voltage;
-	float current;
-	float temp;
-	float soc;
-	float tte;
-	float ttf;
-	float delta;
-	int ret;
+	struct npmx_adc_sample samples[CONFIG_NPMX_ADC_SAMPLER_RING_SIZE];
+	struct fuel_gauge_state state;
+	struct checkpoint checkpoint;
+	size_t count;
 
-	ret = read_sensors(p_pm, &voltage, &current, &temp);
-	if (ret < 0) {
-		LOG_ERR("Error: Could not read data from charger device.");
-		return ret;
+	ARG_UNUSED(p_pm);
+
+	/* Sleep until new samples are available and process all of them. */
+	count = npmx_adc_sampler_get(&adc_sampler, samples, ARRAY_SIZE(samples), K_FOREVER);
+
+	/* The same samples are integrated into the power account of the driver. */
+	(void)npmx_driver_power_account_add(pmic_dev, samples, count);
+
+	for (size_t i = 0; i < count; i++) {
+		/* Use the time between measurements, so that processing delays do not matter. */
+		fuel_gauge_process(samples[i].vbat, samples[i].ibat, samples[i].bat_temp,
+				   samples[i].timestamp - ref_time, &state);
+		ref_time = samples[i].timestamp;
+
+		fuel_gauge_log(&state);
 	}
 
-	delta = (float)k_uptime_delta(&ref_time) / 1000.f;
+	if (count > 0) {
+		uint32_t period_ms = period_next(&state, samples[count - 1].timestamp);
 
-	soc = nrf_fuel_gauge_process(voltage, current, temp, delta, NULL);
-	tte = nrf_fuel_gauge_tte_get();
-	ttf = nrf_fuel_gauge_ttf_get(-max_charge_current, -term_charge_current);
+		if (period_ms != scheduler.period_ms) {
+			LOG_DBG("Update period: %u ms", period_ms);
+			scheduler.period_ms = period_ms;
+			(void)npmx_adc_sampler_period_set(&adc_sampler, period_ms);
+		}
 
-	LOG_INF("V: %.3f, I: %.3f, T: %.2f, SoC: %.2f, TTE: %.0f, TTF: %.0f", voltage, current,
-		temp, soc, tte, ttf);
+		if (scheduler.stable) {
+			checkpoint = (struct checkpoint){
+				.voltage = scheduler.vbat_avg,
+				.current = scheduler.ibat_avg,
+				.soc = state.soc,
+			};
+			checkpoint_save(&checkpoint);
+		}
+	}
 
 	return 0;
 }
@@ -9,6 +9,19 @@
 
 #include <npmx_driver.h>
 
+/** @brief Value of the time estimate which is not available. */
+#define FUEL_GAUGE_TIME_UNKNOWN (-1)
+
+/** @brief Fuel gauge state in integer units. */
+struct fuel_gauge_state {
+	int32_t voltage; /* Battery voltage in millivolts. */
+	int32_t current; /* Battery current in milliamperes, negative for charge. */
+	int32_t temp; /* Battery temperature in millidegrees Celsius. */
+	int32_t soc; /* State of Charge in hundredths of a percent. */
+	int32_t tte; /* Time to Empty in seconds or @ref FUEL_GAUGE_TIME_UNKNOWN. */
+	int32_t ttf; /* Time to Full in seconds or @ref FUEL_GAUGE_TIME_UNKNOWN. */
+};
+
 /**
  * @brief Function for initializing the fuel gauge module.
  *
@@ -20,7 +33,8 @@
 int fuel_gauge_init(npmx_instance_t *const p_pm);
 
 /**
- * @brief Function for periodically updating the fuel gauge module with battery voltage, current and temperature.
+ * @brief Function for waiting for new battery voltage, current and temperature samples and
+ *        updating the fuel gauge module with them.
  *
  * @param[in] p_pm Pointer to the instance of PMIC device.
  *
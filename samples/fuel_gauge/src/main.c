@@ -14,21 +14,8 @@
 #define LOG_MODULE_NAME main
 LOG_MODULE_REGISTER(LOG_MODULE_NAME);
 
-/**
- * @brief Callback function to be used when VBUSIN VOLTAGE event occurs.
- *
- * @param[in] p_pm Pointer to the instance of PMIC device.
- * @param[in] type Callback type. Should be @ref NPMX_CALLBACK_TYPE_EVENT_VBUSIN_VOLTAGE.
- * @param[in] mask Received event interrupt mask.
- */
-void vbusin_voltage_callback(npmx_instance_t *p_pm, npmx_callback_type_t type, uint8_t mask)
-{
-	/* Current limit have to be applied each time when USB is (re)connected. */
-	if (mask & NPMX_EVENT_GROUP_VBUSIN_DETECTED_MASK) {
-		npmx_vbusin_task_trigger(npmx_vbusin_get(p_pm, 0),
-					 NPMX_VBUSIN_TASK_APPLY_CURRENT_LIMIT);
-	}
-}
+/* Maximum time of a single ADC measurement. */
+#define ADC_MEAS_TIMEOUT_MS 100
 
 void main(void)
 {
@@ -44,17 +31,8 @@ void main(void)
 	/* Get pointer to npmx instance and other required instances. */
 	npmx_instance_t *npmx_instance = npmx_driver_instance_get(pmic_dev);
 	npmx_charger_t *charger_instance = npmx_charger_get(npmx_instance, 0);
-	npmx_vbusin_t *vbusin_instance = npmx_vbusin_get(npmx_instance, 0);
 	npmx_adc_t *adc_instance = npmx_adc_get(npmx_instance, 0);
 
-	/* Register callback for VBUSIN VOLTAGE event. */
-	npmx_core_register_cb(npmx_instance, vbusin_voltage_callback,
-			      NPMX_CALLBACK_TYPE_EVENT_VBUSIN_VOLTAGE);
-
-	/* Enable detecting connected USB. */
-	npmx_core_event_interrupt_enable(npmx_instance, NPMX_EVENT_GROUP_VBUSIN_VOLTAGE,
-					 NPMX_EVENT_GROUP_VBUSIN_DETECTED_MASK);
-
 	/* Disable charger before changing charge current and termination voltage. */
 	npmx_charger_module_disable_set(charger_instance, NPMX_CHARGER_MODULE_CHARGER_MASK);
 
@@ -75,15 +53,6 @@ void main(void)
 	/* Enable charger. */
 	npmx_charger_module_enable_set(charger_instance, NPMX_CHARGER_MODULE_CHARGER_MASK);
 
-	/* Set the current limit for the USB port.
-	 * Current limit needs to be applied after each USB (re)connection.
-	 */
-	npmx_vbusin_current_limit_set(vbusin_instance,
-				      npmx_vbusin_current_convert(CONFIG_CURRENT_LIMIT));
-
-	/* Apply current limit. */
-	npmx_vbusin_task_trigger(vbusin_instance, NPMX_VBUSIN_TASK_APPLY_CURRENT_LIMIT);
-
 	npmx_adc_ntc_config_t ntc_config = { .type = npmx_adc_ntc_type_convert(
 						     CONFIG_THERMISTOR_RESISTANCE),
 					     .beta = CONFIG_THERMISTOR_BETA };
@@ -94,9 +63,16 @@ void main(void)
 	/* Enable auto measurement of the battery current after the battery voltage measurement. */
 	npmx_adc_ibat_meas_enable_set(adc_instance, true);
 
-	/* Trigger required ADC measurements. */
-	npmx_adc_task_trigger(adc_instance, NPMX_ADC_TASK_SINGLE_SHOT_VBAT);
-	npmx_adc_task_trigger(adc_instance, NPMX_ADC_TASK_SINGLE_SHOT_NTC);
+	/* Take the initial measurements and wait until they are ready. */
+	if ((npmx_driver_adc_meas_wait(pmic_dev, NPMX_ADC_TASK_SINGLE_SHOT_VBAT,
+				       NPMX_EVENT_GROUP_ADC_BAT_READY_MASK |
+					       NPMX_EVENT_GROUP_ADC_IBAT_READY_MASK,
+				       ADC_MEAS_TIMEOUT_MS) != 0) ||
+	    (npmx_driver_adc_meas_wait(pmic_dev, NPMX_ADC_TASK_SINGLE_SHOT_NTC,
+				       NPMX_EVENT_GROUP_ADC_NTC_READY_MASK, ADC_MEAS_TIMEOUT_MS) != 0)) {
+		LOG_ERR("Initial ADC measurements failed.");
+		return;
+	}
 
 	if (fuel_gauge_init(npmx_instance) < 0) {
 		LOG_ERR("Fuel gauge initialization failed.");
@@ -106,7 +82,6 @@ void main(void)
 	LOG_INF("Fuel gauge OK.");
 
 	while (1) {
-		k_msleep(1000);
 		fuel_gauge_update(npmx_instance);
 	}
 }
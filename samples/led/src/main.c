@@ -7,23 +7,39 @@
 #include <zephyr/logging/log.h>
 #include <zephyr/kernel.h>
 #include <npmx_driver.h>
-#include <npmx_led.h>
 
 #define LOG_MODULE_NAME led
 LOG_MODULE_REGISTER(LOG_MODULE_NAME);
 
-/**
- * @brief Function for setting LEDs status based on lower 3 bits of status variable.
- *
- * @param[in] p_pm   Pointer to the instance of PMIC device.
- * @param[in] status Lower 3 bits are used to set or reset LEDs.
+/* Duration of each state of the LEDs sequence. */
+#define SEQUENCE_STEP_MS 500
+
+/*
+ * LEDs sequence 0b111, 0b011, 0b001, 0b010, 0b000, where bit n is the state of LED n, split into
+ * the steps of each LED. All patterns have the same period, so they stay in sync.
  */
-void leds_status_set(npmx_instance_t *p_pm, uint8_t status)
-{
-	npmx_led_state_set(npmx_led_get(p_pm, 0), (status & (1UL << 0UL)) > 0);
-	npmx_led_state_set(npmx_led_get(p_pm, 1), (status & (1UL << 1UL)) > 0);
-	npmx_led_state_set(npmx_led_get(p_pm, 2), (status & (1UL << 2UL)) > 0);
-}
+static const struct npmx_driver_led_step led0_steps[] = {
+	{ .on = true, .duration_ms = 3 * SEQUENCE_STEP_MS },
+	{ .on = false, .duration_ms = 2 * SEQUENCE_STEP_MS },
+};
+
+static const struct npmx_driver_led_step led1_steps[] = {
+	{ .on = true, .duration_ms = 2 * SEQUENCE_STEP_MS },
+	{ .on = false, .duration_ms = SEQUENCE_STEP_MS },
+	{ .on = true, .duration_ms = SEQUENCE_STEP_MS },
+	{ .on = false, .duration_ms = SEQUENCE_STEP_MS },
+};
+
+static const struct npmx_driver_led_step led2_steps[] = {
+	{ .on = true, .duration_ms = SEQUENCE_STEP_MS },
+	{ .on = false, .duration_ms = 4 * SEQUENCE_STEP_MS },
+};
+
+static const struct npmx_driver_led_pattern led_patterns[] = {
+	{ .p_steps = led0_steps, .step_count = ARRAY_SIZE(led0_steps) },
+	{ .p_steps = led1_steps, .step_count = ARRAY_SIZE(led1_steps) },
+	{ .p_steps = led2_steps, .step_count = ARRAY_SIZE(led2_steps) },
+};
 
 void main(void)
 {
@@ -36,22 +52,17 @@ void main(void)
 
 	LOG_INF("PMIC device OK.");
 
-	/* Get the pointer to npmx device. */
-	npmx_instance_t *npmx_instance = npmx_driver_instance_get(pmic_dev);
-
-	/* Set the LEDs sequence. Only first 3 bits are used. */
-	const uint8_t led_sequence[] = { 0b111, 0b011, 0b001, 0b010, 0b000 };
-	const uint8_t led_sequence_count = sizeof(led_sequence);
+	/* The driver switches the LEDs to the host mode and runs the patterns in the background. */
+	for (uint8_t i = 0; i < ARRAY_SIZE(led_patterns); i++) {
+		if (npmx_driver_led_pattern_start(pmic_dev, i, &led_patterns[i]) != 0) {
+			LOG_ERR("Starting LED %u pattern failed.", i);
+			return;
+		}
+	}
 
-	npmx_led_mode_set(npmx_led_get(npmx_instance, 0), NPMX_LED_MODE_HOST);
-	npmx_led_mode_set(npmx_led_get(npmx_instance, 1), NPMX_LED_MODE_HOST);
-	npmx_led_mode_set(npmx_led_get(npmx_instance, 2), NPMX_LED_MODE_HOST);
+	LOG_INF("LEDs blinking.");
 
 	while (1) {
-		for (uint8_t i = 0; i < led_sequence_count; i++) {
-			leds_status_set(npmx_instance, led_sequence[i]);
-			k_msleep(500);
-		}
-		LOG_INF("LEDs blinking.");
+		k_sleep(K_FOREVER);
 	}
 }
@@ -6,8 +6,6 @@
 
 #include <zephyr/logging/log.h>
 #include <zephyr/kernel.h>
-#include <npmx_adc.h>
-#include <npmx_charger.h>
 #include <npmx_core.h>
 #include <npmx_driver.h>
 
@@ -64,9 +62,6 @@ void main(void)
 	/* Get pointer to npmx device. */
 	npmx_instance_t *npmx_instance = npmx_driver_instance_get(pmic_dev);
 
-	/* Get pointer to charger instance. */
-	npmx_charger_t *charger_instance = npmx_charger_get(npmx_instance, 0);
-
 	/* Register callback for VBUSIN thermal event used for detecting CC lines status. */
 	npmx_core_register_cb(npmx_instance, vbusin_thermal_callback,
 			      NPMX_EVENT_GROUP_VBUSIN_THERMAL);
@@ -76,28 +71,9 @@ void main(void)
 					 NPMX_EVENT_GROUP_USB_CC1_MASK |
 						 NPMX_EVENT_GROUP_USB_CC2_MASK);
 
-	/* Disable charger before changing charging current. */
-	npmx_charger_module_disable_set(charger_instance, NPMX_CHARGER_MODULE_CHARGER_MASK);
-
-	/* Set termination voltage and charging current. */
-	npmx_charger_termination_normal_voltage_set(charger_instance, NPMX_CHARGER_VOLTAGE_4V20);
-	npmx_charger_charging_current_set(charger_instance, 800);
-
-	/* Enable charger for events handling. */
-	npmx_charger_module_enable_set(charger_instance,
-				       NPMX_CHARGER_MODULE_CHARGER_MASK |
-					       NPMX_CHARGER_MODULE_RECHARGE_MASK |
-					       NPMX_CHARGER_MODULE_NTC_LIMITS_MASK);
-
-	/* Set LEDs. */
-	npmx_led_mode_set(npmx_led_get(npmx_instance, 0), NPMX_LED_MODE_CHARGING);
-	npmx_led_mode_set(npmx_led_get(npmx_instance, 1), NPMX_LED_MODE_ERROR);
-	npmx_led_mode_set(npmx_led_get(npmx_instance, 2), NPMX_LED_MODE_NOTUSED);
-
-	npmx_adc_ntc_config_t ntc_config = { .type = NPMX_ADC_NTC_TYPE_10_K, .beta = 0 };
-
-	/* Set thermistor type for charger module NTC. Beta value is not used. */
-	npmx_adc_ntc_config_set(npmx_adc_get(npmx_instance, 0), &ntc_config);
+	/* Charger, thermistor and LEDs are configured from devicetree when the device is
+	 * initialized.
+	 */
 
 	while (1) {
 		k_sleep(K_FOREVER);
@@ -33,25 +33,27 @@ static void timeout_callback(struct k_work *work)
 static volatile uint32_t start_time;
 
 /**
- * @brief Callback function to be used when SHIPHOLD WATCHDOG event occurs.
+ * @brief Handler of SHIPHOLD WATCHDOG event. Interrupt data is printed by the driver.
  *        SHIPHOLD WATCHDOG is used by the timer in the general purpose timer mode.
  *
- * @param[in] p_pm Pointer to the instance of nPM device.
- * @param[in] type Callback type. Should be @ref NPMX_CALLBACK_TYPE_EVENT_SHIPHOLD.
- * @param[in] mask Received event interrupt mask.
+ * @param[in] p_event     Pointer to the events.
+ * @param[in] p_user_data Unused.
  */
-static void timer_callback(npmx_instance_t *p_pm, npmx_callback_type_t type, uint8_t mask)
+static void timer_handler(struct npmx_driver_event const *p_event, void *p_user_data)
 {
+	ARG_UNUSED(p_user_data);
+
 	/* Cancel timeout. */
 	k_work_cancel_delayable(&timeout_timer);
 
 	/* Calculate elapsed time and print log info. */
-	LOG_INF("Elapsed time: %d ms.", k_uptime_get_32() - start_time);
-
-	/* Call generic callback to print interrupt data. */
-	p_pm->generic_cb(p_pm, type, mask);
+	LOG_INF("Elapsed time: %d ms.", p_event->timestamp - start_time);
 }
 
+/* Subscriber of the timer event. */
+NPMX_DRIVER_EVENT_SUBSCRIBER_DEFINE(timer_subscriber, NPMX_CALLBACK_TYPE_EVENT_SHIPHOLD,
+				    NPMX_EVENT_GROUP_SHIPHOLD_WATCHDOG_MASK, timer_handler, NULL);
+
 void main(void)
 {
 	const struct device *pmic_dev = DEVICE_DT_GET(DT_NODELABEL(npm_0));
@@ -72,8 +74,8 @@ void main(void)
 	/* Get the pointer to TIMER instance. */
 	npmx_timer_t *timer_instance = npmx_timer_get(npmx_instance, 0);
 
-	/* Register SHIPHOLD callback. */
-	npmx_core_register_cb(npmx_instance, timer_callback, NPMX_CALLBACK_TYPE_EVENT_SHIPHOLD);
+	/* Subscribe to SHIPHOLD event. */
+	npmx_driver_event_subscribe(pmic_dev, &timer_subscriber);
 
 	/* General purpose timer mode uses SHIPHOLD WATCHDOG bit to indicate interrupt. */
 	npmx_core_event_interrupt_enable(npmx_instance, NPMX_EVENT_GROUP_SHIPHOLD,
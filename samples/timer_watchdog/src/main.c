@@ -15,20 +15,23 @@
 #define LOG_MODULE_NAME watchdog
 LOG_MODULE_REGISTER(LOG_MODULE_NAME);
 
-/** @brief Variable filled in @ref kicking_thread() when watchdog kicking stops. */
+/** @brief Check-in bit of @ref worker_thread() required by the watchdog service. */
+#define WORKER_CHECKIN BIT(0)
+
+/** @brief Variable filled in @ref worker_thread() when watchdog check-ins stop. */
 static volatile uint32_t start_time;
 
 /** @brief Variable filled in @ref timer_callback() when watchdog warning occurs. */
 static volatile uint32_t warning_time;
 
-/** @brief Semaphore used to inform @ref kicking_thread() when to stop kicking the watchdog. */
-K_SEM_DEFINE(stop_kick_sem, 0, 1);
+/** @brief Semaphore used to inform @ref worker_thread() when to stop checking in. */
+K_SEM_DEFINE(stop_checkin_sem, 0, 1);
 
-/** @brief Stack used by kick_thread. */
-K_THREAD_STACK_DEFINE(kick_stack, 1000);
+/** @brief Stack used by check-in thread. */
+K_THREAD_STACK_DEFINE(worker_stack, 1000);
 
-/** @brief Kicking thread definition. */
-struct k_thread kick_thread;
+/** @brief Check-in thread definition. */
+struct k_thread worker;
 
 #if CONFIG_TESTCASE_WATCHDOG_MODE_WARNING
 /** @brief Timer watchdog working in warning mode. */
@@ -39,53 +42,54 @@ struct k_thread kick_thread;
 #endif
 
 /**
- * @brief Function for being run as thread function for kicking off a thread.
- *        In this function, the watchdog will be kicked each 100 ms
- *        until the user presses the irq_res on the console.
+ * @brief Function for being run as thread function of an application thread monitored by the
+ *        watchdog. In this function, the thread checks in each 100 ms until the user presses
+ *        any key on the console. The watchdog itself is kicked by the nPM driver.
  *
- * @param[in] p1 Pointer to the @ref npmx_timer_t instance.
+ * @param[in] p1 Pointer to the nPM Zephyr device.
  * @param     p2 Unused.
  * @param     p3 Unused.
  */
-static void kicking_thread(void *p1, void *p2, void *p3)
+static void worker_thread(void *p1, void *p2, void *p3)
 {
 	ARG_UNUSED(p2);
 	ARG_UNUSED(p3);
 
-	/* Get timer instance from arguments list. */
-	npmx_timer_t *timer_instance = (npmx_timer_t *)p1;
+	const struct device *pmic_dev = p1;
 
-	/* If user pressed button on console, kicking stops. */
-	while (k_sem_take(&stop_kick_sem, K_NO_WAIT) != 0) {
+	/* If user pressed button on console, check-ins stop. */
+	while (k_sem_take(&stop_checkin_sem, K_NO_WAIT) != 0) {
 		k_msleep(100);
-		/* Kick watchdog timer. */
-		npmx_timer_task_trigger(timer_instance, NPMX_TIMER_TASK_KICK);
+		/* Report the thread is alive. */
+		npmx_driver_watchdog_checkin(pmic_dev, WORKER_CHECKIN);
 	}
 
 	start_time = k_uptime_get_32();
-	LOG_INF("Kicking stopped!");
+	LOG_INF("Check-ins stopped!");
 	LOG_INF("Wait for watchdog warning interrupt.");
 }
 
 /**
- * @brief Callback function to be used when watchdog warning event occurs.
+ * @brief Handler of watchdog warning event. Interrupt data is printed by the driver.
  *
- * @param[in] p_pm Pointer to the instance of PMIC device.
- * @param[in] type Callback type. Should be @ref NPMX_CALLBACK_TYPE_EVENT_SHIPHOLD.
- * @param[in] mask Received event interrupt mask.
+ * @param[in] p_event     Pointer to the events.
+ * @param[in] p_user_data Unused.
  */
-static void timer_callback(npmx_instance_t *p_pm, npmx_callback_type_t type, uint8_t mask)
+static void timer_handler(struct npmx_driver_event const *p_event, void *p_user_data)
 {
-	warning_time = k_uptime_get_32();
+	ARG_UNUSED(p_user_data);
+
+	warning_time = p_event->timestamp;
 	LOG_INF("Watchdog warning callback.");
 
 	/* Calculate elapsed time and print log info. */
 	LOG_INF("Warning after %d ms.", warning_time - start_time);
-
-	/* Call generic callback to print interrupt data. */
-	p_pm->generic_cb(p_pm, type, mask);
 }
 
+/* Subscriber of the watchdog warning event. */
+NPMX_DRIVER_EVENT_SUBSCRIBER_DEFINE(timer_subscriber, NPMX_CALLBACK_TYPE_EVENT_SHIPHOLD,
+				    NPMX_EVENT_GROUP_SHIPHOLD_WATCHDOG_MASK, timer_handler, NULL);
+
 /**
  * @brief Callback function to be used when the reset pin toggle.
  *
@@ -152,11 +156,8 @@ void main(void)
 	/* Configure host pin to handle falling edge on output reset pin. */
 	configure_reset_interrupt();
 
-	/* Get the pointer to TIMER instance. */
-	npmx_timer_t *timer_instance = npmx_timer_get(npmx_instance, 0);
-
-	/* Register SHIPHOLD callback. */
-	npmx_core_register_cb(npmx_instance, timer_callback, NPMX_CALLBACK_TYPE_EVENT_SHIPHOLD);
+	/* Subscribe to SHIPHOLD event. */
+	npmx_driver_event_subscribe(pmic_dev, &timer_subscriber);
 
 	/* Enable watchdog interrupt. */
 	npmx_core_event_interrupt_enable(npmx_instance, NPMX_EVENT_GROUP_SHIPHOLD,
@@ -170,28 +171,28 @@ void main(void)
 		/* expected total time is ((1/512) * compare_value). */
 	};
 
-	/* Set TIMER configuration. */
-	npmx_timer_config_set(timer_instance, &timer_config);
-
-	/* Enable TIMER to execute the interrupt. */
-	npmx_timer_task_trigger(timer_instance, NPMX_TIMER_TASK_ENABLE);
+	/* Set TIMER configuration and kick it from the driver while the worker thread checks in. */
+	if (npmx_driver_watchdog_start(pmic_dev, &timer_config, WORKER_CHECKIN) != 0) {
+		LOG_ERR("Starting watchdog failed.");
+		return;
+	}
 
 	/* Create the new thread. */
-	k_thread_create(&kick_thread, kick_stack, K_THREAD_STACK_SIZEOF(kick_stack), kicking_thread,
-			timer_instance, NULL, NULL, 7, 0, K_NO_WAIT);
+	k_thread_create(&worker, worker_stack, K_THREAD_STACK_SIZEOF(worker_stack), worker_thread,
+			(void *)pmic_dev, NULL, NULL, 7, 0, K_NO_WAIT);
 
 	/* Initialize console required to interact with the user. */
 	console_init();
 
-	LOG_INF("Watchdog is being kicked, press any key to stop it.");
+	LOG_INF("Watchdog is being kicked, press any key to stop check-ins.");
 
 	while (1) {
 		/* Wait for the user interaction. */
 		uint8_t c = console_getchar();
 
 		if (c) {
-			/* Inform kicking thread to stop kicking. */
-			k_sem_give(&stop_kick_sem);
+			/* Inform worker thread to stop checking in. */
+			k_sem_give(&stop_checkin_sem);
 			break;
 		}
 	}
@@ -13,48 +13,58 @@
 LOG_MODULE_REGISTER(LOG_MODULE_NAME);
 
 /**
- * @brief Callback function to be used when VBUSIN VOLTAGE event occurs.
+ * @brief Handler of VBUSIN VOLTAGE DETECTED event. Interrupt data is printed by the driver.
  *
- * @param[in] p_pm Pointer to the instance of PMIC device.
- * @param[in] type Callback type. Should be @ref NPMX_CALLBACK_TYPE_EVENT_VBUSIN_VOLTAGE.
- * @param[in] mask Received event interrupt mask.
+ * @param[in] p_event     Pointer to the events.
+ * @param[in] p_user_data Unused.
  */
-void vbusin_voltage_callback(npmx_instance_t *p_pm, npmx_callback_type_t type, uint8_t mask)
+static void vbusin_voltage_handler(struct npmx_driver_event const *p_event, void *p_user_data)
 {
-	/* Current limit have to be applied each time when USB is (re)connected. */
-	if (mask & NPMX_EVENT_GROUP_VBUSIN_DETECTED_MASK) {
-		npmx_vbusin_task_trigger(npmx_vbusin_get(p_pm, 0),
-					 NPMX_VBUSIN_TASK_APPLY_CURRENT_LIMIT);
-	}
+	npmx_instance_t *npmx_instance = npmx_driver_instance_get(p_event->p_dev);
 
-	/* Call generic callback to print interrupt data. */
-	p_pm->generic_cb(p_pm, type, mask);
+	ARG_UNUSED(p_user_data);
+
+	/* Current limit have to be applied each time when USB is (re)connected. */
+	npmx_vbusin_task_trigger(npmx_vbusin_get(npmx_instance, 0),
+				 NPMX_VBUSIN_TASK_APPLY_CURRENT_LIMIT);
 }
 
 /**
- * @brief Callback function to be used when VBUSIN THERMAL event occurs.
+ * @brief Handler of VBUSIN THERMAL events. Interrupt data is printed by the driver.
  *
- * @param[in] p_pm Pointer to the instance of PMIC device.
- * @param[in] type Callback type. Should be @ref NPMX_CALLBACK_TYPE_EVENT_VBUSIN_THERMAL_USB.
- * @param[in] mask Received event interrupt mask.
+ * @param[in] p_event     Pointer to the events.
+ * @param[in] p_user_data Unused.
  */
-void vbusin_thermal_callback(npmx_instance_t *p_pm, npmx_callback_type_t type, uint8_t mask)
+static void vbusin_thermal_handler(struct npmx_driver_event const *p_event, void *p_user_data)
 {
+	npmx_instance_t *npmx_instance = npmx_driver_instance_get(p_event->p_dev);
 	npmx_vbusin_cc_t cc1;
 	npmx_vbusin_cc_t cc2;
 
+	ARG_UNUSED(p_user_data);
+
 	/* Get the status of CC lines. */
-	if (npmx_vbusin_cc_status_get(npmx_vbusin_get(p_pm, 0), &cc1, &cc2) == NPMX_SUCCESS) {
+	if (npmx_vbusin_cc_status_get(npmx_vbusin_get(npmx_instance, 0), &cc1, &cc2) ==
+	    NPMX_SUCCESS) {
 		LOG_INF("CC1: %s", npmx_vbusin_cc_status_map_to_string(cc1));
 		LOG_INF("CC2: %s", npmx_vbusin_cc_status_map_to_string(cc2));
 	} else {
 		LOG_ERR("Unable to read CC lines status.");
 	}
-
-	/* Call generic callback to print interrupt data. */
-	p_pm->generic_cb(p_pm, type, mask);
 }
 
+/* Subscriber of USB connection events. */
+NPMX_DRIVER_EVENT_SUBSCRIBER_DEFINE(vbusin_voltage_subscriber,
+				    NPMX_CALLBACK_TYPE_EVENT_VBUSIN_VOLTAGE,
+				    NPMX_EVENT_GROUP_VBUSIN_DETECTED_MASK, vbusin_voltage_handler,
+				    NULL);
+
+/* Subscriber of CC lines status change events. */
+NPMX_DRIVER_EVENT_SUBSCRIBER_DEFINE(vbusin_thermal_subscriber,
+				    NPMX_CALLBACK_TYPE_EVENT_VBUSIN_THERMAL_USB,
+				    NPMX_EVENT_GROUP_USB_CC1_MASK | NPMX_EVENT_GROUP_USB_CC2_MASK,
+				    vbusin_thermal_handler, NULL);
+
 void main(void)
 {
 	const struct device *pmic_dev = DEVICE_DT_GET(DT_NODELABEL(npm_0));
@@ -69,13 +79,11 @@ void main(void)
 	/* Get the pointer to npmx device. */
 	npmx_instance_t *npmx_instance = npmx_driver_instance_get(pmic_dev);
 
-	/* Register callback for VBUSIN VALTAGE event. */
-	npmx_core_register_cb(npmx_instance, vbusin_voltage_callback,
-			      NPMX_CALLBACK_TYPE_EVENT_VBUSIN_VOLTAGE);
+	/* Subscribe to VBUSIN VOLTAGE event. */
+	npmx_driver_event_subscribe(pmic_dev, &vbusin_voltage_subscriber);
 
-	/* Register callback for VBUSIN THERMAL event used for detecting CC lines status. */
-	npmx_core_register_cb(npmx_instance, vbusin_thermal_callback,
-			      NPMX_EVENT_GROUP_VBUSIN_THERMAL);
+	/* Subscribe to VBUSIN THERMAL event used for detecting CC lines status. */
+	npmx_driver_event_subscribe(pmic_dev, &vbusin_thermal_subscriber);
 
 	/* Enable detecting connected and removed USB. */
 	npmx_core_event_interrupt_enable(npmx_instance, NPMX_EVENT_GROUP_VBUSIN_VOLTAGE,
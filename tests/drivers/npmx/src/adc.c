@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <npmx_adc.h>
+#include <npmx_driver.h>
+#include <npmx_emul.h>
+
+#include <zephyr/device.h>
+#include <zephyr/drivers/emul.h>
+#include <zephyr/ztest.h>
+
+/* Datasheet addresses of the EVENTSADCSET and INTENEVENTSADCSET registers. */
+#define EVENTS_ADC_SET_ADDR 0x0002U
+#define INTEN_ADC_SET_ADDR  0x0004U
+
+/* Maximum time to wait for a measurement, well above the emulated conversion time. */
+#define MEAS_TIMEOUT_MS 100
+
+static const struct device *int_dev = DEVICE_DT_GET(DT_NODELABEL(npm_0));
+static const struct emul *int_emul = EMUL_DT_GET(DT_NODELABEL(npm_0));
+static const struct device *poll_dev = DEVICE_DT_GET(DT_NODELABEL(npm_1));
+static const struct emul *poll_emul = EMUL_DT_GET(DT_NODELABEL(npm_1));
+
+static uint8_t emul_reg_get(const struct emul *emul, uint16_t register_address)
+{
+	uint8_t value;
+
+	zassert_ok(npmx_emul_reg_get(emul, register_address, &value, 1));
+
+	return value;
+}
+
+/* Measures the battery voltage and checks that the ADC event is cleared without a reset. */
+static void meas_wait_check(const struct device *dev, const struct emul *emul)
+{
+	uint32_t sw_resets = npmx_emul_sw_reset_count_get(emul);
+	uint8_t int_enabled = emul_reg_get(emul, INTEN_ADC_SET_ADDR);
+
+	zassert_ok(npmx_driver_adc_meas_wait(dev, NPMX_ADC_TASK_SINGLE_SHOT_VBAT,
+					     NPMX_EVENT_GROUP_ADC_BAT_READY_MASK, MEAS_TIMEOUT_MS));
+
+	zassert_equal(npmx_emul_sw_reset_count_get(emul), sw_resets, "software reset requested");
+	zassert_equal(emul_reg_get(emul, EVENTS_ADC_SET_ADDR), 0, "ADC events not cleared");
+	zassert_equal(emul_reg_get(emul, INTEN_ADC_SET_ADDR), int_enabled,
+		      "ADC interrupt enables not restored");
+}
+
+ZTEST(npmx_adc, test_meas_wait_interrupt)
+{
+	meas_wait_check(int_dev, int_emul);
+}
+
+ZTEST(npmx_adc, test_meas_wait_poll)
+{
+	meas_wait_check(poll_dev, poll_emul);
+}
+
+/* A measurement started right after the previous one completed is not lost to a late clear. */
+ZTEST(npmx_adc, test_meas_wait_back_to_back)
+{
+	for (int i = 0; i < 3; i++) {
+		meas_wait_check(int_dev, int_emul);
+	}
+}
+
+static void *npmx_adc_setup(void)
+{
+	zassert_true(device_is_ready(int_dev), "PMIC device not ready");
+	zassert_true(device_is_ready(poll_dev), "PMIC device not ready");
+
+	return NULL;
+}
+
+ZTEST_SUITE(npmx_adc, NULL, npmx_adc_setup, NULL, NULL, NULL);
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <npmx_driver.h>
+#include <npmx_emul.h>
+
+#include <zephyr/device.h>
+#include <zephyr/drivers/emul.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+/* Time the batch is kept open by the other thread. */
+#define HOLD_TIME_MS 20
+
+#define OWNER_STACK_SIZE 1024
+
+/* Registers of an unused peripheral, neither cached nor changed by the emulator. */
+#define SCRATCH_ADDR 0x0F00U
+#define SCRATCH_SIZE 8U
+
+static const struct device *pmic_dev = DEVICE_DT_GET(DT_NODELABEL(npm_0));
+static const struct emul *pmic_emul = EMUL_DT_GET(DT_NODELABEL(npm_0));
+
+static K_THREAD_STACK_DEFINE(owner_stack, OWNER_STACK_SIZE);
+static struct k_thread owner_thread;
+static K_SEM_DEFINE(owner_opened, 0, 1);
+static int owner_begin_err;
+
+/* Opens the batch and keeps it open for the hold time. */
+static void owner_entry(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	owner_begin_err = npmx_driver_batch_begin(pmic_dev);
+	k_sem_give(&owner_opened);
+
+	if (owner_begin_err == 0) {
+		k_msleep(HOLD_TIME_MS);
+		(void)npmx_driver_batch_end(pmic_dev);
+	}
+}
+
+static void owner_start(void)
+{
+	k_sem_reset(&owner_opened);
+	(void)k_thread_create(&owner_thread, owner_stack, K_THREAD_STACK_SIZEOF(owner_stack),
+			      owner_entry, NULL, NULL, NULL, K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+
+	zassert_ok(k_sem_take(&owner_opened, K_MSEC(HOLD_TIME_MS)));
+	zassert_ok(owner_begin_err);
+}
+
+/* A batch opened by another thread is waited for instead of failing at once. */
+ZTEST(npmx_batch, test_begin_waits_for_owner)
+{
+	owner_start();
+
+	zassert_ok(npmx_driver_batch_begin(pmic_dev));
+	zassert_ok(npmx_driver_batch_end(pmic_dev));
+
+	zassert_ok(k_thread_join(&owner_thread, K_MSEC(HOLD_TIME_MS)));
+}
+
+/* A holder of the instance lock does not wait, as the owner takes the lock to send its batch. */
+ZTEST(npmx_batch, test_begin_with_lock_held)
+{
+	owner_start();
+
+	zassert_ok(npmx_driver_lock(pmic_dev, K_FOREVER));
+	zassert_equal(npmx_driver_batch_begin(pmic_dev), -EBUSY);
+	npmx_driver_unlock(pmic_dev);
+
+	zassert_ok(k_thread_join(&owner_thread, K_MSEC(2 * HOLD_TIME_MS)));
+}
+
+ZTEST(npmx_batch, test_begin_nested)
+{
+	zassert_ok(npmx_driver_batch_begin(pmic_dev));
+	zassert_equal(npmx_driver_batch_begin(pmic_dev), -EBUSY);
+	zassert_ok(npmx_driver_batch_end(pmic_dev));
+}
+
+/* Reads of consecutive registers are merged into a single access of a single transfer. */
+ZTEST(npmx_batch, test_burst_merged)
+{
+	static const uint8_t values[SCRATCH_SIZE] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+	uint8_t read[SCRATCH_SIZE] = { 0 };
+	uint32_t transfers = npmx_emul_transfer_count_get(pmic_emul);
+	uint32_t segments = npmx_emul_segment_count_get(pmic_emul);
+
+	zassert_ok(npmx_emul_reg_set(pmic_emul, SCRATCH_ADDR, values, sizeof(values)));
+
+	zassert_ok(npmx_driver_batch_begin(pmic_dev));
+	for (size_t i = 0; i < SCRATCH_SIZE; i += 2) {
+		zassert_ok(npmx_driver_batch_read(pmic_dev, SCRATCH_ADDR + i, &read[i], 2));
+	}
+	zassert_equal(npmx_emul_transfer_count_get(pmic_emul), transfers, "batch sent early");
+	zassert_ok(npmx_driver_batch_end(pmic_dev));
+
+	zassert_equal(npmx_emul_transfer_count_get(pmic_emul), transfers + 1);
+	zassert_equal(npmx_emul_segment_count_get(pmic_emul), segments + 1, "reads not merged");
+	zassert_mem_equal(read, values, sizeof(values));
+}
+
+/* Reads of registers apart are sent in the same transfer, as separate accesses. */
+ZTEST(npmx_batch, test_burst_not_merged)
+{
+	uint8_t read[2];
+	uint32_t transfers = npmx_emul_transfer_count_get(pmic_emul);
+	uint32_t segments = npmx_emul_segment_count_get(pmic_emul);
+
+	zassert_ok(npmx_driver_batch_begin(pmic_dev));
+	zassert_ok(npmx_driver_batch_read(pmic_dev, SCRATCH_ADDR, &read[0], 1));
+	zassert_ok(npmx_driver_batch_read(pmic_dev, SCRATCH_ADDR + 2, &read[1], 1));
+	zassert_ok(npmx_driver_batch_end(pmic_dev));
+
+	zassert_equal(npmx_emul_transfer_count_get(pmic_emul), transfers + 1);
+	zassert_equal(npmx_emul_segment_count_get(pmic_emul), segments + 2);
+}
+
+ZTEST_SUITE(npmx_batch, NULL, NULL, NULL, NULL, NULL);
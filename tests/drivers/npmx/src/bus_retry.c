@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <npmx_core.h>
+#include <npmx_driver.h>
+#include <npmx_emul.h>
+
+#include <zephyr/device.h>
+#include <zephyr/drivers/emul.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#if defined(CONFIG_NPMX_BUS_RETRY)
+#define RETRY_COUNT CONFIG_NPMX_BUS_RETRY_COUNT
+#define RESYNC_DELAY_MS CONFIG_NPMX_BUS_RESYNC_DELAY_MS
+#else
+#define RETRY_COUNT 0
+#define RESYNC_DELAY_MS 0
+#endif
+
+/* Number of failed transfers after which a transfer is given up. */
+#define FAILS_TO_GIVE_UP (1 + RETRY_COUNT)
+
+/* Time allowed for the driver to handle raised events, resynchronization included. */
+#define EVENT_TIMEOUT_MS (100 + RESYNC_DELAY_MS)
+
+static const struct device *pmic_dev = DEVICE_DT_GET(DT_NODELABEL(npm_0));
+static const struct emul *pmic_emul = EMUL_DT_GET(DT_NODELABEL(npm_0));
+
+static K_SEM_DEFINE(event_sem, 0, 1);
+
+static void event_handler(struct npmx_driver_event const *p_event, void *p_user_data)
+{
+	ARG_UNUSED(p_event);
+	ARG_UNUSED(p_user_data);
+
+	k_sem_give(&event_sem);
+}
+
+static void stats_get(struct npmx_driver_bus_recovery_stats *p_stats)
+{
+	zassert_ok(npmx_driver_bus_recovery_stats_get(pmic_dev, p_stats));
+}
+
+static void retry_check(void)
+{
+	if (!IS_ENABLED(CONFIG_NPMX_BUS_RETRY)) {
+		ztest_test_skip();
+	}
+}
+
+/* A single disturbed transfer is repeated and succeeds. */
+ZTEST(npmx_bus_retry, test_transfer_retried)
+{
+	npmx_instance_t *npmx_instance = npmx_driver_instance_get(pmic_dev);
+	struct npmx_driver_bus_recovery_stats before;
+	struct npmx_driver_bus_recovery_stats after;
+
+	retry_check();
+	stats_get(&before);
+
+	npmx_emul_transfer_fail_set(pmic_emul, 1);
+	zassert_equal(npmx_core_event_interrupt_enable(npmx_instance, NPMX_EVENT_GROUP_SHIPHOLD,
+						       BIT(0)),
+		      NPMX_SUCCESS);
+
+	stats_get(&after);
+	zassert_equal(after.retries, before.retries + 1);
+	zassert_equal(after.recovered, before.recovered + 1);
+	zassert_equal(after.failed, before.failed);
+
+	zassert_equal(npmx_core_event_interrupt_disable(npmx_instance, NPMX_EVENT_GROUP_SHIPHOLD,
+							BIT(0)),
+		      NPMX_SUCCESS);
+}
+
+/* Transfers sent with the lock held across several accesses are retried too. */
+ZTEST(npmx_bus_retry, test_batch_retried)
+{
+	struct npmx_driver_bus_recovery_stats before;
+	struct npmx_driver_bus_recovery_stats after;
+	uint8_t config[NPMX_DRIVER_CONFIG_SIZE];
+
+	retry_check();
+	npmx_driver_cache_invalidate(pmic_dev);
+	stats_get(&before);
+
+	npmx_emul_transfer_fail_set(pmic_emul, 1);
+	zassert_ok(npmx_driver_config_read(pmic_dev, config));
+
+	stats_get(&after);
+	zassert_equal(after.recovered, before.recovered + 1);
+}
+
+/* A transfer failing on all retries is reported as an error. */
+ZTEST(npmx_bus_retry, test_transfer_failed)
+{
+	npmx_instance_t *npmx_instance = npmx_driver_instance_get(pmic_dev);
+	struct npmx_driver_bus_recovery_stats before;
+	struct npmx_driver_bus_recovery_stats after;
+
+	retry_check();
+	stats_get(&before);
+
+	npmx_emul_transfer_fail_set(pmic_emul, FAILS_TO_GIVE_UP);
+	zassert_equal(npmx_core_event_interrupt_enable(npmx_instance, NPMX_EVENT_GROUP_SHIPHOLD,
+						       BIT(0)),
+		      NPMX_ERROR_IO);
+
+	stats_get(&after);
+	zassert_equal(after.retries, before.retries + RETRY_COUNT);
+	zassert_equal(after.failed, before.failed + 1);
+	zassert_equal(after.resyncs, before.resyncs, "failure outside event processing resynced");
+}
+
+/* Events are read again after event processing fails, instead of re-arming the interrupt. */
+ZTEST(npmx_bus_retry, test_resync)
+{
+	npmx_instance_t *npmx_instance = npmx_driver_instance_get(pmic_dev);
+	struct npmx_driver_event_subscriber subscriber = {
+		.handler = event_handler,
+		.type = NPMX_CALLBACK_TYPE_EVENT_SHIPHOLD,
+		.mask = BIT(0),
+	};
+	struct npmx_driver_bus_recovery_stats before;
+	struct npmx_driver_bus_recovery_stats after;
+	uint8_t events;
+
+	retry_check();
+	k_sem_reset(&event_sem);
+	zassert_ok(npmx_driver_event_subscribe(pmic_dev, &subscriber));
+	zassert_equal(npmx_core_event_interrupt_enable(npmx_instance, NPMX_EVENT_GROUP_SHIPHOLD,
+						       BIT(0)),
+		      NPMX_SUCCESS);
+	stats_get(&before);
+
+	npmx_emul_transfer_fail_set(pmic_emul, FAILS_TO_GIVE_UP);
+	zassert_ok(npmx_emul_event_raise(pmic_emul, NPMX_EVENT_GROUP_SHIPHOLD, BIT(0)));
+
+	zassert_ok(k_sem_take(&event_sem, K_MSEC(EVENT_TIMEOUT_MS)), "event not delivered");
+	k_msleep(EVENT_TIMEOUT_MS);
+
+	stats_get(&after);
+	zassert_true(after.resyncs > before.resyncs, "event processing not resynchronized");
+
+	zassert_ok(npmx_emul_reg_get(pmic_emul, 0x0012, &events, 1));
+	zassert_equal(events, 0, "event not cleared");
+
+	zassert_equal(npmx_core_event_interrupt_disable(npmx_instance, NPMX_EVENT_GROUP_SHIPHOLD,
+							BIT(0)),
+		      NPMX_SUCCESS);
+	zassert_ok(npmx_driver_event_unsubscribe(pmic_dev, &subscriber));
+}
+
+static void npmx_bus_retry_after(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	npmx_emul_transfer_fail_set(pmic_emul, 0);
+}
+
+ZTEST_SUITE(npmx_bus_retry, NULL, NULL, NULL, npmx_bus_retry_after, NULL);
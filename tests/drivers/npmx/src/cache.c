@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <npmx_driver.h>
+#include <npmx_emul.h>
+
+#include <zephyr/device.h>
+#include <zephyr/drivers/emul.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+static const struct device *pmic_dev = DEVICE_DT_GET(DT_NODELABEL(npm_0));
+static const struct emul *pmic_emul = EMUL_DT_GET(DT_NODELABEL(npm_0));
+
+static uint8_t config[NPMX_DRIVER_CONFIG_SIZE];
+static uint8_t other[NPMX_DRIVER_CONFIG_SIZE];
+
+/* Address of the first configuration register, at offset 0 of the snapshot. */
+static uint16_t first_register_get(void)
+{
+	struct npmx_driver_config_span span;
+
+	zassert_ok(npmx_driver_config_span_get(0, &span));
+
+	return span.register_address;
+}
+
+/* Cached registers are read from RAM, until the cache is invalidated. */
+ZTEST(npmx_cache, test_read_cached)
+{
+	uint16_t address = first_register_get();
+	uint32_t transfers;
+	uint8_t value;
+
+	zassert_ok(npmx_driver_config_read(pmic_dev, config));
+
+	/* Changed behind the driver, so a value taken from the bus would differ. */
+	value = config[0] ^ 0x01;
+	zassert_ok(npmx_emul_reg_set(pmic_emul, address, &value, 1));
+
+	transfers = npmx_emul_transfer_count_get(pmic_emul);
+	zassert_ok(npmx_driver_config_read(pmic_dev, other));
+	zassert_equal(npmx_emul_transfer_count_get(pmic_emul), transfers,
+		      "cached registers read from the bus");
+	zassert_equal(other[0], config[0]);
+
+	npmx_driver_cache_invalidate(pmic_dev);
+
+	zassert_ok(npmx_driver_config_read(pmic_dev, other));
+	zassert_true(npmx_emul_transfer_count_get(pmic_emul) > transfers);
+	zassert_equal(other[0], value);
+
+	zassert_ok(npmx_emul_reg_set(pmic_emul, address, &config[0], 1));
+}
+
+/* Written registers are kept in the cache and in the device. */
+ZTEST(npmx_cache, test_write_through)
+{
+	uint16_t address = first_register_get();
+	uint32_t transfers;
+	uint8_t value;
+
+	zassert_ok(npmx_driver_config_read(pmic_dev, config));
+
+	memcpy(other, config, sizeof(other));
+	other[0] ^= 0x01;
+	zassert_ok(npmx_driver_config_write(pmic_dev, other));
+
+	zassert_ok(npmx_emul_reg_get(pmic_emul, address, &value, 1));
+	zassert_equal(value, other[0], "write not sent to the device");
+
+	transfers = npmx_emul_transfer_count_get(pmic_emul);
+	zassert_ok(npmx_driver_config_read(pmic_dev, other));
+	zassert_equal(npmx_emul_transfer_count_get(pmic_emul), transfers,
+		      "written registers read from the bus");
+	zassert_equal(other[0], value);
+
+	zassert_ok(npmx_driver_config_write(pmic_dev, config));
+}
+
+static void npmx_cache_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	npmx_driver_cache_invalidate(pmic_dev);
+}
+
+ZTEST_SUITE(npmx_cache, NULL, NULL, npmx_cache_before, NULL, NULL);
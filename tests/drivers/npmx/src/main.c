@@ -0,0 +1,232 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <npmx_core.h>
+#include <npmx_driver.h>
+#include <npmx_emul.h>
+
+#include <zephyr/device.h>
+#include <zephyr/drivers/emul.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+/* Time allowed for the driver to handle raised events. */
+#define EVENT_TIMEOUT_MS 100
+
+/* Event group with the datasheet address of its EVENTS*SET register and its callback type. */
+struct event_group_case {
+	npmx_event_group_t group;
+	npmx_callback_type_t type;
+	uint16_t set_addr;
+};
+
+/* Addresses are taken from the nPM1300 datasheet, not from the driver or emulator tables. */
+static const struct event_group_case event_group_cases[] = {
+	{ NPMX_EVENT_GROUP_ADC, NPMX_CALLBACK_TYPE_EVENT_ADC, 0x0002 },
+	{ NPMX_EVENT_GROUP_BAT_CHAR_STATUS, NPMX_CALLBACK_TYPE_EVENT_BAT_CHAR_STATUS, 0x000A },
+	{ NPMX_EVENT_GROUP_BAT_CHAR_BAT, NPMX_CALLBACK_TYPE_EVENT_BAT_CHAR_BAT, 0x000E },
+	{ NPMX_EVENT_GROUP_SHIPHOLD, NPMX_CALLBACK_TYPE_EVENT_SHIPHOLD, 0x0012 },
+	{ NPMX_EVENT_GROUP_VBUSIN_VOLTAGE, NPMX_CALLBACK_TYPE_EVENT_VBUSIN_VOLTAGE, 0x0016 },
+	{ NPMX_EVENT_GROUP_VBUSIN_THERMAL, NPMX_CALLBACK_TYPE_EVENT_VBUSIN_THERMAL_USB, 0x001A },
+};
+
+/* Offset of the INTEN*SET register from the EVENTS*SET register of each event group. */
+#define INTENSET_OFFSET 2U
+
+static const struct device *pmic_dev = DEVICE_DT_GET(DT_NODELABEL(npm_0));
+static const struct emul *pmic_emul = EMUL_DT_GET(DT_NODELABEL(npm_0));
+
+static K_SEM_DEFINE(event_sem, 0, 1);
+static struct npmx_driver_event received;
+
+static void event_handler(struct npmx_driver_event const *p_event, void *p_user_data)
+{
+	ARG_UNUSED(p_user_data);
+
+	received = *p_event;
+	k_sem_give(&event_sem);
+}
+
+static K_SEM_DEFINE(handler_entered, 0, 1);
+static K_SEM_DEFINE(handler_release, 0, 1);
+static bool handler_released;
+
+/* Keeps running until released by the test, or the event timeout expires. */
+static void blocking_handler(struct npmx_driver_event const *p_event, void *p_user_data)
+{
+	ARG_UNUSED(p_event);
+	ARG_UNUSED(p_user_data);
+
+	k_sem_give(&handler_entered);
+	handler_released = (k_sem_take(&handler_release, K_MSEC(EVENT_TIMEOUT_MS)) == 0);
+	k_sem_give(&event_sem);
+}
+
+static K_SEM_DEFINE(burst_sem, 0, 2);
+
+static void burst_handler(struct npmx_driver_event const *p_event, void *p_user_data)
+{
+	ARG_UNUSED(p_event);
+	ARG_UNUSED(p_user_data);
+
+	k_sem_give(&burst_sem);
+}
+
+static uint8_t emul_reg_get(uint16_t register_address)
+{
+	uint8_t value;
+
+	zassert_ok(npmx_emul_reg_get(pmic_emul, register_address, &value, 1));
+
+	return value;
+}
+
+/* The npmx library writes interrupt enables to its own register definitions. */
+ZTEST(npmx_driver, test_event_register_addresses)
+{
+	npmx_instance_t *npmx_instance = npmx_driver_instance_get(pmic_dev);
+
+	for (size_t i = 0; i < ARRAY_SIZE(event_group_cases); i++) {
+		struct event_group_case const *c = &event_group_cases[i];
+
+		zassert_equal(npmx_core_event_interrupt_enable(npmx_instance, c->group, BIT(0)),
+			      NPMX_SUCCESS);
+		zassert_equal(emul_reg_get(c->set_addr + INTENSET_OFFSET) & BIT(0), BIT(0),
+			      "interrupt enable of group %u not at 0x%04X", c->group,
+			      c->set_addr + INTENSET_OFFSET);
+		zassert_equal(npmx_core_event_interrupt_disable(npmx_instance, c->group, BIT(0)),
+			      NPMX_SUCCESS);
+	}
+}
+
+/* Events raised at the datasheet addresses are delivered and cleared by the driver. */
+ZTEST(npmx_driver, test_events_delivered)
+{
+	npmx_instance_t *npmx_instance = npmx_driver_instance_get(pmic_dev);
+
+	for (size_t i = 0; i < ARRAY_SIZE(event_group_cases); i++) {
+		struct event_group_case const *c = &event_group_cases[i];
+		struct npmx_driver_event_subscriber subscriber = {
+			.handler = event_handler,
+			.type = c->type,
+			.mask = BIT(0),
+		};
+
+		k_sem_reset(&event_sem);
+		zassert_ok(npmx_driver_event_subscribe(pmic_dev, &subscriber));
+		zassert_equal(npmx_core_event_interrupt_enable(npmx_instance, c->group, BIT(0)),
+			      NPMX_SUCCESS);
+
+		zassert_ok(npmx_emul_event_raise(pmic_emul, c->group, BIT(0)));
+
+		zassert_ok(k_sem_take(&event_sem, K_MSEC(EVENT_TIMEOUT_MS)),
+			   "events of group %u not delivered", c->group);
+		zassert_equal(received.type, c->type);
+		zassert_equal(received.mask & BIT(0), BIT(0));
+		zassert_equal(emul_reg_get(c->set_addr), 0, "events of group %u not cleared",
+			      c->group);
+
+		zassert_equal(npmx_core_event_interrupt_disable(npmx_instance, c->group, BIT(0)),
+			      NPMX_SUCCESS);
+		zassert_ok(npmx_driver_event_unsubscribe(pmic_dev, &subscriber));
+	}
+}
+
+/* Subscriptions can be changed from another thread while a handler is running. */
+ZTEST(npmx_driver, test_subscribe_during_delivery)
+{
+	npmx_instance_t *npmx_instance = npmx_driver_instance_get(pmic_dev);
+	struct event_group_case const *c = &event_group_cases[0];
+	struct npmx_driver_event_subscriber blocking = {
+		.handler = blocking_handler,
+		.type = c->type,
+		.mask = BIT(0),
+	};
+	struct npmx_driver_event_subscriber other = {
+		.handler = event_handler,
+		.type = c->type,
+		.mask = BIT(0),
+	};
+
+	k_sem_reset(&event_sem);
+	k_sem_reset(&handler_entered);
+	k_sem_reset(&handler_release);
+	zassert_ok(npmx_driver_event_subscribe(pmic_dev, &blocking));
+	zassert_equal(npmx_core_event_interrupt_enable(npmx_instance, c->group, BIT(0)),
+		      NPMX_SUCCESS);
+
+	zassert_ok(npmx_emul_event_raise(pmic_emul, c->group, BIT(0)));
+	zassert_ok(k_sem_take(&handler_entered, K_MSEC(EVENT_TIMEOUT_MS)));
+
+	zassert_ok(npmx_driver_event_subscribe(pmic_dev, &other));
+	zassert_ok(npmx_driver_event_unsubscribe(pmic_dev, &other));
+	k_sem_give(&handler_release);
+
+	zassert_ok(k_sem_take(&event_sem, K_MSEC(EVENT_TIMEOUT_MS)));
+	zassert_true(handler_released, "subscription blocked by the running handler");
+
+	zassert_equal(npmx_core_event_interrupt_disable(npmx_instance, c->group, BIT(0)),
+		      NPMX_SUCCESS);
+	zassert_ok(npmx_driver_event_unsubscribe(pmic_dev, &blocking));
+}
+
+/* Events of several groups raised in a burst are handled in a single pass. */
+ZTEST(npmx_driver, test_events_coalesced)
+{
+	npmx_instance_t *npmx_instance = npmx_driver_instance_get(pmic_dev);
+	struct event_group_case const *cases[] = { &event_group_cases[3], &event_group_cases[4] };
+	struct npmx_driver_event_subscriber subscribers[ARRAY_SIZE(cases)];
+	struct npmx_driver_latency latency;
+
+	if (!IS_ENABLED(CONFIG_NPMX_INT_COALESCE) || !IS_ENABLED(CONFIG_NPMX_INT_LATENCY)) {
+		ztest_test_skip();
+	}
+
+	k_sem_reset(&burst_sem);
+
+	for (size_t i = 0; i < ARRAY_SIZE(cases); i++) {
+		subscribers[i] = (struct npmx_driver_event_subscriber){
+			.handler = burst_handler,
+			.type = cases[i]->type,
+			.mask = BIT(0),
+		};
+		zassert_ok(npmx_driver_event_subscribe(pmic_dev, &subscribers[i]));
+		zassert_equal(npmx_core_event_interrupt_enable(npmx_instance, cases[i]->group,
+							       BIT(0)),
+			      NPMX_SUCCESS);
+	}
+
+	npmx_driver_latency_reset(pmic_dev);
+
+	for (size_t i = 0; i < ARRAY_SIZE(cases); i++) {
+		zassert_ok(npmx_emul_event_raise(pmic_emul, cases[i]->group, BIT(0)));
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(cases); i++) {
+		zassert_ok(k_sem_take(&burst_sem, K_MSEC(EVENT_TIMEOUT_MS)),
+			   "events of group %u not delivered", cases[i]->group);
+		zassert_equal(emul_reg_get(cases[i]->set_addr), 0);
+	}
+
+	zassert_ok(npmx_driver_latency_get(pmic_dev, &latency));
+	zassert_equal(latency.count, 1, "burst handled in %u passes", latency.count);
+
+	for (size_t i = 0; i < ARRAY_SIZE(cases); i++) {
+		zassert_equal(npmx_core_event_interrupt_disable(npmx_instance, cases[i]->group,
+								BIT(0)),
+			      NPMX_SUCCESS);
+		zassert_ok(npmx_driver_event_unsubscribe(pmic_dev, &subscribers[i]));
+	}
+}
+
+static void *npmx_driver_setup(void)
+{
+	zassert_true(device_is_ready(pmic_dev), "PMIC device not ready");
+
+	return NULL;
+}
+
+ZTEST_SUITE(npmx_driver, NULL, npmx_driver_setup, NULL, NULL, NULL);
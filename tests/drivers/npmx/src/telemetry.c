@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <npmx_adc_sampler.h>
+#include <npmx_driver.h>
+#include <npmx_telemetry.h>
+
+#include <zephyr/device.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/crc.h>
+#include <zephyr/ztest.h>
+
+/* Sampling period, short enough to fill the ring buffer in a few periods. */
+#define SAMPLE_PERIOD_MS 20
+
+/* Size of the ADC channel payload on the wire. */
+#define ADC_RECORD_SIZE 22
+
+static const struct device *pmic_dev = DEVICE_DT_GET(DT_NODELABEL(npm_0));
+
+static struct npmx_telemetry telemetry;
+static struct npmx_adc_sampler sampler;
+
+/* Last frame passed to the transport. */
+static struct npmx_telemetry_header last_header;
+static uint8_t last_payload[NPMX_TELEMETRY_PAYLOAD_MAX];
+static size_t frame_count;
+
+static int capture_send(struct npmx_telemetry_header const *p_header, void const *p_payload,
+			size_t len, void *p_user_data)
+{
+	ARG_UNUSED(p_user_data);
+
+	last_header = *p_header;
+	memcpy(last_payload, p_payload, len);
+	frame_count++;
+
+	return 0;
+}
+
+/* Sends the subscribe command as the host would. */
+static void subscribe(uint8_t channels)
+{
+	uint8_t frame[sizeof(struct npmx_telemetry_header) + 2];
+	uint8_t *p_payload = &frame[sizeof(struct npmx_telemetry_header)];
+	struct npmx_telemetry_header header = {
+		.sync = NPMX_TELEMETRY_SYNC,
+		.channel = NPMX_TELEMETRY_CHANNEL_CONTROL,
+		.len = 2,
+	};
+
+	p_payload[0] = NPMX_TELEMETRY_COMMAND_SUBSCRIBE;
+	p_payload[1] = channels;
+	header.crc = sys_cpu_to_le16(crc16_ccitt(0xFFFFU, p_payload, 2));
+	memcpy(frame, &header, sizeof(header));
+
+	zassert_ok(npmx_telemetry_rx(&telemetry, frame, sizeof(frame)));
+}
+
+/* Samples are sent in the packed little-endian record, independent of the configuration. */
+ZTEST(npmx_telemetry, test_adc_record)
+{
+	size_t count;
+
+	zassert_equal(sizeof(struct npmx_telemetry_adc), ADC_RECORD_SIZE);
+
+	zassert_ok(npmx_adc_sampler_start(&sampler, SAMPLE_PERIOD_MS));
+	k_msleep(4 * SAMPLE_PERIOD_MS);
+	npmx_adc_sampler_stop(&sampler);
+
+	/* Not subscribed: samples are left in the sampler. */
+	zassert_equal(npmx_telemetry_adc_publish(&telemetry, &sampler), 0);
+	zassert_equal(frame_count, 0);
+
+	subscribe(BIT(NPMX_TELEMETRY_CHANNEL_ADC));
+
+	count = npmx_telemetry_adc_publish(&telemetry, &sampler);
+	zassert_true(count > 0, "no samples sent");
+	zassert_equal(frame_count, count);
+
+	zassert_equal(last_header.sync, NPMX_TELEMETRY_SYNC);
+	zassert_equal(last_header.channel, NPMX_TELEMETRY_CHANNEL_ADC);
+	zassert_equal(last_header.len, ADC_RECORD_SIZE);
+	zassert_equal(sys_le16_to_cpu(last_header.crc),
+		      crc16_ccitt(0xFFFFU, last_payload, ADC_RECORD_SIZE));
+	zassert_true(sys_get_le32(&last_payload[0]) <= k_uptime_get_32(),
+		     "timestamp not little-endian uptime");
+}
+
+static void *npmx_telemetry_setup(void)
+{
+	zassert_true(device_is_ready(pmic_dev), "PMIC device not ready");
+
+	npmx_adc_sampler_init(&sampler, pmic_dev);
+
+	return NULL;
+}
+
+static void npmx_telemetry_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	npmx_telemetry_init(&telemetry, capture_send, NULL);
+	frame_count = 0;
+}
+
+ZTEST_SUITE(npmx_telemetry, NULL, npmx_telemetry_setup, npmx_telemetry_before, NULL, NULL);
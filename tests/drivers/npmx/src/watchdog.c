@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <npmx_driver.h>
+#include <npmx_emul.h>
+#include <npmx_timer.h>
+
+#include <zephyr/device.h>
+#include <zephyr/drivers/emul.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+/* Watchdog period of 64 ticks of the 512 Hz TIMER clock. */
+#define PERIOD_MS 125U
+
+/* Kick interval, piggyback window start and kick retry delay derived from the period. */
+#define INTERVAL_MS ((PERIOD_MS * (100U - CONFIG_NPMX_WATCHDOG_MARGIN_PERCENT)) / 100U)
+#define WINDOW_MS ((INTERVAL_MS * CONFIG_NPMX_WATCHDOG_PIGGYBACK_PERCENT) / 100U)
+#define RETRY_MS ((PERIOD_MS - INTERVAL_MS) / 2U)
+
+/* Slack for the system work queue latency. */
+#define SLACK_MS 10U
+
+/* Registers of an unused peripheral, neither cached nor changed by the emulator. */
+#define SCRATCH_ADDR 0x0F00U
+
+#if defined(CONFIG_NPMX_BUS_RETRY)
+/* Number of failed transfers after which a transfer is given up. */
+#define FAILS_TO_GIVE_UP (1U + CONFIG_NPMX_BUS_RETRY_COUNT)
+#else
+#define FAILS_TO_GIVE_UP 1U
+#endif
+
+static const struct device *pmic_dev = DEVICE_DT_GET(DT_NODELABEL(npm_0));
+static const struct emul *pmic_emul = EMUL_DT_GET(DT_NODELABEL(npm_0));
+
+static const npmx_timer_config_t timer_config = {
+	.mode = NPMX_TIMER_MODE_WATCHDOG_WARNING,
+	.prescaler = NPMX_TIMER_PRESCALER_FAST,
+	.compare_value = 64,
+};
+
+static void stats_get(struct npmx_driver_watchdog_stats *p_stats)
+{
+	zassert_ok(npmx_driver_watchdog_stats_get(pmic_dev, p_stats));
+}
+
+/* Without other register accesses, the watchdog is kicked at the deadline. */
+ZTEST(npmx_watchdog, test_kicked_at_deadline)
+{
+	struct npmx_driver_watchdog_stats before;
+	struct npmx_driver_watchdog_stats after;
+
+	stats_get(&before);
+	zassert_ok(npmx_driver_watchdog_start(pmic_dev, &timer_config, 0));
+
+	k_msleep(INTERVAL_MS + SLACK_MS);
+
+	stats_get(&after);
+	zassert_true(after.kicks > before.kicks, "watchdog not kicked at the deadline");
+	zassert_equal(after.piggybacked, before.piggybacked);
+	zassert_equal(after.errors, before.errors);
+}
+
+/* Once the piggyback window is open, the kick is sent with the next batch. */
+ZTEST(npmx_watchdog, test_kick_piggybacked)
+{
+	struct npmx_driver_watchdog_stats before;
+	struct npmx_driver_watchdog_stats after;
+	uint8_t value;
+
+	stats_get(&before);
+	zassert_ok(npmx_driver_watchdog_start(pmic_dev, &timer_config, 0));
+
+	k_msleep(WINDOW_MS + SLACK_MS);
+
+	zassert_ok(npmx_driver_batch_begin(pmic_dev));
+	zassert_ok(npmx_driver_batch_read(pmic_dev, SCRATCH_ADDR, &value, 1));
+	zassert_ok(npmx_driver_batch_end(pmic_dev));
+
+	stats_get(&after);
+	zassert_equal(after.kicks, before.kicks + 1);
+	zassert_equal(after.piggybacked, before.piggybacked + 1);
+}
+
+/* A piggybacked kick lost with its batch is retried within the margin. */
+ZTEST(npmx_watchdog, test_piggyback_failed)
+{
+	struct npmx_driver_watchdog_stats before;
+	struct npmx_driver_watchdog_stats after;
+	uint8_t value;
+
+	stats_get(&before);
+	zassert_ok(npmx_driver_watchdog_start(pmic_dev, &timer_config, 0));
+
+	k_msleep(WINDOW_MS + SLACK_MS);
+
+	npmx_emul_transfer_fail_set(pmic_emul, FAILS_TO_GIVE_UP);
+	zassert_ok(npmx_driver_batch_begin(pmic_dev));
+	zassert_ok(npmx_driver_batch_read(pmic_dev, SCRATCH_ADDR, &value, 1));
+	zassert_equal(npmx_driver_batch_end(pmic_dev), -EIO);
+
+	stats_get(&after);
+	zassert_equal(after.errors, before.errors + 1);
+	zassert_equal(after.kicks, before.kicks);
+
+	k_msleep(RETRY_MS + SLACK_MS);
+
+	stats_get(&after);
+	zassert_equal(after.kicks, before.kicks + 1, "failed kick not retried");
+	zassert_equal(after.piggybacked, before.piggybacked);
+}
+
+static void npmx_watchdog_after(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	npmx_emul_transfer_fail_set(pmic_emul, 0);
+	(void)npmx_driver_watchdog_stop(pmic_dev);
+}
+
+ZTEST_SUITE(npmx_watchdog, NULL, NULL, NULL, npmx_watchdog_after, NULL);